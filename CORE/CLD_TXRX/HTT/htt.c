@@ -191,6 +191,8 @@ htt_attach(
          ol_cfg_is_full_reorder_offload(pdev->ctrl_pdev);
     adf_os_print("is_full_reorder_offloaded? %d\n",
                   (int)pdev->cfg.is_full_reorder_offload);
+    pdev->cfg.rx_in_order_lookup_mode =
+         ol_cfg_rx_in_order_lookup_mode(pdev->ctrl_pdev);
     pdev->targetdef = htc_get_targetdef(htc_pdev);
     /*
      * Connect to HTC service.
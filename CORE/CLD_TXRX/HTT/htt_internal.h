@@ -401,6 +401,13 @@ htt_rx_hash_list_insert(struct htt_pdev_t *pdev, u_int32_t paddr,
 adf_nbuf_t
 htt_rx_hash_list_lookup(struct htt_pdev_t *pdev, u_int32_t paddr);
 
+int
+htt_rx_paddr_tbl_insert(struct htt_pdev_t *pdev, u_int32_t paddr,
+     adf_nbuf_t netbuf);
+
+adf_nbuf_t
+htt_rx_paddr_tbl_lookup(struct htt_pdev_t *pdev, u_int32_t paddr);
+
 #ifdef IPA_UC_OFFLOAD
 int
 htt_tx_ipa_uc_attach(struct htt_pdev_t *pdev,
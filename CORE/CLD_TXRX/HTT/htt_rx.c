@@ -97,6 +97,33 @@ int dumpEnable;
 void
 htt_rx_hash_deinit(struct htt_pdev_t *pdev);
 
+static int
+htt_rx_paddr_tbl_init(struct htt_pdev_t *pdev);
+
+static void
+htt_rx_paddr_tbl_deinit(struct htt_pdev_t *pdev);
+
+static inline int
+htt_rx_in_order_paddr_insert(struct htt_pdev_t *pdev, u_int32_t paddr,
+     adf_nbuf_t netbuf)
+{
+    if (pdev->cfg.rx_in_order_lookup_mode ==
+        HTT_RX_IN_ORDER_LOOKUP_PADDR_TBL) {
+        return htt_rx_paddr_tbl_insert(pdev, paddr, netbuf);
+    }
+    return htt_rx_hash_list_insert(pdev, paddr, netbuf);
+}
+
+static inline adf_nbuf_t
+htt_rx_in_order_paddr_lookup(struct htt_pdev_t *pdev, u_int32_t paddr)
+{
+    if (pdev->cfg.rx_in_order_lookup_mode ==
+        HTT_RX_IN_ORDER_LOOKUP_PADDR_TBL) {
+        return htt_rx_paddr_tbl_lookup(pdev, paddr);
+    }
+    return htt_rx_hash_list_lookup(pdev, paddr);
+}
+
 static int
 CEIL_PWR2(int value)
 {
@@ -213,6 +240,154 @@ htt_rx_ring_refill_retry(void *arg)
     htt_rx_msdu_buff_replenish(pdev);
 }
 
+#ifdef DEBUG_DMA_DONE
+#define HTT_RX_BUF_DMA_DIR ADF_OS_DMA_BIDIRECTIONAL
+#else
+#define HTT_RX_BUF_DMA_DIR ADF_OS_DMA_FROM_DEVICE
+#endif
+
+#ifdef HTT_RX_BUF_RECYCLE
+#ifndef ADF_NBUF_RX_PAGE_POOL
+#error "HTT_RX_BUF_RECYCLE needs adf rx page pool support (kernel 3.6 or later)"
+#endif
+
+/*
+ * Number of pool slots a refill looks at for a free page before it
+ * gives up a page still held by the host or the stack.
+ */
+#define HTT_RX_PAGE_POOL_SCAN 16
+
+/*
+ * The rx ring buffers are built on pages that stay DMA mapped for as
+ * long as they are in the pool. A page is free for the next refill once
+ * every netbuf built on it has been freed, whether by the host or by
+ * the network stack, so delivered buffers come back without a callback.
+ * Only the ring refill, which runs one thread at a time, touches the
+ * pool, so it needs no lock.
+ */
+static int
+htt_rx_page_pool_init(struct htt_pdev_t *pdev)
+{
+    /* a full ring plus as many buffers again held by the host or stack */
+    pdev->rx_ring.page_pool.size = pdev->rx_ring.size * 2;
+    pdev->rx_ring.page_pool.pages = adf_os_mem_alloc(
+        pdev->osdev,
+        pdev->rx_ring.page_pool.size * sizeof(adf_nbuf_rx_page_t));
+    if (!pdev->rx_ring.page_pool.pages) {
+        return 1;
+    }
+    adf_os_mem_zero(pdev->rx_ring.page_pool.pages,
+                    pdev->rx_ring.page_pool.size * sizeof(adf_nbuf_rx_page_t));
+    pdev->rx_ring.page_pool.next = 0;
+    adf_os_mem_zero(&pdev->rx_ring.page_pool.stats,
+                    sizeof(pdev->rx_ring.page_pool.stats));
+    return 0;
+}
+
+static void
+htt_rx_page_pool_deinit(struct htt_pdev_t *pdev)
+{
+    int i;
+
+    for (i = 0; i < pdev->rx_ring.page_pool.size; i++) {
+        if (pdev->rx_ring.page_pool.pages[i].page) {
+            adf_nbuf_rx_page_release(pdev->osdev,
+                                     &pdev->rx_ring.page_pool.pages[i],
+                                     HTT_RX_BUF_DMA_DIR);
+        }
+    }
+    adf_os_mem_free(pdev->rx_ring.page_pool.pages);
+    pdev->rx_ring.page_pool.pages = NULL;
+}
+
+/*
+ * Find a page for the next rx ring buffer: a free page, a new page for
+ * an empty slot, or failing both, a new page in place of one the host
+ * or the stack still holds. That page is left to its netbuf.
+ */
+static adf_nbuf_rx_page_t *
+htt_rx_page_pool_get(struct htt_pdev_t *pdev)
+{
+    adf_nbuf_rx_page_t *rx_page = NULL;
+    adf_nbuf_rx_page_t *held = NULL;
+    int idx = pdev->rx_ring.page_pool.next;
+    int i;
+
+    for (i = 0; i < HTT_RX_PAGE_POOL_SCAN; i++) {
+        rx_page = &pdev->rx_ring.page_pool.pages[idx];
+        idx = (idx + 1) & (pdev->rx_ring.page_pool.size - 1);
+
+        if (!rx_page->page) {
+            if (adf_nbuf_rx_page_alloc(pdev->osdev, rx_page,
+                                       HTT_RX_BUF_DMA_DIR) == A_STATUS_OK) {
+                pdev->rx_ring.page_pool.stats.allocated++;
+                break;
+            }
+        } else if (adf_nbuf_rx_page_refs(rx_page) == 1) {
+            pdev->rx_ring.page_pool.stats.reused++;
+            break;
+        } else if (!held && adf_nbuf_rx_page_refs(rx_page) == 2) {
+            /* one netbuf holds it and it is not posted to the target */
+            held = rx_page;
+        }
+        rx_page = NULL;
+    }
+
+    if (!rx_page && held) {
+        adf_nbuf_rx_page_release(pdev->osdev, held, HTT_RX_BUF_DMA_DIR);
+        pdev->rx_ring.page_pool.stats.released++;
+        if (adf_nbuf_rx_page_alloc(pdev->osdev, held,
+                                   HTT_RX_BUF_DMA_DIR) == A_STATUS_OK) {
+            pdev->rx_ring.page_pool.stats.allocated++;
+            rx_page = held;
+        }
+    }
+
+    if (!rx_page) {
+        pdev->rx_ring.page_pool.stats.stalled++;
+        return NULL;
+    }
+    pdev->rx_ring.page_pool.next = idx;
+    return rx_page;
+}
+
+/*
+ * Take an rx ring buffer back from the target. Its page stays mapped,
+ * so this only syncs the buffer for the CPU.
+ */
+static inline void
+htt_rx_netbuf_unmap(struct htt_pdev_t *pdev, adf_nbuf_t netbuf)
+{
+    adf_nbuf_rx_page_unmap(pdev->osdev, netbuf, HTT_RX_BUF_DMA_DIR);
+}
+
+void
+htt_rx_buf_recycle_stats_display(htt_pdev_handle pdev)
+{
+    u_int32_t reused = pdev->rx_ring.page_pool.stats.reused;
+    u_int32_t total = reused + pdev->rx_ring.page_pool.stats.allocated;
+
+    if (pdev->cfg.is_high_latency) {
+        return;
+    }
+    adf_os_print("  rx page pool: %u reused of %u refills (%u%%)\n",
+                 reused, total, total ? (reused * 100) / total : 0);
+    adf_os_print("    allocated %u, released while held %u, stalled %u\n",
+                 pdev->rx_ring.page_pool.stats.allocated,
+                 pdev->rx_ring.page_pool.stats.released,
+                 pdev->rx_ring.page_pool.stats.stalled);
+}
+#else
+#define htt_rx_page_pool_init(pdev) 0
+#define htt_rx_page_pool_deinit(pdev)
+
+static inline void
+htt_rx_netbuf_unmap(struct htt_pdev_t *pdev, adf_nbuf_t netbuf)
+{
+    adf_nbuf_unmap(pdev->osdev, netbuf, HTT_RX_BUF_DMA_DIR);
+}
+#endif /* HTT_RX_BUF_RECYCLE */
+
 void
 htt_rx_ring_fill_n(struct htt_pdev_t *pdev, int num)
 {
@@ -225,8 +400,17 @@ htt_rx_ring_fill_n(struct htt_pdev_t *pdev, int num)
         u_int32_t paddr;
         adf_nbuf_t rx_netbuf;
         int headroom;
+#ifdef HTT_RX_BUF_RECYCLE
+        adf_nbuf_rx_page_t *rx_page;
+#endif
 
+#ifdef HTT_RX_BUF_RECYCLE
+        rx_page = htt_rx_page_pool_get(pdev);
+        rx_netbuf = rx_page ?
+            adf_nbuf_rx_page_build(pdev->osdev, rx_page) : NULL;
+#else
         rx_netbuf = adf_nbuf_alloc(pdev->osdev, HTT_RX_BUF_SIZE, 0, 4, FALSE);
+#endif
         if (!rx_netbuf) {
             adf_os_timer_cancel(&pdev->rx_ring.refill_retry_timer);
             /*
@@ -264,10 +448,12 @@ htt_rx_ring_fill_n(struct htt_pdev_t *pdev, int num)
         headroom = adf_nbuf_data(rx_netbuf) - (u_int8_t *) rx_desc;
         adf_nbuf_push_head(rx_netbuf, headroom);
 
-#ifdef DEBUG_DMA_DONE
-        status = adf_nbuf_map(pdev->osdev, rx_netbuf, ADF_OS_DMA_BIDIRECTIONAL);
+#ifdef HTT_RX_BUF_RECYCLE
+        adf_nbuf_rx_page_map(pdev->osdev, rx_page, rx_netbuf,
+                             HTT_RX_BUF_DMA_DIR);
+        status = A_STATUS_OK;
 #else
-        status = adf_nbuf_map(pdev->osdev, rx_netbuf, ADF_OS_DMA_FROM_DEVICE);
+        status = adf_nbuf_map(pdev->osdev, rx_netbuf, HTT_RX_BUF_DMA_DIR);
 #endif
         if (status != A_STATUS_OK) {
             adf_nbuf_free(rx_netbuf);
@@ -276,14 +462,9 @@ htt_rx_ring_fill_n(struct htt_pdev_t *pdev, int num)
         paddr = adf_nbuf_get_frag_paddr_lo(rx_netbuf, 0);
         if (pdev->cfg.is_full_reorder_offload) {
             if(adf_os_unlikely(
-               htt_rx_hash_list_insert(pdev, paddr, rx_netbuf))) {
+               htt_rx_in_order_paddr_insert(pdev, paddr, rx_netbuf))) {
                 adf_os_print("%s: hash insert failed!\n", __FUNCTION__);
-#ifdef DEBUG_DMA_DONE
-                adf_nbuf_unmap(pdev->osdev, rx_netbuf,
-                                ADF_OS_DMA_BIDIRECTIONAL);
-#else
-                adf_nbuf_unmap(pdev->osdev, rx_netbuf, ADF_OS_DMA_FROM_DEVICE);
-#endif
+                htt_rx_netbuf_unmap(pdev, rx_netbuf);
                 adf_nbuf_free(rx_netbuf);
                 goto fail;
             }
@@ -342,21 +523,15 @@ htt_rx_detach(struct htt_pdev_t *pdev)
         int sw_rd_idx = pdev->rx_ring.sw_rd_idx.msdu_payld;
 
         while (sw_rd_idx != *(pdev->rx_ring.alloc_idx.vaddr)) {
-#ifdef DEBUG_DMA_DONE
-        adf_nbuf_unmap(
-            pdev->osdev, pdev->rx_ring.buf.netbufs_ring[sw_rd_idx],
-            ADF_OS_DMA_BIDIRECTIONAL);
-#else
-        adf_nbuf_unmap(
-            pdev->osdev, pdev->rx_ring.buf.netbufs_ring[sw_rd_idx],
-            ADF_OS_DMA_FROM_DEVICE);
-#endif
+            htt_rx_netbuf_unmap(
+                pdev, pdev->rx_ring.buf.netbufs_ring[sw_rd_idx]);
             adf_nbuf_free(pdev->rx_ring.buf.netbufs_ring[sw_rd_idx]);
             sw_rd_idx++;
             sw_rd_idx &= pdev->rx_ring.size_mask;
         }
         adf_os_mem_free(pdev->rx_ring.buf.netbufs_ring);
     }
+    htt_rx_page_pool_deinit(pdev);
 
     adf_os_mem_free_consistent(
         pdev->osdev,
@@ -697,7 +872,7 @@ htt_rx_in_order_netbuf_pop(
 {
     HTT_ASSERT1(htt_rx_in_order_ring_elems(pdev) != 0);
     pdev->rx_ring.fill_cnt--;
-    return htt_rx_hash_list_lookup(pdev, paddr);
+    return htt_rx_in_order_paddr_lookup(pdev, paddr);
 }
 
 /* FIX ME: this function applies only to LL rx descs. An equivalent for HL rx descs is needed. */
@@ -872,13 +1047,9 @@ htt_rx_amsdu_pop_ll(
          * so the unmap will unmap the entire buffer.
          */
         adf_nbuf_set_pktlen(msdu, HTT_RX_BUF_SIZE);
-#ifdef DEBUG_DMA_DONE
-        adf_nbuf_unmap(pdev->osdev, msdu, ADF_OS_DMA_BIDIRECTIONAL);
-#else
-        adf_nbuf_unmap(pdev->osdev, msdu, ADF_OS_DMA_FROM_DEVICE);
-#endif
+        htt_rx_netbuf_unmap(pdev, msdu);
 
-        /* cache consistency has been taken care of by the adf_nbuf_unmap */
+        /* cache consistency has been taken care of by htt_rx_netbuf_unmap */
 
         /*
          * Now read the rx descriptor.
@@ -1068,6 +1239,7 @@ htt_rx_amsdu_pop_ll(
             adf_nbuf_t next =
                 htt_rx_netbuf_pop(pdev);
             adf_nbuf_set_pktlen(next, HTT_RX_BUF_SIZE);
+            htt_rx_netbuf_unmap(pdev, next);
             msdu_len -= HTT_RX_BUF_SIZE;
             adf_nbuf_set_next(msdu, next);
             msdu = next;
@@ -1184,11 +1356,7 @@ htt_rx_offload_msdu_pop_ll(
     /* Fake read mpdu_desc to keep desc ptr in sync */
     htt_rx_mpdu_desc_list_next(pdev, NULL);
     adf_nbuf_set_pktlen(buf, HTT_RX_BUF_SIZE);
-#ifdef DEBUG_DMA_DONE
-    adf_nbuf_unmap(pdev->osdev, buf, ADF_OS_DMA_BIDIRECTIONAL);
-#else
-    adf_nbuf_unmap(pdev->osdev, buf, ADF_OS_DMA_FROM_DEVICE);
-#endif
+    htt_rx_netbuf_unmap(pdev, buf);
     msdu_hdr = (u_int32_t *)adf_nbuf_data(buf);
 
     /* First dword */
@@ -1232,11 +1400,7 @@ htt_rx_offload_paddr_msdu_pop_ll(
         return 0;
     }
     adf_nbuf_set_pktlen(buf, HTT_RX_BUF_SIZE);
-#ifdef DEBUG_DMA_DONE
-    adf_nbuf_unmap(pdev->osdev, buf, ADF_OS_DMA_BIDIRECTIONAL);
-#else
-    adf_nbuf_unmap(pdev->osdev, buf, ADF_OS_DMA_FROM_DEVICE);
-#endif
+    htt_rx_netbuf_unmap(pdev, buf);
     msdu_hdr = (u_int32_t *)adf_nbuf_data(buf);
 
     /* First dword */
@@ -1325,13 +1489,9 @@ htt_rx_amsdu_rx_in_order_pop_ll(
          * so the unmap will unmap the entire buffer.
          */
         adf_nbuf_set_pktlen(msdu, HTT_RX_BUF_SIZE);
-#ifdef DEBUG_DMA_DONE
-        adf_nbuf_unmap(pdev->osdev, msdu, ADF_OS_DMA_BIDIRECTIONAL);
-#else
-        adf_nbuf_unmap(pdev->osdev, msdu, ADF_OS_DMA_FROM_DEVICE);
-#endif
+        htt_rx_netbuf_unmap(pdev, msdu);
 
-        /* cache consistency has been taken care of by the adf_nbuf_unmap */
+        /* cache consistency has been taken care of by htt_rx_netbuf_unmap */
 
         rx_desc = htt_rx_desc(msdu);
         /*
@@ -2324,6 +2484,11 @@ htt_rx_hash_init(struct htt_pdev_t *pdev)
 {
     int i,j;
 
+    if (pdev->cfg.rx_in_order_lookup_mode ==
+        HTT_RX_IN_ORDER_LOOKUP_PADDR_TBL) {
+        return htt_rx_paddr_tbl_init(pdev);
+    }
+
     HTT_ASSERT2(IS_PWR2(RX_NUM_HASH_BUCKETS));
 
     pdev->rx_ring.hash_table = adf_os_mem_alloc(
@@ -2383,6 +2548,8 @@ htt_rx_hash_deinit(struct htt_pdev_t *pdev)
     struct htt_rx_hash_entry * hash_entry;
     htt_list_node * list_iter = NULL;
 
+    htt_rx_paddr_tbl_deinit(pdev);
+
     if (NULL == pdev->rx_ring.hash_table) {
         return;
     }
@@ -2395,6 +2562,7 @@ htt_rx_hash_deinit(struct htt_pdev_t *pdev)
                  (struct htt_rx_hash_entry *)((char *)list_iter -
                                                pdev->rx_ring.listnode_offset);
             if (hash_entry->netbuf) {
+                htt_rx_netbuf_unmap(pdev, hash_entry->netbuf);
                 adf_nbuf_free(hash_entry->netbuf);
                 hash_entry->paddr = 0;
             }
@@ -2433,6 +2601,200 @@ htt_rx_hash_dump_table(struct htt_pdev_t *pdev)
     }
 }
 
+/*--- RX In Order Paddr Table ------------------------------------------------*/
+
+/*
+ * Open-addressed alternative to the bucketed hash above.  All slots are
+ * allocated up front at twice the rx ring size, so insert never needs
+ * to allocate and the load factor never exceeds 1/2.  Collisions are
+ * resolved by linear probing, and removal shifts the following entries
+ * of the probe run back, so no tombstones accumulate.
+ * Like the list hash, these functions are not thread-safe.
+ */
+
+/* Fibonacci hashing - rx buffer addresses share their low-order bits */
+#define RX_PADDR_TBL_HASH(pdev, a) \
+    (((u_int32_t)(a) * 0x9e3779b1) >> (pdev)->rx_ring.paddr_tbl.shift)
+
+static int
+htt_rx_paddr_tbl_init(struct htt_pdev_t *pdev)
+{
+    u_int32_t log2 = 0;
+    u_int32_t num_slots;
+
+    /* keep the load factor at or below 1/2 */
+    num_slots = pdev->rx_ring.size << 1;
+    while ((1 << log2) < num_slots) {
+        log2++;
+    }
+    num_slots = 1 << log2;
+
+    pdev->rx_ring.paddr_tbl.slots = adf_os_mem_alloc(
+        pdev->osdev, num_slots * sizeof(struct htt_rx_paddr_tbl_entry));
+    if (!pdev->rx_ring.paddr_tbl.slots) {
+        adf_os_print("rx paddr table allocation failed!\n");
+        return 1;
+    }
+    adf_os_mem_zero(pdev->rx_ring.paddr_tbl.slots,
+                    num_slots * sizeof(struct htt_rx_paddr_tbl_entry));
+    adf_os_mem_zero(&pdev->rx_ring.paddr_tbl.stats,
+                    sizeof(pdev->rx_ring.paddr_tbl.stats));
+
+    pdev->rx_ring.paddr_tbl.mask = num_slots - 1;
+    pdev->rx_ring.paddr_tbl.shift = 32 - log2;
+    pdev->rx_ring.paddr_tbl.count = 0;
+
+    adf_os_print("rx in-order lookup: paddr table of %d slots\n", num_slots);
+    return 0;
+}
+
+static void
+htt_rx_paddr_tbl_deinit(struct htt_pdev_t *pdev)
+{
+    u_int32_t i;
+    struct htt_rx_paddr_tbl_entry *slots = pdev->rx_ring.paddr_tbl.slots;
+
+    if (!slots) {
+        return;
+    }
+
+    for (i = 0; i <= pdev->rx_ring.paddr_tbl.mask; i++) {
+        if (slots[i].netbuf) {
+            htt_rx_netbuf_unmap(pdev, slots[i].netbuf);
+            adf_nbuf_free(slots[i].netbuf);
+            slots[i].netbuf = NULL;
+        }
+    }
+    adf_os_mem_free(slots);
+    pdev->rx_ring.paddr_tbl.slots = NULL;
+    pdev->rx_ring.paddr_tbl.count = 0;
+}
+
+/* Returns 0 - success, 1 - failure */
+int
+htt_rx_paddr_tbl_insert(struct htt_pdev_t *pdev, u_int32_t paddr,
+     adf_nbuf_t netbuf)
+{
+    struct htt_rx_paddr_tbl_entry *slots = pdev->rx_ring.paddr_tbl.slots;
+    u_int32_t mask = pdev->rx_ring.paddr_tbl.mask;
+    u_int32_t i, probes = 0;
+
+    if (adf_os_unlikely(pdev->rx_ring.paddr_tbl.count >= mask)) {
+        /* always leave one empty slot to terminate probe runs */
+        HTT_ASSERT_ALWAYS(0);
+        return 1;
+    }
+
+    i = RX_PADDR_TBL_HASH(pdev, paddr);
+    while (slots[i].netbuf) {
+        i = (i + 1) & mask;
+        probes++;
+    }
+    slots[i].netbuf = netbuf;
+    slots[i].paddr = paddr;
+    pdev->rx_ring.paddr_tbl.count++;
+
+    pdev->rx_ring.paddr_tbl.stats.inserts++;
+    if (probes) {
+        pdev->rx_ring.paddr_tbl.stats.insert_collisions++;
+        pdev->rx_ring.paddr_tbl.stats.extra_probes += probes;
+        if (probes > pdev->rx_ring.paddr_tbl.stats.max_probes) {
+            pdev->rx_ring.paddr_tbl.stats.max_probes = probes;
+        }
+    }
+
+    RX_HASH_LOG(adf_os_print("rx paddr tbl: %s: paddr 0x%x netbuf %p "
+                             "slot %d probes %d\n", __FUNCTION__, paddr,
+                             netbuf, (int)i, (int)probes));
+    return 0;
+}
+
+adf_nbuf_t
+htt_rx_paddr_tbl_lookup(struct htt_pdev_t *pdev, u_int32_t paddr)
+{
+    struct htt_rx_paddr_tbl_entry *slots = pdev->rx_ring.paddr_tbl.slots;
+    u_int32_t mask = pdev->rx_ring.paddr_tbl.mask;
+    u_int32_t i, j, home, probes = 0;
+    adf_nbuf_t netbuf;
+
+    pdev->rx_ring.paddr_tbl.stats.lookups++;
+
+    i = RX_PADDR_TBL_HASH(pdev, paddr);
+    while (slots[i].netbuf && slots[i].paddr != paddr) {
+        i = (i + 1) & mask;
+        probes++;
+    }
+    if (probes) {
+        pdev->rx_ring.paddr_tbl.stats.lookup_collisions++;
+        pdev->rx_ring.paddr_tbl.stats.extra_probes += probes;
+        if (probes > pdev->rx_ring.paddr_tbl.stats.max_probes) {
+            pdev->rx_ring.paddr_tbl.stats.max_probes = probes;
+        }
+    }
+
+    netbuf = slots[i].netbuf;
+    if (adf_os_unlikely(netbuf == NULL)) {
+        pdev->rx_ring.paddr_tbl.stats.misses++;
+        adf_os_print("rx paddr tbl: %s: no entry found for 0x%x!!!\n",
+                     __FUNCTION__, paddr);
+        HTT_ASSERT_ALWAYS(0);
+        return NULL;
+    }
+    pdev->rx_ring.paddr_tbl.count--;
+
+    /*
+     * Remove slot i, then walk the rest of the probe run and move back
+     * any entry whose home slot does not lie cyclically in (i, j].
+     */
+    j = i;
+    for (;;) {
+        j = (j + 1) & mask;
+        if (!slots[j].netbuf) {
+            break;
+        }
+        home = RX_PADDR_TBL_HASH(pdev, slots[j].paddr);
+        if (i <= j ? (i < home && home <= j) : (i < home || home <= j)) {
+            continue;
+        }
+        slots[i] = slots[j];
+        i = j;
+    }
+    slots[i].netbuf = NULL;
+    slots[i].paddr = 0;
+
+    RX_HASH_LOG(adf_os_print("rx paddr tbl: %s: paddr 0x%x netbuf %p "
+                             "probes %d\n", __FUNCTION__, paddr, netbuf,
+                             (int)probes));
+    return netbuf;
+}
+
+void
+htt_rx_in_order_lookup_stats_display(htt_pdev_handle pdev)
+{
+    if (!pdev->cfg.is_full_reorder_offload) {
+        return;
+    }
+    if (pdev->cfg.rx_in_order_lookup_mode !=
+        HTT_RX_IN_ORDER_LOOKUP_PADDR_TBL) {
+        adf_os_print("  rx in-order lookup: list hash, %d buckets\n",
+                     RX_NUM_HASH_BUCKETS);
+        return;
+    }
+    adf_os_print("  rx in-order lookup: paddr table, %d of %d slots used\n",
+                 pdev->rx_ring.paddr_tbl.count,
+                 pdev->rx_ring.paddr_tbl.mask + 1);
+    adf_os_print("    inserts %u (%u collided), lookups %u (%u collided), "
+                 "misses %u\n",
+                 pdev->rx_ring.paddr_tbl.stats.inserts,
+                 pdev->rx_ring.paddr_tbl.stats.insert_collisions,
+                 pdev->rx_ring.paddr_tbl.stats.lookups,
+                 pdev->rx_ring.paddr_tbl.stats.lookup_collisions,
+                 pdev->rx_ring.paddr_tbl.stats.misses);
+    adf_os_print("    extra probes %u, longest probe run %u\n",
+                 pdev->rx_ring.paddr_tbl.stats.extra_probes,
+                 pdev->rx_ring.paddr_tbl.stats.max_probes);
+}
+
 /*--- RX In Order Hash Code --------------------------------------------------*/
 
 /* move the function to the end of file
@@ -2504,6 +2866,10 @@ htt_rx_attach(struct htt_pdev_t *pdev)
         pdev->rx_ring.alloc_idx.paddr = paddr;
         *pdev->rx_ring.alloc_idx.vaddr = 0;
 
+        if (htt_rx_page_pool_init(pdev)) {
+            goto fail4;
+        }
+
         /*
          * Initialize the Rx refill reference counter to be one so that
          * only one thread is allowed to refill the Rx ring.
@@ -2584,6 +2950,14 @@ htt_rx_attach(struct htt_pdev_t *pdev)
     }
     return 0; /* success */
 
+fail4:
+    adf_os_mem_free_consistent(
+        pdev->osdev,
+        sizeof(u_int32_t),
+        pdev->rx_ring.alloc_idx.vaddr,
+        pdev->rx_ring.alloc_idx.paddr,
+        adf_os_get_dma_mem_context((&pdev->rx_ring.alloc_idx), memctx));
+
 fail3:
     adf_os_mem_free_consistent(
         pdev->osdev,
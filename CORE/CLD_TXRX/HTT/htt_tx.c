@@ -353,13 +353,52 @@ htt_tx_send_std(
 
 }
 
+/* max number of frames handed to HTC (and rung to the target) at once */
+#define HTT_TX_SEND_BATCH_MAX 16
+
 adf_nbuf_t
 htt_tx_send_batch(htt_pdev_handle pdev, adf_nbuf_t head_msdu, int num_msdus)
 {
-    adf_os_print("*** %s curently only applies for HL systems\n", __func__);
-    adf_os_assert(0);
-    return head_msdu;
+    adf_nbuf_t msdus[HTT_TX_SEND_BATCH_MAX];
+    unsigned int download_lens[HTT_TX_SEND_BATCH_MAX];
+    adf_nbuf_t msdu = head_msdu;
+
+    while (num_msdus > 0) {
+        int i, num_batch, num_sent;
+
+        if (adf_nbuf_queue_len(&pdev->txnbufq) > 0) {
+            /* stay in order behind the frames waiting for HTC resources */
+            while (num_msdus--) {
+                adf_nbuf_t next = adf_nbuf_next(msdu);
+                HTT_TX_NBUF_QUEUE_ADD(pdev, msdu);
+                msdu = next;
+            }
+            htt_tx_sched(pdev);
+            break;
+        }
+
+        num_batch = adf_os_min(num_msdus, HTT_TX_SEND_BATCH_MAX);
+        for (i = 0; i < num_batch; i++) {
+            /* packet length includes HTT tx desc frag */
+            download_lens[i] = adf_os_min(
+                (unsigned int) adf_nbuf_len(msdu),
+                (unsigned int) pdev->download_len);
+            msdus[i] = msdu;
+            adf_nbuf_trace_update(msdu, "HT:T:");
+            msdu = adf_nbuf_next(msdu);
+        }
+        num_msdus -= num_batch;
+
+        num_sent = HTCSendDataPktBatch(
+            pdev->htc_pdev, msdus, download_lens, num_batch,
+            pdev->htc_endpoint);
+        for (i = num_sent; i < num_batch; i++) {
+            HTT_TX_NBUF_QUEUE_ADD(pdev, msdus[i]);
+        }
+    }
 
+    /* frames HTC could not take are retried from txnbufq, not rejected */
+    return NULL;
 }
 
 int
@@ -149,6 +149,20 @@ struct htt_rx_hash_bucket {
 #endif
 };
 
+enum htt_rx_in_order_lookup_mode {
+    HTT_RX_IN_ORDER_LOOKUP_HASH_LIST = 0, /* bucketed linked-list hash */
+    HTT_RX_IN_ORDER_LOOKUP_PADDR_TBL = 1, /* open-addressed paddr table */
+};
+
+/*
+ * Slot of the open-addressed paddr -> netbuf table.
+ * A NULL netbuf marks an empty slot.
+ */
+struct htt_rx_paddr_tbl_entry {
+    adf_nbuf_t  netbuf;
+    A_UINT32    paddr;
+};
+
 #ifdef IPA_UC_OFFLOAD
 
 /* IPA micro controller
@@ -214,6 +228,7 @@ struct htt_pdev_t {
     struct {
         int is_high_latency;
         int is_full_reorder_offload;
+        int rx_in_order_lookup_mode; /* enum htt_rx_in_order_lookup_mode */
         int default_tx_comp_req;
     } cfg;
     struct {
@@ -312,6 +327,45 @@ struct htt_pdev_t {
 #endif
         struct htt_rx_hash_bucket * hash_table;
         u_int32_t listnode_offset;
+
+        /*
+         * paddr_tbl - linear-probing table used instead of hash_table
+         * when HTT_RX_IN_ORDER_LOOKUP_PADDR_TBL is selected at attach.
+         * Sized to at least twice the rx ring, so it never fills and
+         * probe sequences stay short.
+         */
+        struct {
+            struct htt_rx_paddr_tbl_entry *slots;
+            u_int32_t mask;
+            u_int32_t shift;
+            u_int32_t count;
+            struct {
+                u_int32_t inserts;
+                u_int32_t lookups;
+                u_int32_t insert_collisions;
+                u_int32_t lookup_collisions;
+                u_int32_t extra_probes;
+                u_int32_t max_probes;
+                u_int32_t misses;
+            } stats;
+        } paddr_tbl;
+#ifdef HTT_RX_BUF_RECYCLE
+        /*
+         * page_pool - DMA mapped pages the rx ring buffers are built on,
+         * twice the ring size. Only the ring refill uses it.
+         */
+        struct {
+            adf_nbuf_rx_page_t *pages;
+            int size;
+            int next;
+            struct {
+                u_int32_t reused;
+                u_int32_t allocated;
+                u_int32_t released;
+                u_int32_t stalled;
+            } stats;
+        } page_pool;
+#endif
     } rx_ring;
     int rx_desc_size_hl;
     long rx_fw_desc_offset;
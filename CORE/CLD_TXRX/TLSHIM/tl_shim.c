@@ -996,9 +996,13 @@ static void tlshim_data_rx_handler(void *context, u_int16_t staid,
 			} else {
 				pVosSchedContext sched_ctx =
 						get_vos_sched_ctxt();
+				struct ol_txrx_pdev_t *pdev = vos_get_context(
+					VOS_MODULE_ID_TXRX,
+					vos_get_global_context(VOS_MODULE_ID_TL,
+							       context));
 				struct VosTlshimPkt *pkt;
 
-				if (unlikely(!sched_ctx))
+				if (unlikely(!sched_ctx || !pdev))
 					goto drop_rx_buf;
 
 				pkt = vos_alloc_tlshim_pkt(sched_ctx);
@@ -1011,7 +1015,14 @@ static void tlshim_data_rx_handler(void *context, u_int16_t staid,
 				pkt->context = (void *) tl_shim;
 				pkt->Rxpkt = (void *) rx_buf_list;
 				pkt->staId = staid;
-				vos_indicate_rxpkt(sched_ctx, pkt);
+				/*
+				 * Only 802.3 frames can be steered by flow
+				 * hash; anything else stays on one thread.
+				 */
+				if (pdev->frame_format == wlan_frm_fmt_802_3)
+					vos_indicate_rx_data(sched_ctx, pkt);
+				else
+					vos_indicate_rxpkt(sched_ctx, pkt);
 			}
 #else /* QCA_CONFIG_SMP */
 			tlshim_data_rx_cb(tl_shim, rx_buf_list, staid);
@@ -1129,7 +1140,7 @@ adf_nbuf_t WLANTL_SendSTA_DataFrame(void *vos_ctx, u_int8_t sta_id,
 							   vos_ctx);
 	void *adf_ctx = vos_get_context(VOS_MODULE_ID_ADF, vos_ctx);
 	adf_nbuf_t ret;
-	struct ol_txrx_peer_t *peer;
+	struct ol_txrx_vdev_t *vdev;
 
 	ENTER();
 	if (!tl_shim) {
@@ -1154,19 +1165,21 @@ adf_nbuf_t WLANTL_SendSTA_DataFrame(void *vos_ctx, u_int8_t sta_id,
 		return skb;
 	}
 
-	if (!tl_shim->sta_info[sta_id].registered) {
+	/*
+	 * Use the vdev cached at registration rather than looking the peer
+	 * up by local id, which would take the pdev-wide local peer id lock
+	 * for every transmitted frame. It is only set while the station is
+	 * registered, and WLANTL_ClearSTAClient waits for this RCU section
+	 * to end after clearing it, so the vdev stays valid for the send.
+	 */
+	adf_os_rcu_read_lock();
+	vdev = adf_os_rcu_dereference(tl_shim->sta_info[sta_id].vdev);
+	if (!vdev) {
+		adf_os_rcu_read_unlock();
 		TLSHIM_LOGW("Staion is not yet registered for data service");
 		return skb;
 	}
 
-	peer = ol_txrx_peer_find_by_local_id(
-			((pVosContextType) vos_ctx)->pdev_txrx_ctx,
-			sta_id);
-	if (!peer) {
-		TLSHIM_LOGW("Invalid peer");
-		return skb;
-	}
-
 	/* Zero out skb's context buffer for the driver to use */
 	adf_os_mem_set(skb->cb, 0, sizeof(skb->cb));
 	adf_nbuf_map_single(adf_ctx, skb, ADF_OS_DMA_TO_DEVICE);
@@ -1181,7 +1194,8 @@ adf_nbuf_t WLANTL_SendSTA_DataFrame(void *vos_ctx, u_int8_t sta_id,
 
 	/* Terminate the (single-element) list of tx frames */
 	skb->next = NULL;
-	ret = tl_shim->tx(peer->vdev, skb);
+	ret = tl_shim->tx(vdev, skb);
+	adf_os_rcu_read_unlock();
 	if (ret) {
 		TLSHIM_LOGW("Failed to tx");
 		adf_nbuf_unmap_single(adf_ctx, ret, ADF_OS_DMA_TO_DEVICE);
@@ -1703,8 +1717,12 @@ VOS_STATUS WLANTL_ClearSTAClient(void *vos_ctx, u_int8_t sta_id)
 	tl_shim->sta_info[sta_id].registered = 0;
 	tl_shim->sta_info[sta_id].data_rx = NULL;
 	tl_shim->sta_info[sta_id].first_rssi = 0;
+	adf_os_rcu_assign_pointer(tl_shim->sta_info[sta_id].vdev, NULL);
 	adf_os_spin_unlock_bh(&tl_shim->sta_info[sta_id].stainfo_lock);
 
+	/* Let a data tx still using the cached vdev finish */
+	adf_os_rcu_synchronize();
+
 	return VOS_STATUS_SUCCESS;
 }
 
@@ -1749,6 +1767,7 @@ VOS_STATUS WLANTL_RegisterSTAClient(void *vos_ctx,
 	sta_info->registered = true;
 	sta_info->first_rssi = rssi;
 	sta_info->vdev_id = peer->vdev->vdev_id;
+	adf_os_rcu_assign_pointer(sta_info->vdev, peer->vdev);
 	adf_os_spin_unlock_bh(&sta_info->stainfo_lock);
 
 	param.qos_capable =  sta_desc->ucQosEnabled;
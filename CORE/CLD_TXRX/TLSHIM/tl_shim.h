@@ -58,6 +58,12 @@ struct tlshim_sta_info {
 	unsigned long flags;
 	v_S7_t first_rssi;
 	v_U8_t vdev_id;
+	/*
+	 * vdev the peer belongs to, cached at registration so the data tx
+	 * path can hand frames straight to txrx without a peer lookup;
+	 * set while registered, read by the tx path under RCU
+	 */
+	struct ol_txrx_vdev_t *vdev;
 };
 
 #ifdef QCA_LL_TX_FLOW_CT
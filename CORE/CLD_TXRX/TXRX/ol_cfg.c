@@ -80,6 +80,7 @@ ol_pdev_handle ol_pdev_cfg_attach(adf_os_device_t osdev,
 	cfg_ctx->rx_fwd_disabled = 0;
 	cfg_ctx->is_packet_log_enabled = 0;
 	cfg_ctx->is_full_reorder_offload = cfg_param.is_full_reorder_offload;
+	cfg_ctx->rx_in_order_lookup_mode = cfg_param.rx_in_order_lookup_mode;
 #ifdef IPA_UC_OFFLOAD
 	cfg_ctx->ipa_uc_rsc.uc_offload_enabled = cfg_param.is_uc_offload_enabled;
 	cfg_ctx->ipa_uc_rsc.tx_max_buf_cnt = cfg_param.uc_tx_buffer_count;
@@ -221,6 +222,12 @@ int ol_cfg_is_full_reorder_offload(ol_pdev_handle pdev)
 	return cfg->is_full_reorder_offload;
 }
 
+int ol_cfg_rx_in_order_lookup_mode(ol_pdev_handle pdev)
+{
+	struct txrx_pdev_cfg_t *cfg = (struct txrx_pdev_cfg_t *)pdev;
+	return cfg->rx_in_order_lookup_mode;
+}
+
 #ifdef IPA_UC_OFFLOAD
 unsigned int ol_cfg_ipa_uc_offload_enabled(ol_pdev_handle pdev)
 {
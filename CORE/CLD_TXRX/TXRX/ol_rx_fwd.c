@@ -39,6 +39,28 @@
 #include <ol_rx_fwd.h>        /* our own defs */
 #include <ol_rx.h>            /* ol_rx_deliver */
 #include <ol_txrx_internal.h> /* TXRX_ASSERT1 */
+#include <ol_tx_classify.h>   /* ol_tx_dest_addr_find */
+
+/*
+ * Forwarded frames are not handed to the tx path one at a time.
+ * Instead, the frames forwarded from one rx batch are collected, grouped
+ * by destination, and sent with a single vdev->tx call.  This gives one
+ * tx scheduler run (HL) or one download batch (LL) per rx batch, and
+ * keeps frames for the same peer back to back, so the HL tx
+ * classification's peer lookups hit the vdev's last-hit peer cache.
+ * Frames for destinations beyond the first OL_RX_FWD_MAX_DESTS share the
+ * last group.
+ */
+#define OL_RX_FWD_MAX_DESTS 4
+
+struct ol_rx_fwd_batch_t {
+    int num_dests;
+    struct {
+        u_int8_t *dest_addr;
+        adf_nbuf_t head;
+        adf_nbuf_t tail;
+    } dests[OL_RX_FWD_MAX_DESTS];
+};
 
 /*
  * Porting from Ap11PrepareForwardedPacket.
@@ -116,9 +138,14 @@ ol_ap_fwd_check(struct ol_txrx_vdev_t *vdev, adf_nbuf_t msdu)
 
 static inline
 void
-ol_rx_fwd_to_tx(struct ol_txrx_vdev_t *vdev, adf_nbuf_t msdu)
+ol_rx_fwd_to_tx(
+    struct ol_txrx_vdev_t *vdev,
+    struct ol_rx_fwd_batch_t *batch,
+    adf_nbuf_t msdu)
 {
     struct ol_txrx_pdev_t *pdev = vdev->pdev;
+    u_int8_t *dest_addr;
+    int i;
 
     if (pdev->frame_format == wlan_frm_fmt_native_wifi)
     {
@@ -142,19 +169,94 @@ ol_rx_fwd_to_tx(struct ol_txrx_vdev_t *vdev, adf_nbuf_t msdu)
                     rx_desc));
     }
 
-    msdu = vdev->tx(vdev, msdu);
+    dest_addr = ol_tx_dest_addr_find(pdev, msdu);
+    if (IEEE80211_IS_MULTICAST(dest_addr)) {
+        vdev->fwd_stats.mcast++;
+    } else {
+        vdev->fwd_stats.ucast++;
+    }
+
+    /* add the frame to its destination's group */
+    for (i = 0; i < batch->num_dests; i++) {
+        if (adf_os_mem_cmp(
+                batch->dests[i].dest_addr, dest_addr,
+                IEEE80211_ADDR_LEN) == 0)
+        {
+            break;
+        }
+    }
+    if (i == batch->num_dests) {
+        if (batch->num_dests < OL_RX_FWD_MAX_DESTS) {
+            batch->num_dests++;
+            batch->dests[i].dest_addr = dest_addr;
+            batch->dests[i].head = NULL;
+        } else {
+            i = OL_RX_FWD_MAX_DESTS - 1;
+        }
+    }
+    OL_TXRX_LIST_APPEND(batch->dests[i].head, batch->dests[i].tail, msdu);
+}
+
+static void
+ol_rx_fwd_flush(struct ol_txrx_vdev_t *vdev, struct ol_rx_fwd_batch_t *batch)
+{
+    struct ol_txrx_pdev_t *pdev = vdev->pdev;
+    adf_nbuf_t head = NULL, tail = NULL;
+    adf_nbuf_t msdu;
+    int i;
 
-    if (msdu) {
+    if (batch->num_dests == 0) {
+        return;
+    }
+    /* chain the destination groups into a single tx list */
+    for (i = 0; i < batch->num_dests; i++) {
+        if (tail) {
+            adf_nbuf_set_next(tail, batch->dests[i].head);
+        } else {
+            head = batch->dests[i].head;
+        }
+        tail = batch->dests[i].tail;
+    }
+    adf_nbuf_set_next(tail, NULL); /* add NULL terminator */
+    batch->num_dests = 0;
+    vdev->fwd_stats.batches++;
+
+    msdu = vdev->tx(vdev, head);
+
+    while (msdu) {
+        adf_nbuf_t next = adf_nbuf_next(msdu);
         /*
          * The frame was not accepted by the tx.
          * We could store the frame and try again later,
          * but the simplest solution is to discard the frames.
          */
+        vdev->fwd_stats.dropped++;
         adf_nbuf_unmap_single(pdev->osdev, msdu, ADF_OS_DMA_TO_DEVICE);
         adf_nbuf_free(msdu);
+        msdu = next;
     }
 }
 
+/*
+ * A frame that is both forwarded and delivered to the OS normally has to
+ * be copied, since the tx path may rewrite it.
+ * LL 802.3 frames go to the target unmodified, and the OS stack doesn't
+ * write to a cloned buffer without un-sharing it first, so for those a
+ * clone that shares the rx buffer is enough.
+ */
+static inline adf_nbuf_t
+ol_rx_fwd_dup(struct ol_txrx_pdev_t *pdev, adf_nbuf_t msdu)
+{
+#ifndef QCA_SUPPORT_SW_TXRX_ENCAP
+    if (!pdev->cfg.is_high_latency &&
+        pdev->frame_format == wlan_frm_fmt_802_3)
+    {
+        return adf_nbuf_clone(msdu);
+    }
+#endif
+    return adf_nbuf_copy(msdu);
+}
+
 void
 ol_rx_fwd_check(
     struct ol_txrx_vdev_t *vdev,
@@ -166,7 +268,9 @@ ol_rx_fwd_check(
     adf_nbuf_t deliver_list_head = NULL;
     adf_nbuf_t deliver_list_tail = NULL;
     adf_nbuf_t msdu;
+    struct ol_rx_fwd_batch_t fwd_batch;
 
+    fwd_batch.num_dests = 0;
     msdu = msdu_list;
     while (msdu) {
         struct ol_txrx_vdev_t *tx_vdev;
@@ -215,13 +319,15 @@ ol_rx_fwd_check(
              */
             if (htt_rx_msdu_discard(pdev->htt_pdev, rx_desc)) {
                 htt_rx_msdu_desc_free(pdev->htt_pdev, msdu);
-                ol_rx_fwd_to_tx(tx_vdev, msdu);
+                ol_rx_fwd_to_tx(tx_vdev, &fwd_batch, msdu);
                 msdu = NULL; /* already handled this MSDU */
             } else {
 				adf_nbuf_t copy;
-				copy = adf_nbuf_copy(msdu);
+				copy = ol_rx_fwd_dup(pdev, msdu);
                 if (copy) {
-					ol_rx_fwd_to_tx(tx_vdev, copy);
+					ol_rx_fwd_to_tx(tx_vdev, &fwd_batch, copy);
+                } else {
+                    tx_vdev->fwd_stats.dropped++;
                 }
             }
         }
@@ -231,6 +337,8 @@ ol_rx_fwd_check(
         }
         msdu = msdu_list;
     }
+    /* all forwarded frames use the rx vdev for tx (see above) */
+    ol_rx_fwd_flush(vdev, &fwd_batch);
     if (deliver_list_head) {
         adf_nbuf_set_next(deliver_list_tail, NULL); /* add NULL terminator */
         if (ol_cfg_is_full_reorder_offload(pdev->ctrl_pdev)) {
@@ -240,3 +348,20 @@ ol_rx_fwd_check(
         }
     }
 }
+
+void
+ol_rx_fwd_stats_display(struct ol_txrx_pdev_t *pdev)
+{
+    struct ol_txrx_vdev_t *vdev;
+
+    TAILQ_FOREACH(vdev, &pdev->vdev_list, vdev_list_elem) {
+        if (vdev->fwd_stats.batches == 0 && vdev->fwd_stats.dropped == 0) {
+            continue;
+        }
+        VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_INFO,
+            "    vdev %d intra-BSS fwd: %u ucast, %u mcast, "
+            "%u tx batches, %u dropped\n",
+            vdev->vdev_id, vdev->fwd_stats.ucast, vdev->fwd_stats.mcast,
+            vdev->fwd_stats.batches, vdev->fwd_stats.dropped);
+    }
+}
@@ -80,5 +80,13 @@ ol_rx_fwd_check(
     unsigned tid,
     adf_nbuf_t msdu_list);
 
+/**
+ * @brief Show the per-vdev intra-BSS forwarding counters.
+ *
+ * @param pdev - the physical device whose vdevs' counters are shown
+ */
+void
+ol_rx_fwd_stats_display(struct ol_txrx_pdev_t *pdev);
+
 
 #endif /* _OL_RX_FWD_H_ */
@@ -29,6 +29,7 @@
 /* generic utilities */
 #include <adf_nbuf.h>          /* adf_nbuf_t, etc. */
 #include <adf_os_mem.h>        /* adf_os_mem_alloc */
+#include <adf_os_util.h>       /* adf_os_ffs64, adf_os_hweight64 */
 
 #include <ieee80211.h>         /* IEEE80211_SEQ_MAX */
 
@@ -93,6 +94,76 @@ static char g_log2ceil[] = {
         } \
     } while (0)
 
+/*---*/
+
+#if defined(QCA_SUPPORT_RX_REORDER_BITMAP)
+/*
+ * The reorder array never has more than 64 slots (see ol_rx_addba_handler),
+ * so its occupancy fits in a single 64-bit word.  Hole and span searches
+ * work on a copy of that word rotated so that bit 0 is the search's start
+ * index, which keeps the circular slot order and turns each search into a
+ * find-first-set rather than a walk over the array.
+ */
+#define OL_RX_REORDER_BITMAP_WIN_MASK(win_sz_mask) \
+    ((win_sz_mask) >= 63 ? ~(u_int64_t)0 : \
+     ((u_int64_t)1 << ((win_sz_mask) + 1)) - 1)
+
+static inline u_int64_t
+ol_rx_reorder_bitmap_rotate(
+    u_int64_t bitmap,
+    unsigned shift,
+    unsigned win_sz_mask)
+{
+    if (shift == 0) {
+        return bitmap;
+    }
+    /* rotate right by shift within the win_sz_mask + 1 bit window */
+    return ((bitmap >> shift) | (bitmap << (win_sz_mask + 1 - shift))) &
+        OL_RX_REORDER_BITMAP_WIN_MASK(win_sz_mask);
+}
+
+/*
+ * Bits for slots idx_start through idx_end - 1, or for the whole array
+ * if idx_end == idx_start - the same span ol_rx_reorder_flush covers.
+ */
+static inline u_int64_t
+ol_rx_reorder_bitmap_span(
+    unsigned idx_start,
+    unsigned idx_end,
+    unsigned win_sz_mask)
+{
+    unsigned num_slots;
+    u_int64_t span;
+
+    num_slots = ((idx_end - idx_start - 1) & win_sz_mask) + 1;
+    span = num_slots >= 64 ? ~(u_int64_t)0 : ((u_int64_t)1 << num_slots) - 1;
+    /* rotate left by idx_start, i.e. right by the complement */
+    return ol_rx_reorder_bitmap_rotate(
+        span, (win_sz_mask + 1 - idx_start) & win_sz_mask, win_sz_mask);
+}
+
+static inline void
+ol_rx_reorder_bitmap_store(
+    struct ol_txrx_pdev_t *pdev,
+    struct ol_rx_reorder_t *rx_reorder,
+    unsigned idx)
+{
+    rx_reorder->bitmap |= (u_int64_t)1 << idx;
+    TXRX_STATS_RX_REORDER_DEPTH(pdev, adf_os_hweight64(rx_reorder->bitmap));
+}
+
+#define OL_RX_REORDER_BITMAP_STORE(pdev, rx_reorder, idx) \
+    ol_rx_reorder_bitmap_store(pdev, rx_reorder, idx)
+#define OL_RX_REORDER_BITMAP_CLEAR(rx_reorder, idx_start, idx_end) \
+    (rx_reorder)->bitmap &= ~ol_rx_reorder_bitmap_span( \
+        idx_start, idx_end, (rx_reorder)->win_sz_mask)
+#define OL_RX_REORDER_BITMAP_RESET(rx_reorder) (rx_reorder)->bitmap = 0
+#else
+#define OL_RX_REORDER_BITMAP_STORE(pdev, rx_reorder, idx) /* no-op */
+#define OL_RX_REORDER_BITMAP_CLEAR(rx_reorder, idx_start, idx_end) /* no-op */
+#define OL_RX_REORDER_BITMAP_RESET(rx_reorder) /* no-op */
+#endif /* QCA_SUPPORT_RX_REORDER_BITMAP */
+
 
 /* functions called by txrx components */
 
@@ -102,6 +173,7 @@ void ol_rx_reorder_init(struct ol_rx_reorder_t *rx_reorder, u_int8_t tid)
     rx_reorder->win_sz_mask = 0;
     rx_reorder->array = &rx_reorder->base;
     rx_reorder->base.head = rx_reorder->base.tail = NULL;
+    OL_RX_REORDER_BITMAP_RESET(rx_reorder);
     rx_reorder->tid = tid;
     rx_reorder->defrag_timeout_ms = 0;
 
@@ -195,6 +267,7 @@ ol_rx_reorder_store(
     } else {
         rx_reorder_array_elem->head = head_msdu;
 	OL_RX_REORDER_MPDU_CNT_INCR(&peer->tids_rx_reorder[tid], 1);
+        OL_RX_REORDER_BITMAP_STORE(pdev, &peer->tids_rx_reorder[tid], idx);
     }
     rx_reorder_array_elem->tail = tail_msdu;
 }
@@ -231,6 +304,30 @@ ol_rx_reorder_release(
     if(dumpEnable == 1)
         VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_ERROR,
             "%s %d: start_idx %d end_idx %d", __func__, __LINE__, idx_start, idx_end);
+#if defined(QCA_SUPPORT_RX_REORDER_BITMAP)
+    {
+        struct ol_rx_reorder_t *rx_reorder = &peer->tids_rx_reorder[tid];
+        u_int64_t occupied;
+
+        /* only visit the occupied slots that follow idx_start */
+        rx_reorder->bitmap &= ~((u_int64_t)1 << idx_start);
+        occupied = rx_reorder->bitmap &
+            ol_rx_reorder_bitmap_span(idx_start, idx_end, win_sz_mask);
+        rx_reorder->bitmap &= ~occupied;
+        occupied = ol_rx_reorder_bitmap_rotate(
+            occupied, idx_start, win_sz_mask);
+        while (occupied) {
+            idx = (idx_start + adf_os_ffs64(occupied)) & win_sz_mask;
+            occupied &= occupied - 1;
+            rx_reorder_array_elem = &rx_reorder->array[idx];
+            OL_RX_REORDER_MPDU_CNT_DECR(rx_reorder, 1);
+            OL_RX_REORDER_LIST_APPEND(
+                head_msdu, tail_msdu, rx_reorder_array_elem);
+            tail_msdu = rx_reorder_array_elem->tail;
+            rx_reorder_array_elem->head = rx_reorder_array_elem->tail = NULL;
+        }
+    }
+#else
     idx = (idx_start + 1);
     OL_RX_REORDER_IDX_WRAP(idx, win_sz, win_sz_mask);
     while (idx != idx_end) {
@@ -245,6 +342,7 @@ ol_rx_reorder_release(
         idx++;
         OL_RX_REORDER_IDX_WRAP(idx, win_sz, win_sz_mask);
     }
+#endif /* QCA_SUPPORT_RX_REORDER_BITMAP */
     OL_RX_REORDER_PTR_CHECK(head_msdu) {
         u_int16_t seq_num;
         htt_pdev_handle htt_pdev = vdev->pdev->htt_pdev;
@@ -319,6 +417,11 @@ ol_rx_reorder_flush(
     if(dumpEnable == 1)
         VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_ERROR,
             "%s %d: start_idx %d end_idx %d", __func__, __LINE__, idx_start, idx_end);
+    /*
+     * Flushes are rare (BAR, DELBA, timeout) and may also have to pick up
+     * fragments, which are not tracked in the bitmap, so walk every slot.
+     */
+    OL_RX_REORDER_BITMAP_CLEAR(&peer->tids_rx_reorder[tid], idx_start, idx_end);
     do {
         rx_reorder_array_elem =
             &peer->tids_rx_reorder[tid].array[idx_start];
@@ -387,6 +490,27 @@ ol_rx_reorder_first_hole(
     win_sz_mask = peer->tids_rx_reorder[tid].win_sz_mask;
 
     OL_RX_REORDER_IDX_START_SELF_SELECT(peer, tid, &idx_start);
+#if defined(QCA_SUPPORT_RX_REORDER_BITMAP)
+    {
+        u_int64_t occupied, holes;
+        unsigned pos;
+
+        occupied = ol_rx_reorder_bitmap_rotate(
+            peer->tids_rx_reorder[tid].bitmap, idx_start, win_sz_mask);
+        /* bypass the initial hole */
+        occupied &= ~(u_int64_t)1;
+        if (!occupied) {
+            pos = win_sz_mask + 1;
+        } else {
+            pos = adf_os_ffs64(occupied);
+            /* bypass the present frames following the initial hole */
+            holes = ~occupied & OL_RX_REORDER_BITMAP_WIN_MASK(win_sz_mask) &
+                ~(((u_int64_t)1 << pos) - 1);
+            pos = holes ? adf_os_ffs64(holes) : win_sz_mask + 1;
+        }
+        tmp_idx = (idx_start + pos) & win_sz_mask;
+    }
+#else
     tmp_idx++;
     OL_RX_REORDER_IDX_WRAP(tmp_idx, win_sz, win_sz_mask);
     /* bypass the initial hole */
@@ -403,6 +527,7 @@ ol_rx_reorder_first_hole(
         tmp_idx++;
         OL_RX_REORDER_IDX_WRAP(tmp_idx, win_sz, win_sz_mask);
     }
+#endif /* QCA_SUPPORT_RX_REORDER_BITMAP */
     /*
      * idx_end is exclusive rather than inclusive.
      * In other words, it is the index of the first slot of the second
@@ -466,6 +591,7 @@ ol_rx_addba_handler(
 
     rx_reorder->win_sz_mask = round_pwr2_win_sz - 1;
     rx_reorder->num_mpdus = 0;
+    OL_RX_REORDER_BITMAP_RESET(rx_reorder);
 
     peer->tids_next_rel_idx[tid] = OL_RX_REORDER_IDX_INIT(
         start_seq_num, rx_reorder->win_sz, rx_reorder->win_sz_mask);
@@ -671,6 +797,8 @@ ol_rx_pn_ind_handler(
         }
         seq_num = (seq_num + 1) & win_sz_mask;
     } while (seq_num != seq_num_end);
+    OL_RX_REORDER_BITMAP_CLEAR(
+        &peer->tids_rx_reorder[tid], seq_num_start, seq_num_end);
 
     if (head_msdu) {
         /* rx_opt_proc takes a NULL-terminated list of msdu netbufs */
@@ -29,6 +29,7 @@
 #define _OL_RX_REORDER__H_
 
 #include <adf_nbuf.h>        /* adf_nbuf_t, etc. */
+#include <adf_os_util.h>     /* adf_os_hweight64 */
 
 #include <ol_txrx_api.h>     /* ol_txrx_peer_t, etc. */
 
@@ -89,6 +90,14 @@ ol_rx_reorder_seq_num_check(
     unsigned tid,
     unsigned seq_num);
 
+/* number of MPDUs currently held in the peer-TID's reorder array */
+#if defined(QCA_SUPPORT_RX_REORDER_BITMAP)
+#define OL_RX_REORDER_MPDUS_HELD(peer, tid) \
+    adf_os_hweight64((peer)->tids_rx_reorder[tid].bitmap)
+#else
+#define OL_RX_REORDER_MPDUS_HELD(peer, tid) 0 /* not tracked */
+#endif
+
 
 /*
  * Peregrine and Rome: do sequence number checking in the host
@@ -146,6 +146,7 @@ ol_rx_reorder_timeout(void *arg)
         reorder_timeout_list_elem, tmp)
     {
         unsigned idx_start, idx_end;
+        unsigned mpdus_held;
         struct ol_txrx_peer_t *peer;
 
         if (list_elem->timestamp_ms > time_now_ms) {
@@ -162,6 +163,7 @@ ol_rx_reorder_timeout(void *arg)
 
         idx_start = 0xffff; /* start from next_rel_idx */
         ol_rx_reorder_first_hole(peer, list_elem->tid, &idx_end);
+        mpdus_held = OL_RX_REORDER_MPDUS_HELD(peer, list_elem->tid);
         ol_rx_reorder_flush(
             peer->vdev,
             peer,
@@ -169,6 +171,9 @@ ol_rx_reorder_timeout(void *arg)
             idx_start,
             idx_end,
             htt_rx_flush_release);
+        TXRX_STATS_INCR(pdev, priv.rx.reorder.timeout_flushes);
+        TXRX_STATS_ADD(pdev, priv.rx.reorder.timeout_flush_mpdus,
+            mpdus_held - OL_RX_REORDER_MPDUS_HELD(peer, list_elem->tid));
     }
     /* restart the timer if unexpired elements are left in the list */
     if (!TAILQ_EMPTY(&rx_reorder_timeout_ac->virtual_timer_list)) {
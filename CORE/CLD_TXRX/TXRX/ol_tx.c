@@ -29,6 +29,8 @@
 #include <adf_nbuf.h>         /* adf_nbuf_t, etc. */
 #include <adf_os_atomic.h>    /* adf_os_atomic_read, etc. */
 #include <adf_os_util.h>      /* adf_os_unlikely */
+#include <adf_os_time.h>      /* adf_os_ticks, etc. */
+#include <adf_os_mem.h>       /* adf_os_mem_zero */
 
 /* APIs for other modules */
 #include <htt.h>              /* HTT_TX_EXT_TID_MGMT */
@@ -41,6 +43,7 @@
 #include <ol_txrx_types.h>    /* pdev stats */
 #include <ol_tx_desc.h>       /* ol_tx_desc */
 #include <ol_tx_send.h>       /* ol_tx_send */
+#include <ol_tx.h>            /* OL_TX_BQL_AVAIL, etc. */
 #include <ol_txrx.h>
 
 /* internal header files relevant only for HL systems */
@@ -71,14 +74,77 @@
         }                                                                     \
     } while (0)
 
+#ifdef QCA_LL_TX_BATCH_DOWNLOAD
+/* max number of frames accumulated before they are handed to HTT */
+#define OL_TX_LL_BATCH_MAX 32
+
+/* frames prepared by ol_tx_ll, waiting to be downloaded together */
+struct ol_tx_ll_batch {
+    adf_nbuf_t head;
+    adf_nbuf_t tail;
+    int num_msdus;
+};
+
+static inline void
+ol_tx_ll_batch_flush(struct ol_txrx_pdev_t *pdev, struct ol_tx_ll_batch *batch)
+{
+    if (!batch->head) {
+        return;
+    }
+    adf_nbuf_set_next(batch->tail, NULL);
+    ol_tx_send_batch(pdev, batch->head, batch->num_msdus);
+    batch->head = batch->tail = NULL;
+    batch->num_msdus = 0;
+}
+
+/*
+ * Rather than downloading each frame as soon as its tx descriptor is
+ * filled in, collect the frames into a batch, so the lower layers can
+ * queue them all to the copy engine and notify the target only once
+ * per batch.
+ */
+static inline void
+ol_tx_ll_batch_add(
+    struct ol_txrx_pdev_t *pdev,
+    struct ol_tx_ll_batch *batch,
+    struct ol_tx_desc_t *tx_desc,
+    adf_nbuf_t msdu)
+{
+    ol_tx_send_batch_prep(pdev, tx_desc, msdu);
+    if (batch->tail) {
+        adf_nbuf_set_next(batch->tail, msdu);
+    } else {
+        batch->head = msdu;
+    }
+    batch->tail = msdu;
+    if (++batch->num_msdus == OL_TX_LL_BATCH_MAX) {
+        ol_tx_ll_batch_flush(pdev, batch);
+    }
+}
+
+#define OL_TX_LL_DOWNLOAD(pdev, batch, tx_desc, msdu) \
+    ol_tx_ll_batch_add(pdev, &(batch), tx_desc, msdu)
+#define OL_TX_LL_DOWNLOAD_FLUSH(pdev, batch) \
+    ol_tx_ll_batch_flush(pdev, &(batch))
+#else
+#define OL_TX_LL_DOWNLOAD(pdev, batch, tx_desc, msdu) \
+    ol_tx_send(pdev, tx_desc, msdu)
+#define OL_TX_LL_DOWNLOAD_FLUSH(pdev, batch) /* no-op */
+#endif /* QCA_LL_TX_BATCH_DOWNLOAD */
+
 adf_nbuf_t
 ol_tx_ll(ol_txrx_vdev_handle vdev, adf_nbuf_t msdu_list)
 {
+    struct ol_txrx_pdev_t *pdev = vdev->pdev;
     adf_nbuf_t msdu = msdu_list;
     struct ol_txrx_msdu_info_t msdu_info;
+#ifdef QCA_LL_TX_BATCH_DOWNLOAD
+    struct ol_tx_ll_batch batch = { NULL, NULL, 0 };
+#endif
 
-    msdu_info.htt.info.l2_hdr_type = vdev->pdev->htt_pkt_type;
+    msdu_info.htt.info.l2_hdr_type = pdev->htt_pkt_type;
     msdu_info.htt.action.tx_comp_req = 0;
+    msdu_info.htt.info.frame_type = pdev->htt_pkt_type;
     /*
      * The msdu_list variable could be used instead of the msdu var,
      * but just to clarify which operations are done on a single MSDU
@@ -91,7 +157,18 @@ ol_tx_ll(ol_txrx_vdev_handle vdev, adf_nbuf_t msdu_list)
 
         msdu_info.htt.info.ext_tid = adf_nbuf_get_tid(msdu);
         msdu_info.peer = NULL;
-        ol_tx_prepare_ll(tx_desc, vdev, msdu, &msdu_info);
+        /*
+         * For LL, the TXRX descriptor pool is sized to match the target's
+         * descriptor pool, so a successful allocation guarantees that the
+         * target has room to accept the new tx frame.
+         * On failure stop here, so the frames already batched are still
+         * downloaded, and return the list of unaccepted MSDUs.
+         */
+        tx_desc = ol_tx_desc_ll(pdev, vdev, msdu, &msdu_info);
+        if (adf_os_unlikely(! tx_desc)) {
+            TXRX_STATS_MSDU_LIST_INCR(pdev, tx.dropped.host_reject, msdu);
+            break;
+        }
 
         /*
          * If debug display is enabled, show the meta-data being
@@ -100,14 +177,14 @@ ol_tx_ll(ol_txrx_vdev_handle vdev, adf_nbuf_t msdu_list)
         htt_tx_desc_display(tx_desc->htt_tx_desc);
         /*
          * The netbuf may get linked into a different list inside the
-         * ol_tx_send function, so store the next pointer before the
-         * tx_send call.
+         * download step, so store the next pointer before it.
          */
         next = adf_nbuf_next(msdu);
-        ol_tx_send(vdev->pdev, tx_desc, msdu);
+        OL_TX_LL_DOWNLOAD(pdev, batch, tx_desc, msdu);
         msdu = next;
     }
-    return NULL; /* all MSDUs were accepted */
+    OL_TX_LL_DOWNLOAD_FLUSH(pdev, batch);
+    return msdu; /* NULL if all MSDUs were accepted */
 }
 
 #ifdef QCA_SUPPORT_TXRX_VDEV_LL_TXQ
@@ -138,8 +215,14 @@ ol_tx_vdev_ll_pause_queue_send_base(struct ol_txrx_vdev_t *vdev)
      * the extra complexity.
      */
     max_to_accept =
-        vdev->pdev->tx_desc.num_free - OL_TX_VDEV_PAUSE_QUEUE_SEND_MARGIN;
-    while (max_to_accept > 0 && vdev->ll_pause.txq.depth) {
+        ol_tx_desc_num_allocatable(vdev->pdev) -
+        OL_TX_VDEV_PAUSE_QUEUE_SEND_MARGIN;
+    /*
+     * Also stop at the vdev's byte queue limit; the rest of the backlog
+     * is sent from ol_tx_bql_update as the target completes frames.
+     */
+    while (max_to_accept > 0 && vdev->ll_pause.txq.depth &&
+           OL_TX_BQL_AVAIL(vdev)) {
         adf_nbuf_t tx_msdu;
         max_to_accept--;
         vdev->ll_pause.txq.depth--;
@@ -367,6 +450,124 @@ void ol_tx_vdev_ll_pause_queue_send(void *context)
 #endif
 }
 
+#ifdef QCA_LL_TX_BQL
+void
+ol_tx_bql_vdev_reset(struct ol_txrx_pdev_t *pdev, u_int8_t vdev_id)
+{
+    struct ol_tx_bql_t *bql;
+
+    if (vdev_id >= OL_TX_BQL_MAX_VDEVS) {
+        return;
+    }
+    /*
+     * Leave the inflight count alone - frames from a previous vdev
+     * with the same id may still be waiting for their completions.
+     */
+    bql = &pdev->tx_bql[vdev_id];
+    adf_os_atomic_set(&bql->completed, 0);
+    bql->limit = OL_TX_BQL_LIMIT_INIT;
+    bql->min_slack = (u_int32_t) -1;
+    bql->slack_start_ms = adf_os_ticks_to_msecs(adf_os_ticks());
+    bql->over_limit = 0;
+    adf_os_mem_zero(&bql->stats, sizeof(bql->stats));
+}
+
+void
+ol_tx_bql_attach(struct ol_txrx_pdev_t *pdev)
+{
+    int i;
+
+    for (i = 0; i < OL_TX_BQL_MAX_VDEVS; i++) {
+        adf_os_atomic_init(&pdev->tx_bql[i].inflight);
+        adf_os_atomic_init(&pdev->tx_bql[i].completed);
+        ol_tx_bql_vdev_reset(pdev, i);
+    }
+}
+
+void
+ol_tx_bql_update(struct ol_txrx_pdev_t *pdev)
+{
+    struct ol_txrx_vdev_t *vdev;
+    u_int32_t now_ms = adf_os_ticks_to_msecs(adf_os_ticks());
+
+    TAILQ_FOREACH(vdev, &pdev->vdev_list, vdev_list_elem) {
+        struct ol_tx_bql_t *bql;
+        u_int32_t completed, inflight, slack;
+
+        if (vdev->vdev_id >= OL_TX_BQL_MAX_VDEVS) {
+            continue;
+        }
+        bql = &pdev->tx_bql[vdev->vdev_id];
+        completed = adf_os_atomic_read(&bql->completed);
+        if (!completed) {
+            continue;
+        }
+        adf_os_atomic_add(-(int)completed, &bql->completed);
+        inflight = adf_os_atomic_read(&bql->inflight);
+
+        if (bql->over_limit && inflight == 0) {
+            /*
+             * The target sent everything it had while the OS queue was
+             * held back by the limit, so the limit starved it.
+             * Raise it by what the target got through in the meantime.
+             */
+            bql->limit = adf_os_min(
+                bql->limit + completed, (u_int32_t) OL_TX_BQL_LIMIT_MAX);
+            bql->min_slack = (u_int32_t) -1;
+            bql->slack_start_ms = now_ms;
+            bql->stats.grows++;
+        } else {
+            /*
+             * Having about two completion batches outstanding keeps the
+             * target busy; the rest of the limit is slack.
+             */
+            slack = bql->limit > 2 * completed ? bql->limit - 2 * completed : 0;
+            if (slack < bql->min_slack) {
+                bql->min_slack = slack;
+            }
+            if (now_ms - bql->slack_start_ms >= OL_TX_BQL_SLACK_HOLD_MS) {
+                if (bql->min_slack && bql->limit > OL_TX_BQL_LIMIT_MIN) {
+                    bql->limit = adf_os_max(
+                        bql->limit - bql->min_slack,
+                        (u_int32_t) OL_TX_BQL_LIMIT_MIN);
+                    bql->stats.shrinks++;
+                }
+                bql->min_slack = (u_int32_t) -1;
+                bql->slack_start_ms = now_ms;
+            }
+        }
+        if (inflight < bql->limit) {
+            /* OL_TX_FLOW_CT_UNPAUSE_OS_Q will restart the OS queue */
+            bql->over_limit = 0;
+            if (vdev->ll_pause.txq.depth) {
+                ol_tx_vdev_ll_pause_queue_send(vdev);
+            }
+        }
+    }
+}
+
+void
+ol_tx_bql_stats_display(struct ol_txrx_pdev_t *pdev)
+{
+    struct ol_txrx_vdev_t *vdev;
+
+    TAILQ_FOREACH(vdev, &pdev->vdev_list, vdev_list_elem) {
+        struct ol_tx_bql_t *bql;
+
+        if (vdev->vdev_id >= OL_TX_BQL_MAX_VDEVS) {
+            continue;
+        }
+        bql = &pdev->tx_bql[vdev->vdev_id];
+        VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_INFO,
+            "  vdev %d tx bql: limit %u B, in flight %d B, "
+            "%u stops, %u grows, %u shrinks\n",
+            vdev->vdev_id, bql->limit,
+            adf_os_atomic_read(&bql->inflight),
+            bql->stats.stops, bql->stats.grows, bql->stats.shrinks);
+    }
+}
+#endif /* QCA_LL_TX_BQL */
+
 static inline int
 OL_TXRX_TX_IS_RAW(enum ol_tx_spec tx_spec)
 {
@@ -75,4 +75,57 @@ ol_txrx_mgmt_tx_complete(void *ctxt, adf_nbuf_t netbuf, int err);
 
 void
 ol_tx_pdev_ll_pause_queue_send_all(struct ol_txrx_pdev_t *pdev);
+
+#ifdef QCA_LL_TX_BQL
+/* bounds and starting point for the per-vdev in-flight byte limit */
+#define OL_TX_BQL_LIMIT_MIN     (16 * 1024)
+#define OL_TX_BQL_LIMIT_INIT    (64 * 1024)
+#define OL_TX_BQL_LIMIT_MAX     (1024 * 1024)
+/* how long unused limit has to persist before the limit is lowered */
+#define OL_TX_BQL_SLACK_HOLD_MS 1000
+
+/**
+ * @brief Check whether a vdev may hand more tx frames to the target.
+ * @details
+ *  Like the netdev BQL, this only gates the next frame: the frame that
+ *  takes the vdev over its limit is still sent.
+ */
+static inline int
+ol_tx_bql_avail(struct ol_txrx_vdev_t *vdev)
+{
+    struct ol_tx_bql_t *bql;
+
+    if (vdev->vdev_id >= OL_TX_BQL_MAX_VDEVS) {
+        return 1;
+    }
+    bql = &vdev->pdev->tx_bql[vdev->vdev_id];
+    return (u_int32_t) adf_os_atomic_read(&bql->inflight) < bql->limit;
+}
+
+void
+ol_tx_bql_attach(struct ol_txrx_pdev_t *pdev);
+
+void
+ol_tx_bql_vdev_reset(struct ol_txrx_pdev_t *pdev, u_int8_t vdev_id);
+
+/**
+ * @brief Recompute the vdevs' byte queue limits after a tx completion batch.
+ * @details
+ *  The limit grows when the target ran out of frames while the OS queue
+ *  was stopped by the limit, and shrinks by the smallest unused part of
+ *  the limit observed over OL_TX_BQL_SLACK_HOLD_MS.
+ *  Any pause queue backlog held back by the limit is sent afterwards.
+ */
+void
+ol_tx_bql_update(struct ol_txrx_pdev_t *pdev);
+
+void
+ol_tx_bql_stats_display(struct ol_txrx_pdev_t *pdev);
+
+#define OL_TX_BQL_AVAIL(vdev) ol_tx_bql_avail(vdev)
+#define OL_TX_BQL_UPDATE(pdev) ol_tx_bql_update(pdev)
+#else
+#define OL_TX_BQL_AVAIL(vdev) 1
+#define OL_TX_BQL_UPDATE(pdev) /* no-op */
+#endif /* QCA_LL_TX_BQL */
 #endif /* _OL_TX__H_ */
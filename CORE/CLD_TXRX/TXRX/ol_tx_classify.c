@@ -437,7 +437,12 @@ ol_tx_classify(
             peer = ol_txrx_assoc_peer_find(vdev);
             #endif
         } else {
-            peer = ol_txrx_peer_find_hash_find(pdev, dest_addr, 0, 1);
+            /*
+             * The DA peer must belong to this vdev; looking it up by vdev
+             * also lets consecutive frames to the same peer hit the
+             * vdev's last-hit peer cache instead of the hash table.
+             */
+            peer = ol_txrx_peer_vdev_find_hash(pdev, vdev, dest_addr, 0, 1);
         }
         tx_msdu_info->htt.info.is_unicast = TRUE;
         if (!peer) {
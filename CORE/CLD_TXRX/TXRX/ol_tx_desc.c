@@ -58,44 +58,217 @@ OL_TX_TIMESTAMP_SET(struct ol_tx_desc_t *tx_desc)
 #define OL_TX_TIMESTAMP_SET(tx_desc) /* no-op */
 #endif
 
+#ifdef QCA_SUPPORT_TXDESC_SANITY_CHECKS
+static inline void
+ol_tx_desc_sanity_check(
+    struct ol_txrx_pdev_t *pdev,
+    struct ol_tx_desc_t *tx_desc)
+{
+    if (tx_desc->pkt_type != 0xff
+#ifdef QCA_COMPUTE_TX_DELAY
+        || tx_desc->entry_timestamp_ticks != 0xffffffff
+#endif
+       ) {
+        TXRX_PRINT(TXRX_PRINT_LEVEL_ERR,
+                   "%s Potential tx_desc corruption pkt_type:0x%x pdev:0x%p",
+                     __func__, tx_desc->pkt_type, pdev);
+#ifdef QCA_COMPUTE_TX_DELAY
+        TXRX_PRINT(TXRX_PRINT_LEVEL_ERR, "%s Timestamp:0x%x\n",
+                   __func__, tx_desc->entry_timestamp_ticks);
+#endif
+        adf_os_assert(0);
+    }
+    if ((u_int32_t *) tx_desc->htt_tx_desc < g_dbg_htt_desc_start_addr ||
+        (u_int32_t *) tx_desc->htt_tx_desc > g_dbg_htt_desc_end_addr) {
+        TXRX_PRINT(TXRX_PRINT_LEVEL_ERR,
+                   "%s Potential htt_desc curruption:0x%p pdev:0x%p\n",
+                   __func__, tx_desc->htt_tx_desc, pdev);
+        adf_os_assert(0);
+    }
+}
+#else
+#define ol_tx_desc_sanity_check(pdev, tx_desc) /* no-op */
+#endif
+
+#ifdef QCA_SUPPORT_TX_DESC_PERCPU_CACHE
+int
+ol_tx_desc_cache_attach(struct ol_txrx_pdev_t *pdev)
+{
+    pdev->tx_desc.num_caches = adf_os_num_cpu_ids();
+    pdev->tx_desc.caches = adf_os_mem_alloc(
+        pdev->osdev,
+        pdev->tx_desc.num_caches * sizeof(struct ol_tx_desc_cache_t));
+    if (!pdev->tx_desc.caches) {
+        pdev->tx_desc.num_caches = 0;
+        return 1; /* failure */
+    }
+    adf_os_mem_set(
+        pdev->tx_desc.caches, 0,
+        pdev->tx_desc.num_caches * sizeof(struct ol_tx_desc_cache_t));
+    return 0; /* success */
+}
+
+void
+ol_tx_desc_cache_detach(struct ol_txrx_pdev_t *pdev)
+{
+    /*
+     * The cached descs are elements of pdev->tx_desc.array,
+     * so there is nothing to hand back - just drop the caches.
+     */
+    if (pdev->tx_desc.caches) {
+        adf_os_mem_free(pdev->tx_desc.caches);
+    }
+    pdev->tx_desc.caches = NULL;
+    pdev->tx_desc.num_caches = 0;
+}
+
+u_int16_t
+ol_tx_desc_num_allocatable(struct ol_txrx_pdev_t *pdev)
+{
+    /*
+     * A CPU only refills its cache from the pdev freelist and never takes
+     * descs from another CPU's cache, so those are not counted: up to
+     * OL_TX_DESC_CACHE_SIZE-1 descs per CPU may sit idle in a cache that
+     * the transmitting CPU cannot reach.
+     */
+    return pdev->tx_desc.num_free;
+}
+
+u_int16_t
+ol_tx_desc_num_avail(struct ol_txrx_pdev_t *pdev)
+{
+    int i;
+    u_int16_t num_free = pdev->tx_desc.num_free;
+
+    /* lockless snapshot - good enough for flow control decisions */
+    for (i = 0; i < pdev->tx_desc.num_caches; i++) {
+        num_free += pdev->tx_desc.caches[i].num_free;
+    }
+    return num_free;
+}
+
+static inline struct ol_tx_desc_t *
+ol_tx_desc_cache_get(struct ol_txrx_pdev_t *pdev)
+{
+    struct ol_tx_desc_cache_t *cache;
+    union ol_tx_desc_list_elem_t *elem;
+    a_bool_t bh_disabled;
+    int cpu;
+
+    cpu = adf_os_get_cpu_bh(&bh_disabled);
+    cache = &pdev->tx_desc.caches[cpu];
+    if (adf_os_likely(cache->freelist)) {
+        cache->stats.alloc_hit++;
+    } else {
+        int i;
+
+        /* refill a batch of descs from the pdev freelist */
+        cache->stats.alloc_miss++;
+        adf_os_spin_lock_bh(&pdev->tx_mutex);
+        for (i = 0; i < OL_TX_DESC_CACHE_BATCH && pdev->tx_desc.freelist; i++) {
+            elem = pdev->tx_desc.freelist;
+            pdev->tx_desc.freelist = elem->next;
+            elem->next = cache->freelist;
+            cache->freelist = elem;
+        }
+        pdev->tx_desc.num_free -= i;
+        adf_os_spin_unlock_bh(&pdev->tx_mutex);
+        cache->num_free += i;
+        if (i) {
+            cache->stats.refill++;
+        }
+    }
+    elem = cache->freelist;
+    if (elem) {
+        cache->freelist = elem->next;
+        cache->num_free--;
+    }
+    adf_os_put_cpu_bh(bh_disabled);
+
+    return elem ? &elem->tx_desc : NULL;
+}
+
+static inline void
+ol_tx_desc_cache_put(
+    struct ol_txrx_pdev_t *pdev,
+    struct ol_tx_desc_t *tx_desc)
+{
+    struct ol_tx_desc_cache_t *cache;
+    union ol_tx_desc_list_elem_t *elem = (union ol_tx_desc_list_elem_t *) tx_desc;
+    a_bool_t bh_disabled;
+    int cpu;
+
+    cpu = adf_os_get_cpu_bh(&bh_disabled);
+    cache = &pdev->tx_desc.caches[cpu];
+    elem->next = cache->freelist;
+    cache->freelist = elem;
+    cache->num_free++;
+    cache->stats.free_hit++;
+    if (adf_os_unlikely(cache->num_free >= OL_TX_DESC_CACHE_SIZE)) {
+        union ol_tx_desc_list_elem_t *head, *tail;
+        int i;
+
+        /* drain the most recently freed batch back to the pdev freelist */
+        head = tail = cache->freelist;
+        for (i = 1; i < OL_TX_DESC_CACHE_BATCH; i++) {
+            tail = tail->next;
+        }
+        cache->freelist = tail->next;
+        cache->num_free -= OL_TX_DESC_CACHE_BATCH;
+        cache->stats.drain++;
+
+        adf_os_spin_lock_bh(&pdev->tx_mutex);
+        tail->next = pdev->tx_desc.freelist;
+        pdev->tx_desc.freelist = head;
+        pdev->tx_desc.num_free += OL_TX_DESC_CACHE_BATCH;
+        adf_os_spin_unlock_bh(&pdev->tx_mutex);
+    }
+    adf_os_put_cpu_bh(bh_disabled);
+}
+
+void
+ol_tx_desc_cache_stats_display(struct ol_txrx_pdev_t *pdev)
+{
+    int i;
+
+    for (i = 0; i < pdev->tx_desc.num_caches; i++) {
+        struct ol_tx_desc_cache_t *cache = &pdev->tx_desc.caches[i];
+
+        if (!cache->stats.alloc_hit && !cache->stats.alloc_miss &&
+            !cache->stats.free_hit) {
+            continue;
+        }
+        VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_INFO,
+            "    cpu %d: %d cached, alloc hit %u miss %u, free %u, "
+            "refill %u, drain %u\n",
+            i, cache->num_free,
+            cache->stats.alloc_hit, cache->stats.alloc_miss,
+            cache->stats.free_hit,
+            cache->stats.refill, cache->stats.drain);
+    }
+}
+#endif /* QCA_SUPPORT_TX_DESC_PERCPU_CACHE */
+
 static inline struct ol_tx_desc_t *
 ol_tx_desc_alloc(struct ol_txrx_pdev_t *pdev, struct ol_txrx_vdev_t *vdev)
 {
     struct ol_tx_desc_t *tx_desc = NULL;
 
+#ifdef QCA_SUPPORT_TX_DESC_PERCPU_CACHE
+    tx_desc = ol_tx_desc_cache_get(pdev);
+#else
     adf_os_spin_lock_bh(&pdev->tx_mutex);
     if (pdev->tx_desc.freelist) {
         pdev->tx_desc.num_free--;
         tx_desc = &pdev->tx_desc.freelist->tx_desc;
         pdev->tx_desc.freelist = pdev->tx_desc.freelist->next;
-#ifdef QCA_SUPPORT_TXDESC_SANITY_CHECKS
-        if (tx_desc->pkt_type != 0xff
-#ifdef QCA_COMPUTE_TX_DELAY
-            || tx_desc->entry_timestamp_ticks != 0xffffffff
-#endif
-           ) {
-            TXRX_PRINT(TXRX_PRINT_LEVEL_ERR,
-                       "%s Potential tx_desc corruption pkt_type:0x%x pdev:0x%p",
-                         __func__, tx_desc->pkt_type, pdev);
-#ifdef QCA_COMPUTE_TX_DELAY
-            TXRX_PRINT(TXRX_PRINT_LEVEL_ERR, "%s Timestamp:0x%x\n",
-                       __func__, tx_desc->entry_timestamp_ticks);
-#endif
-            adf_os_assert(0);
-        }
-        if ((u_int32_t *) tx_desc->htt_tx_desc < g_dbg_htt_desc_start_addr ||
-            (u_int32_t *) tx_desc->htt_tx_desc > g_dbg_htt_desc_end_addr) {
-            TXRX_PRINT(TXRX_PRINT_LEVEL_ERR,
-                       "%s Potential htt_desc curruption:0x%p pdev:0x%p\n",
-                       __func__, tx_desc->htt_tx_desc, pdev);
-            adf_os_assert(0);
-        }
-#endif
     }
     adf_os_spin_unlock_bh(&pdev->tx_mutex);
+#endif
     if (!tx_desc) {
         return NULL;
     }
+    ol_tx_desc_sanity_check(pdev, tx_desc);
 #if defined(CONFIG_PER_VDEV_TX_DESC_POOL)
     tx_desc->vdev = vdev;
     adf_os_atomic_inc(&vdev->tx_desc_count);
@@ -127,19 +300,21 @@ ol_tx_desc_find(struct ol_txrx_pdev_t *pdev, u_int16_t tx_desc_id)
     return &pdev->tx_desc.array[tx_desc_id].tx_desc;
 }
 
-void
-ol_tx_desc_free(struct ol_txrx_pdev_t *pdev, struct ol_tx_desc_t *tx_desc)
+/*
+ * Per-descriptor bookkeeping done before a tx desc goes back to a freelist.
+ * With the per-vdev desc pools this checks and wakes the vdev's OS queue,
+ * which is shared state, so it must then be called with tx_mutex held
+ * (see OL_TX_DESC_FREE_PREP_LOCKED).
+ */
+static inline void
+ol_tx_desc_free_prep(struct ol_txrx_pdev_t *pdev, struct ol_tx_desc_t *tx_desc)
 {
-    adf_os_spin_lock_bh(&pdev->tx_mutex);
 #ifdef QCA_SUPPORT_TXDESC_SANITY_CHECKS
     tx_desc->pkt_type = 0xff;
 #ifdef QCA_COMPUTE_TX_DELAY
     tx_desc->entry_timestamp_ticks = 0xffffffff;
 #endif
 #endif
-    ((union ol_tx_desc_list_elem_t *) tx_desc)->next = pdev->tx_desc.freelist;
-    pdev->tx_desc.freelist = (union ol_tx_desc_list_elem_t *) tx_desc;
-    pdev->tx_desc.num_free++;
 #if defined(CONFIG_PER_VDEV_TX_DESC_POOL)
 #ifdef QCA_LL_TX_FLOW_CT
     if ( (adf_os_atomic_read(&tx_desc->vdev->os_q_paused)) &&
@@ -154,7 +329,35 @@ ol_tx_desc_free(struct ol_txrx_pdev_t *pdev, struct ol_tx_desc_t *tx_desc)
     adf_os_atomic_dec(&tx_desc->vdev->tx_desc_count);
     tx_desc->vdev = NULL;
 #endif
+    OL_TX_DESC_BQL_UNCHARGE(pdev, tx_desc);
+}
+
+#if defined(CONFIG_PER_VDEV_TX_DESC_POOL) && defined(QCA_LL_TX_FLOW_CT)
+#define OL_TX_DESC_FREE_PREP_LOCKED 1
+#else
+#define OL_TX_DESC_FREE_PREP_LOCKED 0
+#endif
+
+void
+ol_tx_desc_free(struct ol_txrx_pdev_t *pdev, struct ol_tx_desc_t *tx_desc)
+{
+#ifdef QCA_SUPPORT_TX_DESC_PERCPU_CACHE
+    if (OL_TX_DESC_FREE_PREP_LOCKED) {
+        adf_os_spin_lock_bh(&pdev->tx_mutex);
+        ol_tx_desc_free_prep(pdev, tx_desc);
+        adf_os_spin_unlock_bh(&pdev->tx_mutex);
+    } else {
+        ol_tx_desc_free_prep(pdev, tx_desc);
+    }
+    ol_tx_desc_cache_put(pdev, tx_desc);
+#else
+    adf_os_spin_lock_bh(&pdev->tx_mutex);
+    ol_tx_desc_free_prep(pdev, tx_desc);
+    ((union ol_tx_desc_list_elem_t *) tx_desc)->next = pdev->tx_desc.freelist;
+    pdev->tx_desc.freelist = (union ol_tx_desc_list_elem_t *) tx_desc;
+    pdev->tx_desc.num_free++;
     adf_os_spin_unlock_bh(&pdev->tx_mutex);
+#endif
 }
 
 struct ol_tx_desc_t *
@@ -193,6 +396,15 @@ ol_tx_desc_ll(
     tx_desc->netbuf = netbuf;
     /* fix this - get pkt_type from msdu_info */
     tx_desc->pkt_type = ol_tx_frm_std;
+#ifdef QCA_LL_TX_BQL
+    /* charge the frame against its vdev's byte queue limit */
+    if (vdev->vdev_id < OL_TX_BQL_MAX_VDEVS) {
+        tx_desc->bql_vdev_id = vdev->vdev_id;
+        tx_desc->bql_bytes = (u_int16_t) adf_nbuf_len(netbuf);
+        adf_os_atomic_add(
+            tx_desc->bql_bytes, &pdev->tx_bql[vdev->vdev_id].inflight);
+    }
+#endif
 
     /* initialize the HW tx descriptor */
     htt_tx_desc_init(
@@ -274,6 +486,8 @@ void ol_tx_desc_frame_list_free(
     int had_error)
 {
     struct ol_tx_desc_t *tx_desc, *tmp;
+    union ol_tx_desc_list_elem_t *free_head = NULL, *free_tail = NULL;
+    u_int16_t num_free = 0;
     adf_nbuf_t msdus = NULL;
 
     TAILQ_FOREACH_SAFE(tx_desc, tx_descs, tx_desc_list_elem, tmp) {
@@ -284,12 +498,33 @@ void ol_tx_desc_frame_list_free(
         OL_TX_RESTORE_HDR(tx_desc, msdu); /* restore original hdr offset */
 #endif
         adf_nbuf_unmap(pdev->osdev, msdu, ADF_OS_DMA_TO_DEVICE);
-        /* free the tx desc */
-        ol_tx_desc_free(pdev, tx_desc);
         /* link the netbuf into a list to free as a batch */
         adf_nbuf_set_next(msdu, msdus);
         msdus = msdu;
     }
+    /*
+     * Return the tx descs to the pdev freelist with a single lock
+     * acquisition.  Completions run on the rx CPU, so this bypasses the
+     * per-CPU desc caches - refilling the completing CPU's cache would
+     * only drain it straight back to the pdev freelist.
+     * ol_tx_desc_free_prep is done inside the lock, as in ol_tx_desc_free.
+     */
+    if (!TAILQ_EMPTY(tx_descs)) {
+        adf_os_spin_lock_bh(&pdev->tx_mutex);
+        TAILQ_FOREACH_SAFE(tx_desc, tx_descs, tx_desc_list_elem, tmp) {
+            ol_tx_desc_free_prep(pdev, tx_desc);
+            ((union ol_tx_desc_list_elem_t *) tx_desc)->next = free_head;
+            if (!free_tail) {
+                free_tail = (union ol_tx_desc_list_elem_t *) tx_desc;
+            }
+            free_head = (union ol_tx_desc_list_elem_t *) tx_desc;
+            num_free++;
+        }
+        free_tail->next = pdev->tx_desc.freelist;
+        pdev->tx_desc.freelist = free_head;
+        pdev->tx_desc.num_free += num_free;
+        adf_os_spin_unlock_bh(&pdev->tx_mutex);
+    }
     /* free the netbufs as a batch */
     adf_nbuf_tx_free(msdus, had_error);
 }
@@ -37,6 +37,33 @@
 #include <ol_txrx_types.h> /* ol_tx_desc_t */
 #include <ol_txrx_internal.h> /*TXRX_ASSERT2 */
 
+#ifdef QCA_LL_TX_BQL
+/*
+ * Return the bytes a tx descriptor was charged against its vdev's byte
+ * queue limit to the limit; ol_tx_bql_update then recomputes the limit
+ * once per completion batch.
+ */
+static inline void
+ol_tx_desc_bql_uncharge(
+    struct ol_txrx_pdev_t *pdev,
+    struct ol_tx_desc_t *tx_desc)
+{
+    struct ol_tx_bql_t *bql;
+
+    if (tx_desc->bql_vdev_id == OL_TX_BQL_VDEV_ID_NONE) {
+        return;
+    }
+    bql = &pdev->tx_bql[tx_desc->bql_vdev_id];
+    adf_os_atomic_add(-(int)tx_desc->bql_bytes, &bql->inflight);
+    adf_os_atomic_add(tx_desc->bql_bytes, &bql->completed);
+    tx_desc->bql_vdev_id = OL_TX_BQL_VDEV_ID_NONE;
+}
+#define OL_TX_DESC_BQL_UNCHARGE(pdev, tx_desc) \
+    ol_tx_desc_bql_uncharge(pdev, tx_desc)
+#else
+#define OL_TX_DESC_BQL_UNCHARGE(pdev, tx_desc) /* no-op */
+#endif /* QCA_LL_TX_BQL */
+
 /**
  * @brief Allocate and initialize a tx descriptor for a LL system.
  * @details
@@ -99,8 +126,8 @@ ol_tx_desc_find(struct ol_txrx_pdev_t *pdev, u_int16_t tx_desc_id);
  * @brief Free a list of tx descriptors and the tx frames they refer to.
  * @details
  *  Free a batch of "standard" tx descriptors and their tx frames.
- *  Free each tx descriptor, by returning it to the freelist.
- *  Unmap each netbuf, and free the netbufs as a batch.
+ *  Unmap each netbuf, return the tx descriptors to the freelist with
+ *  a single lock acquisition, and free the netbufs as a batch.
  *  Irregular tx frames like TSO or managment frames that require
  *  special handling are processed by the ol_tx_desc_frame_free_nonstd
  *  function rather than this function.
@@ -177,4 +204,65 @@ ol_ath_get_bcn_header(ol_pdev_handle pdev, A_UINT32 vdev_id);
 void
 ol_tx_desc_free(struct ol_txrx_pdev_t *pdev, struct ol_tx_desc_t *tx_desc);
 
+#ifdef QCA_SUPPORT_TX_DESC_PERCPU_CACHE
+/**
+ * @brief Set up the per-CPU tx descriptor caches.
+ * @details
+ *  The caches start out empty, and are filled on demand from the
+ *  pdev freelist, so this must be called after the freelist is built.
+ *
+ * @param pdev - the data physical device owning the tx desc pool
+ * @return 0 - success, 1 - failure
+ */
+int
+ol_tx_desc_cache_attach(struct ol_txrx_pdev_t *pdev);
+
+/**
+ * @brief Release the per-CPU tx descriptor caches.
+ *
+ * @param pdev - the data physical device owning the tx desc pool
+ */
+void
+ol_tx_desc_cache_detach(struct ol_txrx_pdev_t *pdev);
+
+/**
+ * @brief Count the tx descriptors that are not in use.
+ * @details
+ *  This includes both the descriptors in the pdev freelist and the
+ *  ones parked in the per-CPU caches.
+ *
+ * @param pdev - the data physical device owning the tx desc pool
+ * @return number of unallocated tx descriptors
+ */
+u_int16_t
+ol_tx_desc_num_avail(struct ol_txrx_pdev_t *pdev);
+
+/**
+ * @brief Count the tx descriptors any CPU is guaranteed to be able to get.
+ * @details
+ *  Unlike ol_tx_desc_num_avail, this leaves out the descriptors parked in
+ *  the per-CPU caches, since a CPU cannot allocate from another CPU's
+ *  cache. Flow control decisions must use this count.
+ *
+ * @param pdev - the data physical device owning the tx desc pool
+ * @return number of tx descriptors in the pdev freelist
+ */
+u_int16_t
+ol_tx_desc_num_allocatable(struct ol_txrx_pdev_t *pdev);
+
+/**
+ * @brief Print the per-CPU tx descriptor cache hit / miss counters.
+ *
+ * @param pdev - the data physical device owning the tx desc pool
+ */
+void
+ol_tx_desc_cache_stats_display(struct ol_txrx_pdev_t *pdev);
+#else
+#define ol_tx_desc_cache_attach(pdev) 0
+#define ol_tx_desc_cache_detach(pdev) /* no-op */
+#define ol_tx_desc_num_avail(pdev) ((pdev)->tx_desc.num_free)
+#define ol_tx_desc_num_allocatable(pdev) ((pdev)->tx_desc.num_free)
+#define ol_tx_desc_cache_stats_display(pdev) /* no-op */
+#endif /* QCA_SUPPORT_TX_DESC_PERCPU_CACHE */
+
 #endif /* _OL_TX_DESC__H_ */
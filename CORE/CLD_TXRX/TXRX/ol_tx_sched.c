@@ -38,6 +38,7 @@
 #include <ol_tx_queue.h>
 #include <ol_txrx.h>
 #include <adf_os_types.h>     /* a_bool_t */
+#include <adf_os_time.h>      /* adf_os_ticks, etc. */
 
 #ifndef DEBUG_SCHED_STAT
 #define DEBUG_SCHED_STAT 0
@@ -71,6 +72,11 @@ ol_tx_sched_log(struct ol_txrx_pdev_t *pdev);
 struct ol_tx_sched_ctx {
     ol_tx_desc_list head;
     int frms;
+#if defined(QCA_TX_SCHED_FQ_CODEL)
+    /* frames the scheduler's AQM chose to drop rather than download */
+    ol_tx_desc_list drop_head;
+    int drop_frms;
+#endif
 };
 
 typedef TAILQ_HEAD(ol_tx_frms_queue_list_s, ol_tx_frms_queue_t)
@@ -102,14 +108,42 @@ typedef TAILQ_HEAD(ol_tx_frms_queue_list_s, ol_tx_frms_queue_t)
  *    Select the head tx queue for this TID.
  *    Move the tx queue to the back of the list of tx queues for this TID.
  *    Send no more frames than the limit specified for the TID.
+ *    With QCA_SUPPORT_TX_AIRTIME_FAIRNESS, the tx queue within the TID
+ *    is instead chosen by deficit round-robin on each peer's estimated
+ *    airtime, so slow clients can't starve fast ones of the medium.
+ * 3. Flow-queue CoDel scheduler:
+ *    Select the TID at the head of the list of active TIDs, as for
+ *    round-robin, and move it to the back of the list once serviced.
+ *    Within the TID, frames are hashed by their L3/L4 flow into a fixed
+ *    set of flow queues, which are serviced by deficit round-robin with
+ *    a byte quantum, giving newly-active (sparse) flows priority.
+ *    Each flow runs CoDel on the head frame's sojourn time, dropping
+ *    frames that have been held too long instead of downloading them.
+ *    Congestion discards drop from the flow with the largest backlog.
+ *    This requires per-frame state in the tx descriptor, so it is
+ *    selected by building with QCA_TX_SCHED_FQ_CODEL.
  */
 #define OL_TX_SCHED_RR  1
 #define OL_TX_SCHED_WRR_ADV 2
+#define OL_TX_SCHED_FQ_CODEL 3
 
 #ifndef OL_TX_SCHED
+#if defined(QCA_TX_SCHED_FQ_CODEL)
+#define OL_TX_SCHED OL_TX_SCHED_FQ_CODEL
+#else
 //#define OL_TX_SCHED OL_TX_SCHED_RR
 #define OL_TX_SCHED OL_TX_SCHED_WRR_ADV /* default */
 #endif
+#endif
+
+#if (OL_TX_SCHED == OL_TX_SCHED_FQ_CODEL) != defined(QCA_TX_SCHED_FQ_CODEL)
+#error OL_TX_SCHED_FQ_CODEL and QCA_TX_SCHED_FQ_CODEL must be used together
+#endif
+
+#if defined(QCA_SUPPORT_TX_AIRTIME_FAIRNESS) && \
+    OL_TX_SCHED != OL_TX_SCHED_WRR_ADV
+#error QCA_SUPPORT_TX_AIRTIME_FAIRNESS requires the OL_TX_SCHED_WRR_ADV scheduler
+#endif
 
 
 #if OL_TX_SCHED == OL_TX_SCHED_RR
@@ -151,6 +185,24 @@ typedef TAILQ_HEAD(ol_tx_frms_queue_list_s, ol_tx_frms_queue_t)
 #define ol_tx_sched_discard_select_category \
     ol_tx_sched_discard_select_category_wrr_adv
 
+#elif OL_TX_SCHED == OL_TX_SCHED_FQ_CODEL
+
+#define ol_tx_sched_fq_codel_t ol_tx_sched_t
+
+#define OL_TX_SCHED_NUM_CATEGORIES (OL_TX_NUM_TIDS + OL_TX_VDEV_NUM_QUEUES)
+
+#define ol_tx_sched_init                ol_tx_sched_init_fq_codel
+#define ol_tx_sched_select_init(pdev)   /* no-op */
+#define ol_tx_sched_select_batch        ol_tx_sched_select_batch_fq_codel
+#define ol_tx_sched_txq_enqueue         ol_tx_sched_txq_enqueue_fq_codel
+#define ol_tx_sched_txq_deactivate      ol_tx_sched_txq_deactivate_fq_codel
+#define ol_tx_sched_category_info       ol_tx_sched_category_info_fq_codel
+/*
+ * ol_tx_sched_discard_select is provided by the FQ-CoDel scheduler itself,
+ * and does its own accounting, so no discard notification is needed.
+ */
+#define ol_tx_sched_txq_discard(pdev, txq, cat, frames, bytes) /* no-op */
+
 #else
 
 #error Unknown OL TX SCHED specification
@@ -685,6 +737,105 @@ ol_tx_sched_wrr_adv_credit_sanity_check(struct ol_txrx_pdev_t *pdev, u_int32_t c
     adf_os_assert(okay);
 }
 
+#if defined(QCA_SUPPORT_TX_AIRTIME_FAIRNESS)
+
+/*
+ * Airtime fairness:
+ * Each peer tx queue within a category carries an airtime deficit (usec).
+ * A queue is only served while its deficit is positive, and is charged
+ * for each batch it downloads, based on the batch's byte count and the
+ * peer's current PHY tx rate (see ol_txrx_peer_tx_rate_update).
+ * When no queue has airtime left, all queues in the category receive
+ * another quantum.  vdev tx queues (mcast / mgmt) are never charged.
+ */
+#define OL_TX_SCHED_AIRTIME_QUANTUM_US 4000
+/* rate assumed for peers whose tx rate hasn't been reported yet */
+#define OL_TX_SCHED_AIRTIME_DEFAULT_RATE_KBPS 24000
+
+static inline struct ol_txrx_peer_t *
+ol_tx_sched_airtime_txq_peer(struct ol_tx_frms_queue_t *txq)
+{
+    if (txq->ext_tid >= OL_TX_NUM_TIDS) {
+        return NULL; /* vdev tx queue */
+    }
+    return container_of(txq - txq->ext_tid, struct ol_txrx_peer_t, txqs[0]);
+}
+
+static struct ol_tx_frms_queue_t *
+ol_tx_sched_airtime_txq_select(ol_tx_frms_queue_list *head)
+{
+    struct ol_tx_frms_queue_t *txq;
+    int max_deficit, rounds;
+
+    txq = TAILQ_FIRST(head);
+    if (!txq || txq->airtime_deficit > 0) {
+        return txq;
+    }
+    /*
+     * Rather than handing out one quantum per pass over the list, give
+     * every queue as many quanta as the least indebted queue needs to
+     * become eligible - this is equivalent, and bounds the work done here.
+     */
+    max_deficit = txq->airtime_deficit;
+    TAILQ_FOREACH(txq, head, list_elem) {
+        max_deficit = OL_A_MAX(max_deficit, txq->airtime_deficit);
+    }
+    if (max_deficit <= 0) {
+        rounds = (-max_deficit) / OL_TX_SCHED_AIRTIME_QUANTUM_US + 1;
+        TAILQ_FOREACH(txq, head, list_elem) {
+            txq->airtime_deficit += rounds * OL_TX_SCHED_AIRTIME_QUANTUM_US;
+        }
+    }
+    /* move the queues that are still in deficit behind the eligible ones */
+    while ((txq = TAILQ_FIRST(head))->airtime_deficit <= 0) {
+        TAILQ_REMOVE(head, txq, list_elem);
+        TAILQ_INSERT_TAIL(head, txq, list_elem);
+    }
+    return txq;
+}
+
+static void
+ol_tx_sched_airtime_charge(struct ol_tx_frms_queue_t *txq, int bytes)
+{
+    struct ol_txrx_peer_t *peer;
+    u_int32_t rate_kbps, airtime_us;
+
+    peer = ol_tx_sched_airtime_txq_peer(txq);
+    if (!peer) {
+        return;
+    }
+    rate_kbps = peer->tx_airtime.rate_kbps;
+    if (rate_kbps == 0) {
+        rate_kbps = OL_TX_SCHED_AIRTIME_DEFAULT_RATE_KBPS;
+    }
+    /*
+     * bits / kbps gives msec, so scale by 1000 for usec.
+     * A batch is bounded by the category's send_limit, so this can't
+     * overflow 32 bits.
+     */
+    airtime_us = ((u_int32_t) bytes * 8 * 1000) / rate_kbps;
+    txq->airtime_deficit -= airtime_us;
+    peer->tx_airtime.airtime_us += airtime_us;
+    peer->tx_airtime.bytes += bytes;
+    /*
+     * An idle queue doesn't bank unused airtime, but does keep its debt,
+     * so a slow peer can't shed its debt by briefly draining its queue.
+     */
+    if (txq->frms == 0 && txq->airtime_deficit > 0) {
+        txq->airtime_deficit = 0;
+    }
+}
+
+#define OL_TX_SCHED_WRR_ADV_TXQ_SELECT ol_tx_sched_airtime_txq_select
+#define OL_TX_SCHED_AIRTIME_CHARGE ol_tx_sched_airtime_charge
+
+#else
+
+#define OL_TX_SCHED_WRR_ADV_TXQ_SELECT(head) TAILQ_FIRST(head)
+#define OL_TX_SCHED_AIRTIME_CHARGE(txq, bytes) /* no-op */
+
+#endif /* defined(QCA_SUPPORT_TX_AIRTIME_FAIRNESS) */
+
 /*
  * The scheduler sync spinlock has been acquired outside this function,
  * so there is no need to worry about mutex within this function.
@@ -769,9 +920,10 @@ ol_tx_sched_select_batch_wrr_adv(
     scheduler->index = index;
 
     /*
-     * Take the tx queue from the head of the category list.
+     * Take the tx queue from the head of the category list
+     * (or the next one with airtime left, under airtime fairness).
      */
-    txq = TAILQ_FIRST(&category->state.head);
+    txq = OL_TX_SCHED_WRR_ADV_TXQ_SELECT(&category->state.head);
     if (txq){
         TAILQ_REMOVE(&category->state.head, txq, list_elem);
         credit -= category->specs.credit_reserve;
@@ -780,6 +932,7 @@ ol_tx_sched_select_batch_wrr_adv(
         used_credits = credit;
         category->state.frms -= frames;
         category->state.bytes -= bytes;
+        OL_TX_SCHED_AIRTIME_CHARGE(txq, bytes);
         if (txq->frms > 0) {
             TAILQ_INSERT_TAIL(&category->state.head, txq, list_elem);
         } else {
@@ -1037,10 +1190,816 @@ ol_txrx_set_wmm_param(ol_txrx_pdev_handle data_pdev, struct ol_tx_wmm_param_t wm
     }
 }
 
+#if defined(QCA_SUPPORT_TX_AIRTIME_FAIRNESS)
+void
+ol_tx_sched_stats_display(struct ol_txrx_pdev_t *pdev)
+{
+    struct ol_txrx_vdev_t *vdev;
+    struct ol_txrx_peer_t *peer;
+
+    VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_INFO,
+        "  tx sched airtime fairness (quantum %d us):\n",
+        OL_TX_SCHED_AIRTIME_QUANTUM_US);
+    adf_os_spin_lock_bh(&pdev->peer_ref_mutex);
+    TAILQ_FOREACH(vdev, &pdev->vdev_list, vdev_list_elem) {
+        TAILQ_FOREACH(peer, &vdev->peer_list, peer_list_elem) {
+            if (peer->tx_airtime.bytes == 0) {
+                continue;
+            }
+            VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_INFO,
+                "    vdev %d peer %02x:%02x:%02x:%02x:%02x:%02x: "
+                "rate %u kbps, %llu bytes, %llu us airtime, "
+                "tid 0 deficit %d us\n",
+                vdev->vdev_id,
+                peer->mac_addr.raw[0], peer->mac_addr.raw[1],
+                peer->mac_addr.raw[2], peer->mac_addr.raw[3],
+                peer->mac_addr.raw[4], peer->mac_addr.raw[5],
+                peer->tx_airtime.rate_kbps,
+                (unsigned long long) peer->tx_airtime.bytes,
+                (unsigned long long) peer->tx_airtime.airtime_us,
+                peer->txqs[0].airtime_deficit);
+        }
+    }
+    adf_os_spin_unlock_bh(&pdev->peer_ref_mutex);
+}
+#endif /* defined(QCA_SUPPORT_TX_AIRTIME_FAIRNESS) */
+
 #endif /* OL_TX_SCHED == OL_TX_SCHED_WRR_ADV */
 
+/*--- flow-queue CoDel scheduler --------------------------------------------*/
+#if OL_TX_SCHED == OL_TX_SCHED_FQ_CODEL
+
+/*--- definitions ---*/
+
+#define OL_TX_SCHED_FQ_CODEL_NUM_TIDS (OL_TX_NUM_TIDS + OL_TX_VDEV_NUM_QUEUES)
+
+/* number of flow queues per TID - must be a power of 2, at most 256 */
+#define OL_TX_SCHED_FQ_CODEL_NUM_FLOWS 16
+#define OL_TX_SCHED_FQ_CODEL_FLOW_MASK (OL_TX_SCHED_FQ_CODEL_NUM_FLOWS - 1)
+
+/* DRR byte quantum - one full-sized ethernet frame */
+#define OL_TX_SCHED_FQ_CODEL_QUANTUM 1514
+
+/* max frames downloaded from a TID per scheduler selection */
+#define OL_TX_SCHED_FQ_CODEL_SEND_LIMIT 16
+
+/*
+ * CoDel parameters.
+ * The target is larger than the 5 ms wired default, since the sojourn
+ * time is measured in OS ticks, and since a WLAN link's service time
+ * is itself on the order of milliseconds.
+ */
+#define OL_TX_SCHED_FQ_CODEL_TARGET_MS   20
+#define OL_TX_SCHED_FQ_CODEL_INTERVAL_MS 100
+
+enum ol_tx_sched_fq_codel_flow_state {
+    ol_tx_sched_fq_codel_flow_idle = 0,
+    ol_tx_sched_fq_codel_flow_new,
+    ol_tx_sched_fq_codel_flow_old,
+};
+
+struct ol_tx_sched_fq_codel_flow_t {
+    /* list_elem is used to queue the flow in its TID's new or old list */
+    TAILQ_ENTRY(ol_tx_sched_fq_codel_flow_t) list_elem;
+    /* frames, linked through tx_desc->fq_flow_elem */
+    ol_tx_desc_list head;
+    u_int16_t frms;
+    u_int32_t bytes;
+    int deficit;
+    enum ol_tx_sched_fq_codel_flow_state state;
+    struct {
+        unsigned long first_above_time;
+        unsigned long drop_next;
+        u_int32_t count;
+        u_int32_t last_count;
+        a_bool_t dropping;
+    } codel;
+    struct {
+        u_int32_t dequeued;
+        u_int32_t codel_drops;
+        u_int32_t discards;
+        /* moving average (1/8 weight) and max of the queue delay, in ms */
+        u_int32_t delay_avg_ms;
+        u_int32_t delay_max_ms;
+    } stats;
+};
+
+typedef TAILQ_HEAD(ol_tx_sched_fq_codel_flow_list_s,
+    ol_tx_sched_fq_codel_flow_t) ol_tx_sched_fq_codel_flow_list;
+
+struct ol_tx_sched_fq_codel_tid_t {
+    /* list_elem is used to queue the TID in the list of active TIDs */
+    TAILQ_ENTRY(ol_tx_sched_fq_codel_tid_t) list_elem;
+    ol_tx_sched_fq_codel_flow_list new_flows;
+    ol_tx_sched_fq_codel_flow_list old_flows;
+    int frms;
+    int bytes;
+    a_bool_t active;
+    u_int8_t discard_weight;
+    struct ol_tx_sched_fq_codel_flow_t flows[OL_TX_SCHED_FQ_CODEL_NUM_FLOWS];
+};
+
+struct ol_tx_sched_fq_codel_t {
+    struct ol_tx_sched_fq_codel_tid_t tids[OL_TX_SCHED_FQ_CODEL_NUM_TIDS];
+    TAILQ_HEAD(ol_tx_sched_fq_codel_tid_list_s, ol_tx_sched_fq_codel_tid_t)
+        active_tids;
+    u_int32_t hash_seed;
+    unsigned long target_ticks;
+    unsigned long interval_ticks;
+};
+
+enum {
+    ol_tx_sched_fq_codel_discard_weight_voice = 1,
+    ol_tx_sched_fq_codel_discard_weight_video = 4,
+    ol_tx_sched_fq_codel_discard_weight_ucast_default = 8,
+    ol_tx_sched_fq_codel_discard_weight_mgmt_non_qos = 1,
+    ol_tx_sched_fq_codel_discard_weight_mcast = 1,
+};
+
+#define OL_TX_SCHED_FQ_CODEL_HASH_MIX(hash, val) \
+    (hash) = ((hash) ^ (u_int32_t)(val)) * 0x9e3779b1
+
+/*--- functions ---*/
+
+/*
+ * Hash the frame's IP addresses, protocol, and TCP/UDP ports, so that
+ * each L4 flow within the TID queue gets its own flow queue.
+ * Non-IP frames all fall into the flow selected by the hash seed and
+ * the tx queue.
+ */
+static u_int8_t
+ol_tx_sched_fq_codel_flow_hash(
+    struct ol_txrx_pdev_t *pdev,
+    struct ol_tx_frms_queue_t *txq,
+    adf_nbuf_t msdu)
+{
+    struct ol_tx_sched_fq_codel_t *scheduler = pdev->tx_sched.scheduler;
+    u_int8_t *p = adf_nbuf_data(msdu);
+    int len = adf_nbuf_len(msdu);
+    int l2_hdr_size, l4_offset = 0, i;
+    u_int16_t ethertype;
+    u_int8_t ip_prot = 0;
+    u_int32_t hash = scheduler->hash_seed;
+
+    OL_TX_SCHED_FQ_CODEL_HASH_MIX(hash, (unsigned long) txq);
+
+    if (pdev->frame_format == wlan_frm_fmt_802_3) {
+        struct ethernet_hdr_t *enet_hdr = (struct ethernet_hdr_t *) p;
+
+        l2_hdr_size = ETHERNET_HDR_LEN;
+        if (len < l2_hdr_size + LLC_SNAP_HDR_LEN) {
+            goto done;
+        }
+        ethertype = (enet_hdr->ethertype[0] << 8) | enet_hdr->ethertype[1];
+        if (!IS_ETHERTYPE(ethertype)) {
+            /* 802.3 format */
+            struct llc_snap_hdr_t *llc_hdr;
+
+            llc_hdr = (struct llc_snap_hdr_t *) (p + l2_hdr_size);
+            l2_hdr_size += LLC_SNAP_HDR_LEN;
+            ethertype = (llc_hdr->ethertype[0] << 8) | llc_hdr->ethertype[1];
+        }
+    } else {
+        struct llc_snap_hdr_t *llc_hdr;
+        struct ieee80211_frame *wh = (struct ieee80211_frame *) p;
+
+        if (len < sizeof(*wh) ||
+            (wh->i_fc[0] & IEEE80211_FC0_TYPE_MASK) !=
+            IEEE80211_FC0_TYPE_DATA)
+        {
+            goto done;
+        }
+        l2_hdr_size = (pdev->frame_format == wlan_frm_fmt_raw) ?
+            ol_txrx_ieee80211_hdrsize(p) : sizeof(struct ieee80211_frame);
+        if (len < l2_hdr_size + LLC_SNAP_HDR_LEN) {
+            goto done;
+        }
+        llc_hdr = (struct llc_snap_hdr_t *) (p + l2_hdr_size);
+        l2_hdr_size += LLC_SNAP_HDR_LEN;
+        ethertype = (llc_hdr->ethertype[0] << 8) | llc_hdr->ethertype[1];
+    }
+    OL_TX_SCHED_FQ_CODEL_HASH_MIX(hash, ethertype);
+
+    p += l2_hdr_size;
+    len -= l2_hdr_size;
+    if (ethertype == ETHERTYPE_IPV4 && len >= IPV4_HDR_LEN) {
+        struct ipv4_hdr_t *ipv4_hdr = (struct ipv4_hdr_t *) p;
+
+        ip_prot = ipv4_hdr->protocol;
+        for (i = 0; i < IPV4_ADDR_LEN; i++) {
+            OL_TX_SCHED_FQ_CODEL_HASH_MIX(hash,
+                (ipv4_hdr->src_addr[i] << 8) | ipv4_hdr->dst_addr[i]);
+        }
+        /* only the first fragment holds the L4 header */
+        if (((ipv4_hdr->flags_fragoff[0] << 8) |
+             ipv4_hdr->flags_fragoff[1]) & 0x3fff)
+        {
+            ip_prot = 0;
+        }
+        l4_offset = (ipv4_hdr->ver_hdrlen & 0xf) << 2;
+    } else if (ethertype == ETHERTYPE_IPV6 && len >= 40) {
+        /*
+         * Read the IPv6 header by offset: next header at byte 6,
+         * src + dst addresses in bytes 8-39, L4 header at byte 40.
+         */
+        ip_prot = p[6];
+        for (i = 8; i < 40; i += 4) {
+            OL_TX_SCHED_FQ_CODEL_HASH_MIX(hash,
+                (p[i] << 24) | (p[i+1] << 16) | (p[i+2] << 8) | p[i+3]);
+        }
+        l4_offset = 40;
+    }
+    OL_TX_SCHED_FQ_CODEL_HASH_MIX(hash, ip_prot);
+    if ((ip_prot == IP_PROTOCOL_TCP || ip_prot == IP_PROTOCOL_UDP) &&
+        len >= l4_offset + 4)
+    {
+        /* src and dst ports */
+        OL_TX_SCHED_FQ_CODEL_HASH_MIX(hash,
+            (p[l4_offset] << 24) | (p[l4_offset+1] << 16) |
+            (p[l4_offset+2] << 8) | p[l4_offset+3]);
+    }
+
+done:
+    hash ^= hash >> 16;
+    return (u_int8_t) (hash & OL_TX_SCHED_FQ_CODEL_FLOW_MASK);
+}
+
+static inline void
+ol_tx_sched_fq_codel_flow_list_move(
+    struct ol_tx_sched_fq_codel_tid_t *tidq,
+    struct ol_tx_sched_fq_codel_flow_t *flow,
+    enum ol_tx_sched_fq_codel_flow_state state)
+{
+    if (flow->state == ol_tx_sched_fq_codel_flow_new) {
+        TAILQ_REMOVE(&tidq->new_flows, flow, list_elem);
+    } else if (flow->state == ol_tx_sched_fq_codel_flow_old) {
+        TAILQ_REMOVE(&tidq->old_flows, flow, list_elem);
+    }
+    if (state == ol_tx_sched_fq_codel_flow_new) {
+        TAILQ_INSERT_TAIL(&tidq->new_flows, flow, list_elem);
+    } else if (state == ol_tx_sched_fq_codel_flow_old) {
+        TAILQ_INSERT_TAIL(&tidq->old_flows, flow, list_elem);
+    }
+    flow->state = state;
+}
+
+/*
+ * Remove the frame at the head of the flow from both the flow and the
+ * tx queue that holds it.
+ */
+static struct ol_tx_desc_t *
+ol_tx_sched_fq_codel_flow_pop(
+    struct ol_tx_sched_fq_codel_tid_t *tidq,
+    struct ol_tx_sched_fq_codel_flow_t *flow)
+{
+    struct ol_tx_desc_t *tx_desc;
+    struct ol_tx_frms_queue_t *txq;
+    int bytes;
+
+    tx_desc = TAILQ_FIRST(&flow->head);
+    bytes = adf_nbuf_len(tx_desc->netbuf);
+    TAILQ_REMOVE(&flow->head, tx_desc, fq_flow_elem);
+    flow->frms--;
+    flow->bytes -= bytes;
+    tidq->frms--;
+    tidq->bytes -= bytes;
+
+    txq = tx_desc->fq_txq;
+    tx_desc->fq_txq = NULL;
+    TAILQ_REMOVE(&txq->head, tx_desc, tx_desc_list_elem);
+    txq->frms--;
+    txq->bytes -= bytes;
+    /* a paused queue remains paused, regardless of whether it has frames */
+    if (txq->frms == 0 && txq->flag == ol_tx_queue_active) {
+        txq->flag = ol_tx_queue_empty;
+    }
+    return tx_desc;
+}
+
+static u_int32_t
+ol_tx_sched_fq_codel_isqrt(u_int32_t x)
+{
+    u_int32_t root = 0, bit = 1 << 30;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (x >= root + bit) {
+            x -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+/* CoDel control law: next drop time is interval / sqrt(count) later */
+static unsigned long
+ol_tx_sched_fq_codel_control_law(
+    struct ol_tx_sched_fq_codel_t *scheduler,
+    unsigned long t,
+    u_int32_t count)
+{
+    unsigned long delta;
+
+    if (count > 0xffff) {
+        count = 0xffff;
+    }
+    /* scale by 16 (sqrt(256)) to keep some precision */
+    delta = (scheduler->interval_ticks << 4) /
+        ol_tx_sched_fq_codel_isqrt(count << 8);
+    return t + (delta ? delta : 1);
+}
+
+/*
+ * Decide whether the frame just popped from the flow should be dropped,
+ * based on how long it sat in the queue and the flow's CoDel state.
+ */
+static a_bool_t
+ol_tx_sched_fq_codel_should_drop(
+    struct ol_tx_sched_fq_codel_t *scheduler,
+    struct ol_tx_sched_fq_codel_flow_t *flow,
+    unsigned long sojourn_ticks,
+    unsigned long now)
+{
+    a_bool_t ok_to_drop = A_FALSE;
+
+    if (sojourn_ticks < scheduler->target_ticks ||
+        flow->bytes <= OL_TX_SCHED_FQ_CODEL_QUANTUM)
+    {
+        /* went below target - stay below for at least an interval */
+        flow->codel.first_above_time = 0;
+    } else if (flow->codel.first_above_time == 0) {
+        flow->codel.first_above_time = (now + scheduler->interval_ticks) | 1;
+    } else if (adf_os_time_after_eq(now, flow->codel.first_above_time)) {
+        ok_to_drop = A_TRUE;
+    }
+
+    if (flow->codel.dropping) {
+        if (!ok_to_drop) {
+            /* sojourn time below target - leave the dropping state */
+            flow->codel.dropping = A_FALSE;
+            return A_FALSE;
+        }
+        if (adf_os_time_after_eq(now, flow->codel.drop_next)) {
+            flow->codel.count++;
+            flow->codel.drop_next = ol_tx_sched_fq_codel_control_law(
+                scheduler, flow->codel.drop_next, flow->codel.count);
+            return A_TRUE;
+        }
+        return A_FALSE;
+    }
+    if (ok_to_drop) {
+        u_int32_t delta;
+
+        flow->codel.dropping = A_TRUE;
+        /*
+         * If the flow was recently in the dropping state, resume at
+         * (roughly) the drop rate it was using then.
+         */
+        delta = flow->codel.count - flow->codel.last_count;
+        if (delta > 1 &&
+            adf_os_time_before(now, flow->codel.drop_next +
+                (scheduler->interval_ticks << 4)))
+        {
+            flow->codel.count = delta;
+        } else {
+            flow->codel.count = 1;
+        }
+        flow->codel.last_count = flow->codel.count;
+        flow->codel.drop_next = ol_tx_sched_fq_codel_control_law(
+            scheduler, now, flow->codel.count);
+        return A_TRUE;
+    }
+    return A_FALSE;
+}
+
+static inline void
+ol_tx_sched_fq_codel_delay_stats(
+    struct ol_tx_sched_fq_codel_flow_t *flow,
+    unsigned long sojourn_ticks)
+{
+    u_int32_t delay_ms = adf_os_ticks_to_msecs(sojourn_ticks);
+
+    flow->stats.dequeued++;
+    flow->stats.delay_avg_ms =
+        flow->stats.delay_avg_ms - (flow->stats.delay_avg_ms >> 3) +
+        (delay_ms >> 3);
+    if (delay_ms > flow->stats.delay_max_ms) {
+        flow->stats.delay_max_ms = delay_ms;
+    }
+}
+
+/*
+ * Download up to OL_TX_SCHED_FQ_CODEL_SEND_LIMIT frames from a TID,
+ * serving its flows by DRR, and applying CoDel to each frame.
+ * Returns the credit used.
+ */
+static u_int32_t
+ol_tx_sched_fq_codel_tid_dequeue(
+    struct ol_tx_sched_fq_codel_t *scheduler,
+    struct ol_tx_sched_fq_codel_tid_t *tidq,
+    struct ol_tx_sched_ctx *sctx,
+    u_int32_t credit,
+    a_bool_t *credit_exhausted)
+{
+    struct ol_tx_sched_fq_codel_flow_t *flow;
+    struct ol_tx_desc_t *tx_desc;
+    unsigned long now, sojourn_ticks;
+    u_int32_t used_credits = 0;
+    unsigned frame_credit;
+    int frames = 0;
+
+    now = adf_os_ticks();
+    while (frames < OL_TX_SCHED_FQ_CODEL_SEND_LIMIT) {
+        flow = TAILQ_FIRST(&tidq->new_flows);
+        if (!flow) {
+            flow = TAILQ_FIRST(&tidq->old_flows);
+            if (!flow) {
+                break;
+            }
+        }
+        if (flow->deficit <= 0) {
+            flow->deficit += OL_TX_SCHED_FQ_CODEL_QUANTUM;
+            ol_tx_sched_fq_codel_flow_list_move(
+                tidq, flow, ol_tx_sched_fq_codel_flow_old);
+            continue;
+        }
+        tx_desc = TAILQ_FIRST(&flow->head);
+        if (!tx_desc) {
+            /*
+             * A new flow that has emptied goes through the old list once,
+             * so that a flow can't keep new-flow priority by sending
+             * just under a quantum at a time.
+             */
+            if (flow->state == ol_tx_sched_fq_codel_flow_new &&
+                !TAILQ_EMPTY(&tidq->old_flows))
+            {
+                ol_tx_sched_fq_codel_flow_list_move(
+                    tidq, flow, ol_tx_sched_fq_codel_flow_old);
+            } else {
+                ol_tx_sched_fq_codel_flow_list_move(
+                    tidq, flow, ol_tx_sched_fq_codel_flow_idle);
+            }
+            continue;
+        }
+        frame_credit = htt_tx_msdu_credit(tx_desc->netbuf);
+        if (used_credits + frame_credit > credit) {
+            *credit_exhausted = A_TRUE;
+            break;
+        }
+        sojourn_ticks = now - tx_desc->fq_enqueue_ticks;
+        tx_desc = ol_tx_sched_fq_codel_flow_pop(tidq, flow);
+        if (ol_tx_sched_fq_codel_should_drop(
+                scheduler, flow, sojourn_ticks, now))
+        {
+            flow->stats.codel_drops++;
+            TAILQ_INSERT_TAIL(&sctx->drop_head, tx_desc, tx_desc_list_elem);
+            sctx->drop_frms++;
+            continue;
+        }
+        ol_tx_sched_fq_codel_delay_stats(flow, sojourn_ticks);
+        flow->deficit -= adf_nbuf_len(tx_desc->netbuf);
+        TAILQ_INSERT_TAIL(&sctx->head, tx_desc, tx_desc_list_elem);
+        used_credits += frame_credit;
+        frames++;
+    }
+    sctx->frms += frames;
+    return used_credits;
+}
+
+/*
+ * The scheduler sync spinlock has been acquired outside this function,
+ * so there is no need to worry about mutex within this function.
+ */
+static int
+ol_tx_sched_select_batch_fq_codel(
+    struct ol_txrx_pdev_t *pdev,
+    struct ol_tx_sched_ctx *sctx,
+    u_int32_t credit)
+{
+    struct ol_tx_sched_fq_codel_t *scheduler = pdev->tx_sched.scheduler;
+    struct ol_tx_sched_fq_codel_tid_t *tidq;
+    a_bool_t credit_exhausted = A_FALSE;
+    u_int32_t used_credits = 0;
+
+    TX_SCHED_DEBUG_PRINT("Enter %s\n", __func__);
+    /*
+     * Keep going until some credit is used, since a TID whose frames
+     * were all dropped by CoDel doesn't end the scheduling round.
+     */
+    while (used_credits == 0 && !credit_exhausted) {
+        tidq = TAILQ_FIRST(&scheduler->active_tids);
+        if (!tidq) {
+            break;
+        }
+        TAILQ_REMOVE(&scheduler->active_tids, tidq, list_elem);
+        tidq->active = A_FALSE;
+
+        used_credits = ol_tx_sched_fq_codel_tid_dequeue(
+            scheduler, tidq, sctx, credit, &credit_exhausted);
+
+        if (tidq->frms > 0) {
+            TAILQ_INSERT_TAIL(&scheduler->active_tids, tidq, list_elem);
+            tidq->active = A_TRUE;
+        }
+    }
+    TX_SCHED_DEBUG_PRINT("Leave %s\n", __func__);
+    return used_credits;
+}
+
+/*
+ * Link the last frms frames of the tx queue into their flows.
+ * This covers both a single new frame, and all frames of a tx queue
+ * that is being unpaused.
+ */
+static inline void
+ol_tx_sched_txq_enqueue_fq_codel(
+    struct ol_txrx_pdev_t *pdev,
+    struct ol_tx_frms_queue_t *txq,
+    int tid,
+    int frms,
+    int bytes)
+{
+    struct ol_tx_sched_fq_codel_t *scheduler = pdev->tx_sched.scheduler;
+    struct ol_tx_sched_fq_codel_tid_t *tidq;
+    struct ol_tx_sched_fq_codel_flow_t *flow;
+    struct ol_tx_desc_t *tx_desc;
+    unsigned long now;
+    int i;
+
+    tidq = &scheduler->tids[tid];
+    tx_desc = TAILQ_LAST(&txq->head, ol_tx_desc_list_s);
+    for (i = 1; i < frms && tx_desc; i++) {
+        tx_desc = TAILQ_PREV(tx_desc, ol_tx_desc_list_s, tx_desc_list_elem);
+    }
+    /*
+     * Time spent in a paused tx queue is not scheduler queuing delay,
+     * so (re)start the sojourn time of every frame linked in here.
+     */
+    now = adf_os_ticks();
+    for (; tx_desc; tx_desc = TAILQ_NEXT(tx_desc, tx_desc_list_elem)) {
+        tx_desc->fq_flow =
+            ol_tx_sched_fq_codel_flow_hash(pdev, txq, tx_desc->netbuf);
+        tx_desc->fq_txq = txq;
+        tx_desc->fq_enqueue_ticks = now;
+        flow = &tidq->flows[tx_desc->fq_flow];
+        TAILQ_INSERT_TAIL(&flow->head, tx_desc, fq_flow_elem);
+        flow->frms++;
+        flow->bytes += adf_nbuf_len(tx_desc->netbuf);
+        if (flow->state == ol_tx_sched_fq_codel_flow_idle) {
+            flow->deficit = OL_TX_SCHED_FQ_CODEL_QUANTUM;
+            ol_tx_sched_fq_codel_flow_list_move(
+                tidq, flow, ol_tx_sched_fq_codel_flow_new);
+        }
+    }
+    tidq->frms += frms;
+    tidq->bytes += bytes;
+    if (!tidq->active) {
+        TAILQ_INSERT_TAIL(&scheduler->active_tids, tidq, list_elem);
+        tidq->active = A_TRUE;
+    }
+}
+
+/*
+ * Unlink all of the tx queue's frames from their flows.
+ * The frames themselves stay in the tx queue.
+ */
+static inline void
+ol_tx_sched_txq_deactivate_fq_codel(
+    struct ol_txrx_pdev_t *pdev,
+    struct ol_tx_frms_queue_t *txq,
+    int tid)
+{
+    struct ol_tx_sched_fq_codel_t *scheduler = pdev->tx_sched.scheduler;
+    struct ol_tx_sched_fq_codel_tid_t *tidq;
+    struct ol_tx_sched_fq_codel_flow_t *flow;
+    struct ol_tx_desc_t *tx_desc;
+    int bytes;
+
+    tidq = &scheduler->tids[tid];
+    TAILQ_FOREACH(tx_desc, &txq->head, tx_desc_list_elem) {
+        if (tx_desc->fq_txq != txq) {
+            continue;
+        }
+        bytes = adf_nbuf_len(tx_desc->netbuf);
+        flow = &tidq->flows[tx_desc->fq_flow];
+        TAILQ_REMOVE(&flow->head, tx_desc, fq_flow_elem);
+        tx_desc->fq_txq = NULL;
+        flow->frms--;
+        flow->bytes -= bytes;
+        tidq->frms--;
+        tidq->bytes -= bytes;
+        if (flow->frms == 0) {
+            ol_tx_sched_fq_codel_flow_list_move(
+                tidq, flow, ol_tx_sched_fq_codel_flow_idle);
+        }
+    }
+    if (tidq->frms == 0 && tidq->active) {
+        TAILQ_REMOVE(&scheduler->active_tids, tidq, list_elem);
+        tidq->active = A_FALSE;
+    }
+}
+
+/*
+ * Under tx descriptor pressure, discard from the head of the flow with
+ * the largest (weighted) byte backlog, across all TIDs, rather than
+ * from a whole category.
+ * The caller holds the tx queue spinlock.
+ */
+u_int16_t
+ol_tx_sched_discard_select(
+    struct ol_txrx_pdev_t *pdev,
+    u_int16_t frms,
+    ol_tx_desc_list *tx_descs,
+    a_bool_t force)
+{
+    struct ol_tx_sched_fq_codel_t *scheduler = pdev->tx_sched.scheduler;
+    struct ol_tx_sched_fq_codel_tid_t *tidq, *selected_tidq = NULL;
+    struct ol_tx_sched_fq_codel_flow_t *flow, *selected_flow = NULL;
+    struct ol_tx_desc_t *tx_desc;
+    u_int32_t score, max_score = 0;
+    u_int16_t discarded;
+
+    TAILQ_FOREACH(tidq, &scheduler->active_tids, list_elem) {
+        int i;
+        for (i = 0; i < OL_TX_SCHED_FQ_CODEL_NUM_FLOWS; i++) {
+            flow = &tidq->flows[i];
+            score = flow->bytes * tidq->discard_weight;
+            if (flow->frms > 0 && score > max_score) {
+                max_score = score;
+                selected_tidq = tidq;
+                selected_flow = flow;
+            }
+        }
+    }
+    if (!selected_flow) {
+        /* No More pending Tx Packets in Tx Queue. Exit Discard loop */
+        return 0;
+    }
+    flow = selected_flow;
+    tidq = selected_tidq;
+
+    if (force == A_FALSE) {
+        /*
+         * As for the other schedulers, don't discard more than a fixed
+         * quantum of frames, or more than 50% of the flow's frames, at a
+         * time, but if there's only 1 frame left, go ahead and discard it.
+         */
+        #define OL_TX_DISCARD_QUANTUM 10
+        if (OL_TX_DISCARD_QUANTUM < frms) {
+            frms = OL_TX_DISCARD_QUANTUM;
+        }
+        if (flow->frms > 1 && frms >= (flow->frms >> 1)) {
+            frms = flow->frms >> 1;
+        }
+    }
+    if (frms > flow->frms) {
+        frms = flow->frms;
+    }
+
+    /* front-drop, for the same reasons as the other schedulers */
+    for (discarded = 0; discarded < frms; discarded++) {
+        tx_desc = ol_tx_sched_fq_codel_flow_pop(tidq, flow);
+        TAILQ_INSERT_TAIL(tx_descs, tx_desc, tx_desc_list_elem);
+    }
+    flow->stats.discards += discarded;
+    /*
+     * Leave an emptied flow in its list - the DRR loop retires it.
+     * But if the whole TID is empty, take it off the active list.
+     */
+    if (tidq->frms == 0) {
+        TAILQ_REMOVE(&scheduler->active_tids, tidq, list_elem);
+        tidq->active = A_FALSE;
+    }
+
+    TX_SCHED_DEBUG_PRINT("%s Tx Drop : %d\n",__func__,discarded);
+    return discarded;
+}
+
+void
+ol_tx_sched_category_info_fq_codel(
+    struct ol_txrx_pdev_t *pdev, int cat, int *active, int *frms, int *bytes)
+{
+    struct ol_tx_sched_fq_codel_t *scheduler = pdev->tx_sched.scheduler;
+    struct ol_tx_sched_fq_codel_tid_t *tidq;
+
+    tidq = &scheduler->tids[cat];
+    *active = tidq->active;
+    *frms = tidq->frms;
+    *bytes = tidq->bytes;
+}
+
+void *
+ol_tx_sched_init_fq_codel(
+  struct ol_txrx_pdev_t *pdev)
+{
+    struct ol_tx_sched_fq_codel_t *scheduler;
+    struct ol_tx_sched_fq_codel_tid_t *tidq;
+    int i, j;
+
+    scheduler = adf_os_mem_alloc(
+        pdev->osdev, sizeof(struct ol_tx_sched_fq_codel_t));
+    if (scheduler == NULL) {
+        return scheduler;
+    }
+    adf_os_mem_zero(scheduler, sizeof(*scheduler));
+
+    TAILQ_INIT(&scheduler->active_tids);
+    for (i = 0; i < OL_TX_SCHED_FQ_CODEL_NUM_TIDS; i++) {
+        tidq = &scheduler->tids[i];
+        TAILQ_INIT(&tidq->new_flows);
+        TAILQ_INIT(&tidq->old_flows);
+        for (j = 0; j < OL_TX_SCHED_FQ_CODEL_NUM_FLOWS; j++) {
+            TAILQ_INIT(&tidq->flows[j].head);
+            tidq->flows[j].state = ol_tx_sched_fq_codel_flow_idle;
+        }
+        if (i < OL_TX_NON_QOS_TID) {
+            switch (TXRX_TID_TO_WMM_AC(i)) {
+            case TXRX_WMM_AC_VO:
+                tidq->discard_weight =
+                    ol_tx_sched_fq_codel_discard_weight_voice;
+                break;
+            case TXRX_WMM_AC_VI:
+                tidq->discard_weight =
+                    ol_tx_sched_fq_codel_discard_weight_video;
+                break;
+            default:
+                tidq->discard_weight =
+                    ol_tx_sched_fq_codel_discard_weight_ucast_default;
+                break;
+            }
+        } else if (i < OL_TX_NUM_TIDS) {
+            tidq->discard_weight =
+                ol_tx_sched_fq_codel_discard_weight_mgmt_non_qos;
+        } else {
+            tidq->discard_weight = ol_tx_sched_fq_codel_discard_weight_mcast;
+        }
+    }
+    /* perturb the flow hash, so flow collisions aren't predictable */
+    scheduler->hash_seed = (u_int32_t) adf_os_ticks() ^ (u_int32_t)
+        (unsigned long) scheduler;
+    scheduler->target_ticks =
+        adf_os_msecs_to_ticks(OL_TX_SCHED_FQ_CODEL_TARGET_MS);
+    if (scheduler->target_ticks == 0) {
+        scheduler->target_ticks = 1;
+    }
+    scheduler->interval_ticks =
+        adf_os_msecs_to_ticks(OL_TX_SCHED_FQ_CODEL_INTERVAL_MS);
+
+    return scheduler;
+}
+
+void
+ol_tx_sched_stats_display(struct ol_txrx_pdev_t *pdev)
+{
+    struct ol_tx_sched_fq_codel_t *scheduler = pdev->tx_sched.scheduler;
+    struct ol_tx_sched_fq_codel_flow_t *flow;
+    int i, j;
+
+    if (!scheduler) {
+        return;
+    }
+    VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_INFO,
+        "  tx sched fq-codel (target %d ms, interval %d ms):\n",
+        OL_TX_SCHED_FQ_CODEL_TARGET_MS, OL_TX_SCHED_FQ_CODEL_INTERVAL_MS);
+    adf_os_spin_lock_bh(&pdev->tx_queue_spinlock);
+    for (i = 0; i < OL_TX_SCHED_FQ_CODEL_NUM_TIDS; i++) {
+        for (j = 0; j < OL_TX_SCHED_FQ_CODEL_NUM_FLOWS; j++) {
+            flow = &scheduler->tids[i].flows[j];
+            if (flow->stats.dequeued == 0 && flow->frms == 0 &&
+                flow->stats.discards == 0)
+            {
+                continue;
+            }
+            VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_INFO,
+                "    tid %2d flow %2d: %u frms queued, %u sent, "
+                "delay avg %u ms max %u ms, "
+                "codel drops %u, discards %u\n",
+                i, j, flow->frms, flow->stats.dequeued,
+                flow->stats.delay_avg_ms, flow->stats.delay_max_ms,
+                flow->stats.codel_drops, flow->stats.discards);
+        }
+    }
+    adf_os_spin_unlock_bh(&pdev->tx_queue_spinlock);
+}
+
+void
+ol_txrx_set_wmm_param(ol_txrx_pdev_handle data_pdev, struct ol_tx_wmm_param_t wmm_param)
+{
+    VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_INFO_LOW,
+        "Dummy function when OL_TX_SCHED_FQ_CODEL is enabled\n");
+}
+
+#endif /* OL_TX_SCHED == OL_TX_SCHED_FQ_CODEL */
+
 /*--- congestion control discard --------------------------------------------*/
 
+#if OL_TX_SCHED != OL_TX_SCHED_FQ_CODEL
+
 struct ol_tx_frms_queue_t *
 ol_tx_sched_discard_select_txq(
     struct ol_txrx_pdev_t *pdev,
@@ -1124,6 +2083,8 @@ ol_tx_sched_discard_select(
     return frms;
 }
 
+#endif /* OL_TX_SCHED != OL_TX_SCHED_FQ_CODEL */
+
 /*--- scheduler framework ---------------------------------------------------*/
 
 /*
@@ -1290,6 +2251,10 @@ ol_tx_sched(struct ol_txrx_pdev_t *pdev)
 
     TAILQ_INIT(&sctx.head);
     sctx.frms = 0;
+#if defined(QCA_TX_SCHED_FQ_CODEL)
+    TAILQ_INIT(&sctx.drop_head);
+    sctx.drop_frms = 0;
+#endif
 
     ol_tx_sched_select_init(pdev);
     while (adf_os_atomic_read(&pdev->target_tx_credit) > 0) {
@@ -1312,6 +2277,13 @@ ol_tx_sched(struct ol_txrx_pdev_t *pdev)
         if (num_credits == 0) break;
     }
     ol_tx_sched_dispatch(pdev, &sctx);
+#if defined(QCA_TX_SCHED_FQ_CODEL)
+    if (sctx.drop_frms) {
+        /* return the tx descriptors of the frames CoDel dropped */
+        adf_os_atomic_add(sctx.drop_frms, &pdev->tx_queue.rsrc_cnt);
+        ol_tx_desc_frame_list_free(pdev, &sctx.drop_head, 1 /* error */);
+    }
+#endif
 
     adf_os_spin_lock_bh(&pdev->tx_queue_spinlock);
     //adf_os_print("AFTER tx sched:\n");
@@ -75,6 +75,13 @@ ol_tx_sched_attach(struct ol_txrx_pdev_t *pdev);
 void
 ol_tx_sched_detach(struct ol_txrx_pdev_t *pdev);
 
+#if defined(QCA_TX_SCHED_FQ_CODEL) || defined(QCA_SUPPORT_TX_AIRTIME_FAIRNESS)
+void
+ol_tx_sched_stats_display(struct ol_txrx_pdev_t *pdev);
+#else
+#define ol_tx_sched_stats_display(pdev) /* no-op */
+#endif
+
 #else
 
 #define ol_tx_notify_sched(pdev, ctx) /* no-op */
@@ -82,6 +89,7 @@ ol_tx_sched_detach(struct ol_txrx_pdev_t *pdev);
 #define ol_tx_sched_discard_select(pdev, frms, tx_descs, force) 0
 #define ol_tx_sched_attach(pdev) NULL
 #define ol_tx_sched_detach(pdev) /* no-op */
+#define ol_tx_sched_stats_display(pdev) /* no-op */
 
 #endif /* defined(CONFIG_HL_SUPPORT) */
 
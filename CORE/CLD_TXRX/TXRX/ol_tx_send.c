@@ -117,7 +117,8 @@ do {
         if (adf_os_atomic_read(&vdev->os_q_paused) &&                            \
                           (vdev->tx_fl_hwm != 0)) {                               \
             adf_os_spin_lock(&pdev->tx_mutex);                                    \
-            if (pdev->tx_desc.num_free > vdev->tx_fl_hwm) {                       \
+            if (ol_tx_desc_num_allocatable(pdev) > vdev->tx_fl_hwm &&             \
+                OL_TX_BQL_AVAIL(vdev)) {                                          \
                adf_os_atomic_set(&vdev->os_q_paused, 0);                          \
                adf_os_spin_unlock(&pdev->tx_mutex);                               \
                vdev->osif_flow_control_cb(vdev->osif_dev,                         \
@@ -196,6 +197,17 @@ ol_tx_send(
     }
 }
 
+void
+ol_tx_send_batch_prep(
+    struct ol_txrx_pdev_t *pdev,
+    struct ol_tx_desc_t *tx_desc,
+    adf_nbuf_t msdu)
+{
+    ol_tx_send_base(pdev, tx_desc, msdu);
+    /* htt_tx_send_batch finds the frame's desc ID in the netbuf headroom */
+    *ol_tx_msdu_id_storage(msdu) = ol_tx_desc_id(pdev, tx_desc);
+}
+
 void
 ol_tx_send_batch(
     struct ol_txrx_pdev_t *pdev,
@@ -388,6 +400,7 @@ ol_tx_delay_compute(
 #define ol_tx_msdu_complete_single(_pdev, _tx_desc, _netbuf, _lcl_freelist, _tx_desc_last)      \
         do {                                                                                    \
                 adf_os_atomic_init(&(_tx_desc)->ref_cnt); /* clear the ref cnt */               \
+                OL_TX_DESC_BQL_UNCHARGE((_pdev), (_tx_desc));                                   \
                 OL_TX_RESTORE_HDR((_tx_desc), (_netbuf)); /* restore orginal hdr offset */      \
                 adf_nbuf_unmap((_pdev)->osdev, (_netbuf), ADF_OS_DMA_TO_DEVICE);                \
                 adf_nbuf_free((_netbuf));                                                       \
@@ -401,6 +414,7 @@ ol_tx_delay_compute(
 
 #define ol_tx_msdu_complete_single(_pdev, _tx_desc, _netbuf, _lcl_freelist, _tx_desc_last)      \
         do {                                                                                    \
+                OL_TX_DESC_BQL_UNCHARGE((_pdev), (_tx_desc));                                   \
                 OL_TX_RESTORE_HDR((_tx_desc), (_netbuf)); /* restore orginal hdr offset */      \
                 adf_nbuf_unmap((_pdev)->osdev, (_netbuf), ADF_OS_DMA_TO_DEVICE);                \
                 adf_nbuf_free((_netbuf));                                                       \
@@ -562,10 +576,12 @@ ol_tx_completion_handler(
         OL_TX_TARGET_CREDIT_ADJUST(num_msdus, pdev, NULL);
     }
 
+    OL_TX_BQL_UPDATE(pdev);
     /* UNPAUSE OS Q */
     OL_TX_FLOW_CT_UNPAUSE_OS_Q(pdev);
     /* Do one shot statistics */
     TXRX_STATS_UPDATE_TX_STATS(pdev, status, num_msdus, byte_cnt);
+    TXRX_STATS_TX_COMPL_HIST(pdev, num_msdus);
 }
 
 /*
@@ -684,6 +700,7 @@ ol_tx_inspect_handler(
     } else {
         OL_TX_TARGET_CREDIT_ADJUST(num_msdus, pdev, NULL) ;
     }
+    OL_TX_BQL_UPDATE(pdev);
 }
 
 #ifdef QCA_COMPUTE_TX_DELAY
@@ -62,6 +62,23 @@ ol_tx_send(
     struct ol_tx_desc_t *tx_desc,
     adf_nbuf_t msdu);
 
+/**
+ * @brief Get a tx frame ready to be downloaded as part of a batch.
+ * @details
+ *  Do the per-frame bookkeeping that ol_tx_send does before the
+ *  download, and store the tx descriptor ID with the frame, so the
+ *  frame can then be handed to ol_tx_send_batch.
+ *
+ * @param pdev - the phy dev
+ * @param tx_desc - the tx descriptor for the frame
+ * @param msdu - the tx frame
+ */
+void
+ol_tx_send_batch_prep(
+    struct ol_txrx_pdev_t *pdev,
+    struct ol_tx_desc_t *tx_desc,
+    adf_nbuf_t msdu);
+
 /**
  * @brief Send a tx batch download to the target.
  * @details
@@ -73,7 +90,7 @@ ol_tx_send(
  * @param num_msdus - Total msdus chained in msdu_list
  */
 
-int
+void
 ol_tx_send_batch(
     struct ol_txrx_pdev_t *pdev,
     adf_nbuf_t msdu_list, int num_msdus);
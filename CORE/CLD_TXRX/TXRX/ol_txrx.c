@@ -367,6 +367,9 @@ ol_txrx_pdev_attach(
         }
         pdev->tx_desc.array[i].tx_desc.htt_tx_desc = htt_tx_desc;
 	pdev->tx_desc.array[i].tx_desc.htt_tx_desc_paddr = paddr_lo;
+#ifdef QCA_LL_TX_BQL
+        pdev->tx_desc.array[i].tx_desc.bql_vdev_id = OL_TX_BQL_VDEV_ID_NONE;
+#endif
 #ifdef QCA_SUPPORT_TXDESC_SANITY_CHECKS
         pdev->tx_desc.array[i].tx_desc.pkt_type = 0xff;
 #ifdef QCA_COMPUTE_TX_DELAY
@@ -387,6 +390,10 @@ ol_txrx_pdev_attach(
     }
     pdev->tx_desc.array[i].next = NULL;
 
+    if (ol_tx_desc_cache_attach(pdev)) {
+        goto fail5;
+    }
+
     /* check what format of frames are expected to be delivered by the OS */
     pdev->frame_format = ol_cfg_frame_type(pdev->ctrl_pdev);
     if (pdev->frame_format == wlan_frm_fmt_native_wifi) {
@@ -653,6 +660,9 @@ ol_txrx_pdev_attach(
 #ifdef QCA_SUPPORT_TX_THROTTLE
     /* Thermal Mitigation */
     ol_tx_throttle_init(pdev);
+#endif
+#ifdef QCA_LL_TX_BQL
+    ol_tx_bql_attach(pdev);
 #endif
     return pdev; /* success */
 
@@ -674,6 +684,7 @@ fail6:
     }
 
 fail5:
+    ol_tx_desc_cache_detach(pdev);
     for (i = 0; i < desc_pool_size; i++) {
         htt_tx_desc_free(
             pdev->htt_pdev, pdev->tx_desc.array[i].tx_desc.htt_tx_desc);
@@ -769,6 +780,7 @@ ol_txrx_pdev_detach(ol_txrx_pdev_handle pdev, int force)
         htt_tx_desc_free(pdev->htt_pdev, htt_tx_desc);
     }
 
+    ol_tx_desc_cache_detach(pdev);
     adf_os_mem_free(pdev->tx_desc.array);
 
 #ifdef IPA_UC_OFFLOAD
@@ -850,6 +862,8 @@ ol_txrx_vdev_attach(
 
     TAILQ_INIT(&vdev->peer_list);
     vdev->last_real_peer = NULL;
+    vdev->last_hit_peer = NULL;
+    adf_os_mem_zero(&vdev->fwd_stats, sizeof(vdev->fwd_stats));
 
     #if defined(CONFIG_HL_SUPPORT) && defined(FEATURE_WLAN_TDLS)
     vdev->hlTdlsFlag = false;
@@ -872,6 +886,9 @@ ol_txrx_vdev_attach(
             vdev->txqs[i].flag = ol_tx_queue_empty;
             /* aggregation is not applicable for vdev tx queues */
             vdev->txqs[i].aggr_state = ol_tx_aggr_disabled;
+#if defined(QCA_SUPPORT_TX_AIRTIME_FAIRNESS)
+            vdev->txqs[i].airtime_deficit = 0;
+#endif
         }
     }
     #endif /* defined(CONFIG_HL_SUPPORT) */
@@ -894,6 +911,9 @@ ol_txrx_vdev_attach(
     /* Default MAX Q depth for every VDEV */
     vdev->ll_pause.max_q_depth =
         ol_tx_cfg_max_tx_queue_depth_ll(vdev->pdev->ctrl_pdev);
+#ifdef QCA_LL_TX_BQL
+    ol_tx_bql_vdev_reset(pdev, vdev_id);
+#endif
     /* add this vdev into the pdev's list */
     TAILQ_INSERT_TAIL(&pdev->vdev_list, vdev, vdev_list_elem);
 
@@ -1288,6 +1308,29 @@ ol_txrx_peer_state_update(ol_txrx_pdev_handle pdev, u_int8_t *peer_mac,
     peer->state = state;
 }
 
+#if defined(CONFIG_HL_SUPPORT) && defined(QCA_SUPPORT_TX_AIRTIME_FAIRNESS)
+void
+ol_txrx_peer_tx_rate_update(ol_txrx_pdev_handle pdev, u_int8_t *peer_mac,
+                            u_int32_t rate_kbps)
+{
+    struct ol_txrx_peer_t *peer;
+
+    peer = ol_txrx_peer_find_hash_find(pdev, peer_mac, 0, 1);
+    if (!peer) {
+        return;
+    }
+    if (peer->tx_airtime.rate_kbps != rate_kbps) {
+        TXRX_PRINT(TXRX_PRINT_LEVEL_INFO2,
+            "%s: peer %02x:%02x:%02x:%02x:%02x:%02x tx rate %u -> %u kbps\n",
+            __func__, peer_mac[0], peer_mac[1], peer_mac[2],
+            peer_mac[3], peer_mac[4], peer_mac[5],
+            peer->tx_airtime.rate_kbps, rate_kbps);
+        peer->tx_airtime.rate_kbps = rate_kbps;
+    }
+    ol_txrx_peer_unref_delete(peer);
+}
+#endif
+
 void
 ol_txrx_peer_keyinstalled_state_update(
     struct ol_txrx_peer_t *peer,
@@ -1551,7 +1594,8 @@ ol_txrx_peer_unref_delete(ol_txrx_peer_handle peer)
             }
         }
 
-        adf_os_mem_free(peer);
+        /* lockless lookups may still be looking at the peer */
+        ol_txrx_peer_find_free(peer);
     } else {
         adf_os_spin_unlock_bh(&pdev->peer_ref_mutex);
     }
@@ -1628,7 +1672,7 @@ ol_txrx_get_tx_pending(ol_txrx_pdev_handle pdev_handle)
         total = ol_cfg_target_tx_credit(pdev->ctrl_pdev);
     }
 
-    return (total - pdev->tx_desc.num_free);
+    return (total - ol_tx_desc_num_avail(pdev));
 }
 
 void
@@ -2031,6 +2075,29 @@ ol_txrx_stats_display(ol_txrx_pdev_handle pdev)
             pdev->stats.pub.tx.dropped.no_ack.pkts,
             pdev->stats.pub.tx.dropped.no_ack.bytes);
     }
+    VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_INFO,
+        "    msdus per tx compl: 1: %u, 2-3: %u, 4-7: %u, 8-15: %u, "
+        "16-31: %u, 32-63: %u, 64-127: %u, 128+: %u\n",
+        pdev->stats.priv.tx.compl_hist[0],
+        pdev->stats.priv.tx.compl_hist[1],
+        pdev->stats.priv.tx.compl_hist[2],
+        pdev->stats.priv.tx.compl_hist[3],
+        pdev->stats.priv.tx.compl_hist[4],
+        pdev->stats.priv.tx.compl_hist[5],
+        pdev->stats.priv.tx.compl_hist[6],
+        pdev->stats.priv.tx.compl_hist[7]);
+#ifdef QCA_SUPPORT_TX_DESC_PERCPU_CACHE
+    VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_INFO,
+        "  tx desc: %d of %d free (%d in pdev freelist)\n",
+        ol_tx_desc_num_avail(pdev), pdev->tx_desc.pool_size,
+        pdev->tx_desc.num_free);
+    ol_tx_desc_cache_stats_display(pdev);
+#endif
+#ifdef QCA_LL_TX_BQL
+    ol_tx_bql_stats_display(pdev);
+#endif
+    ol_tx_sched_stats_display(pdev);
+    ol_txrx_peer_find_stats_display(pdev);
     VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_INFO,
         "  rx: %lld ppdus, %lld mpdus, %lld msdus, %lld bytes, %lld errs\n",
         pdev->stats.priv.rx.normal.ppdus,
@@ -2038,12 +2105,30 @@ ol_txrx_stats_display(ol_txrx_pdev_handle pdev)
         pdev->stats.pub.rx.delivered.pkts,
         pdev->stats.pub.rx.delivered.bytes,
         pdev->stats.priv.rx.err.mpdu_bad);
+    VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_INFO,
+        "    mpdus held per reorder store: 1: %u, 2-3: %u, 4-7: %u, "
+        "8-15: %u, 16-31: %u, 32-63: %u, 64: %u (max %u)\n",
+        pdev->stats.priv.rx.reorder.depth_hist[0],
+        pdev->stats.priv.rx.reorder.depth_hist[1],
+        pdev->stats.priv.rx.reorder.depth_hist[2],
+        pdev->stats.priv.rx.reorder.depth_hist[3],
+        pdev->stats.priv.rx.reorder.depth_hist[4],
+        pdev->stats.priv.rx.reorder.depth_hist[5],
+        pdev->stats.priv.rx.reorder.depth_hist[6],
+        pdev->stats.priv.rx.reorder.depth_max);
+    VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_INFO,
+        "    reorder timeout flushes: %u (%lld mpdus)\n",
+        pdev->stats.priv.rx.reorder.timeout_flushes,
+        pdev->stats.priv.rx.reorder.timeout_flush_mpdus);
+    htt_rx_in_order_lookup_stats_display(pdev->htt_pdev);
+    htt_rx_buf_recycle_stats_display(pdev->htt_pdev);
     if (TXRX_STATS_LEVEL == TXRX_STATS_LEVEL_FULL) {
         VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_INFO,
             "    forwarded %lld msdus, %lld bytes\n",
             pdev->stats.pub.rx.forwarded.pkts,
             pdev->stats.pub.rx.forwarded.bytes);
     }
+    ol_rx_fwd_stats_display(pdev);
 }
 
 int
@@ -2110,8 +2195,41 @@ ol_txrx_get_tx_resource(
     unsigned int high_watermark_offset
 )
 {
+   /*
+    * This is called for every frame the OS hands down, so check the
+    * free descriptor count without the lock first; only the pause
+    * decision needs to be made under tx_mutex.
+    * A zero low watermark means HDD has turned flow control off (e.g. SCC
+    * concurrency). Nothing would unpause the OS queue then, since
+    * OL_TX_FLOW_CT_UNPAUSE_OS_Q skips vdevs with a zero high watermark,
+    * so the byte queue limit must not stop it either.
+    */
+   if (adf_os_likely(0 == low_watermark ||
+                     (ol_tx_desc_num_allocatable(vdev->pdev) >=
+                      (u_int16_t)low_watermark && OL_TX_BQL_AVAIL(vdev)))) {
+      return A_TRUE;
+   }
+
    adf_os_spin_lock_bh(&vdev->pdev->tx_mutex);
-   if (vdev->pdev->tx_desc.num_free < (u_int16_t)low_watermark) {
+#ifdef QCA_LL_TX_BQL
+   /*
+    * Stop the OS queue once the vdev has a full byte queue limit's worth
+    * of frames with the target, so the backlog builds up in the qdisc
+    * rather than in the target.
+    * Recheck under tx_mutex, which OL_TX_FLOW_CT_UNPAUSE_OS_Q also holds,
+    * so a completion batch cannot slip in between and miss the wakeup.
+    */
+   if (!OL_TX_BQL_AVAIL(vdev)) {
+      vdev->tx_fl_lwm = (u_int16_t)low_watermark;
+      vdev->tx_fl_hwm = (u_int16_t)(low_watermark + high_watermark_offset);
+      vdev->pdev->tx_bql[vdev->vdev_id].over_limit = 1;
+      vdev->pdev->tx_bql[vdev->vdev_id].stats.stops++;
+      adf_os_atomic_set(&vdev->os_q_paused, 1);
+      adf_os_spin_unlock_bh(&vdev->pdev->tx_mutex);
+      return A_FALSE;
+   }
+#endif
+   if (ol_tx_desc_num_allocatable(vdev->pdev) < (u_int16_t)low_watermark) {
       vdev->tx_fl_lwm = (u_int16_t)low_watermark;
       vdev->tx_fl_hwm = (u_int16_t)(low_watermark + high_watermark_offset);
       /* Not enough free resource, stop TX OS Q */
@@ -460,16 +460,10 @@ ol_rx_decap_subfrm_amsdu(
     else if (pdev->frame_format == wlan_frm_fmt_802_3) {
         if (pdev->sw_rx_llc_proc_enable)  {
              /* remove llc snap hdr if it's necessary according to
-             * 802.11 table P-3
+             * 802.11 table P-3 - done in place, the subframe header
+             * already holds everything the 802.3 header needs
              */
-            adf_os_mem_copy(ether_hdr,
-                            subfrm_hdr,
-                            ETHERNET_HDR_LEN);
-            adf_nbuf_pull_head(msdu, ETHERNET_HDR_LEN);
-            ol_rx_decap_to_8023(vdev,
-                                msdu,
-                                info,
-                                ether_hdr);
+            return ol_rx_decap_subfrm_8023_inplace(msdu);
         }
         else {
             /* subfrm of A-MSDU is already in 802.3 format.
@@ -32,6 +32,67 @@
 #ifndef _OL_TXRX_ENCAP__H_
 #define _OL_TXRX_ENCAP__H_
 
+#include <adf_nbuf.h>    /* adf_nbuf_t */
+#include <adf_os_mem.h>  /* adf_os_mem_move */
+#include <athdefs.h>     /* A_STATUS */
+#include <enet.h>        /* struct llc_snap_hdr_t, IS_SNAP, etc. */
+
+/**
+ * @brief Convert an A-MSDU subframe to an 802.3 / Ethernet II frame in place
+ * @details
+ *  An A-MSDU subframe starts with DA, SA and a length field, followed by
+ *  the LLC/SNAP header.  If the SNAP header is to be removed (802.11
+ *  table P-3), the SNAP ethertype already sits where the Ethernet type
+ *  field of the decapped frame belongs, so only the 12 address bytes are
+ *  moved forward over the LLC and the buffer head is pulled - no header
+ *  is staged in a local buffer and the payload is never touched.
+ *  Otherwise (no SNAP header, a non-RFC1042/BTEP one, AARP or IPX, or a
+ *  subframe shorter than an LLC/SNAP header) the frame stays 802.3 and,
+ *  as in ol_rx_decap_to_8023, the type field is set to the frame length
+ *  (the subframe length less the 14 byte header).
+ * @param msdu - the subframe, with its data pointing at the DA
+ * @return
+ *     A_OK: decap operation sucessful
+ *     other: the subframe is shorter than an Ethernet header, the msdu
+ *            need be dropped.
+ */
+static inline A_STATUS
+ol_rx_decap_subfrm_8023_inplace(adf_nbuf_t msdu)
+{
+    u_int8_t *buf = adf_nbuf_data(msdu);
+    struct ethernet_hdr_t *ethr_hdr = (struct ethernet_hdr_t *)buf;
+    struct llc_snap_hdr_t *llc_hdr;
+    u_int16_t ether_type;
+    int remove_llc = 0;
+
+    if (adf_nbuf_len(msdu) < ETHERNET_HDR_LEN) {
+        return A_ERROR;
+    }
+    llc_hdr = (struct llc_snap_hdr_t *)(buf + ETHERNET_HDR_LEN);
+    ether_type = (llc_hdr->ethertype[0] << 8) | llc_hdr->ethertype[1];
+    /* a subframe too short to carry an LLC/SNAP header keeps it, too */
+    if (adf_nbuf_len(msdu) >= ETHERNET_HDR_LEN + LLC_SNAP_HDR_LEN &&
+        IS_SNAP(llc_hdr)) {
+        if (IS_BTEP(llc_hdr)) {
+            remove_llc = 1;
+        } else if (IS_RFC1042(llc_hdr)) {
+            remove_llc = !(ether_type == ETHERTYPE_AARP ||
+                           ether_type == ETHERTYPE_IPX);
+        }
+    }
+
+    if (remove_llc) {
+        adf_os_mem_move(buf + LLC_SNAP_HDR_LEN, buf, 2 * ETHERNET_ADDR_LEN);
+        adf_nbuf_pull_head(msdu, LLC_SNAP_HDR_LEN);
+    } else {
+        /* as ol_rx_decap_to_8023: the type field carries the length */
+        ether_type = adf_nbuf_len(msdu) - ETHERNET_HDR_LEN;
+        ethr_hdr->ethertype[0] = (ether_type >> 8) & 0xff;
+        ethr_hdr->ethertype[1] = (ether_type) & 0xff;
+    }
+    return A_OK;
+}
+
 #ifdef QCA_SUPPORT_SW_TXRX_ENCAP
 
 #include <adf_nbuf.h>    /* adf_nbuf_t */
@@ -213,6 +213,27 @@ ol_rx_mpdu_list_next(
         TXRX_STATS_INCR((pdev), pub.field.pkts); \
         TXRX_STATS_ADD((pdev), pub.field.bytes, adf_nbuf_len(netbuf)); \
     } while (0)
+#define TXRX_STATS_TX_COMPL_HIST(_pdev, _num_msdus) \
+    do { \
+        int _bin = 0, _n = (_num_msdus) >> 1; \
+        while (_n && _bin < OL_TX_COMPL_HIST_BINS - 1) { \
+            _bin++; \
+            _n >>= 1; \
+        } \
+        TXRX_STATS_INCR((_pdev), priv.tx.compl_hist[_bin]); \
+    } while (0)
+#define TXRX_STATS_RX_REORDER_DEPTH(_pdev, _depth) \
+    do { \
+        int _bin = 0, _n = (_depth) >> 1; \
+        while (_n && _bin < OL_RX_REORDER_DEPTH_HIST_BINS - 1) { \
+            _bin++; \
+            _n >>= 1; \
+        } \
+        TXRX_STATS_INCR((_pdev), priv.rx.reorder.depth_hist[_bin]); \
+        if ((_depth) > (_pdev)->stats.priv.rx.reorder.depth_max) { \
+            (_pdev)->stats.priv.rx.reorder.depth_max = (_depth); \
+        } \
+    } while (0)
 
 /* conditional defs based on verbosity level */
 
@@ -302,6 +323,12 @@ do {
 #undef  TXRX_STATS_MSDU_INCR
 #define TXRX_STATS_MSDU_INCR(pdev, field, netbuf)
 
+#undef  TXRX_STATS_TX_COMPL_HIST
+#define TXRX_STATS_TX_COMPL_HIST(_pdev, _num_msdus)
+
+#undef  TXRX_STATS_RX_REORDER_DEPTH
+#define TXRX_STATS_RX_REORDER_DEPTH(_pdev, _depth)
+
 #define TXRX_STATS_MSDU_LIST_INCR(pdev, field, netbuf_list)
 
 #define TXRX_STATS_MSDU_INCR_TX_STATUS(status, pdev, netbuf)
@@ -30,6 +30,7 @@
 #include <osdep.h>        /* u_int32_t, etc. */
 #include <adf_os_mem.h>   /* adf_os_mem_alloc, etc. */
 #include <adf_os_types.h> /* adf_os_device_t, adf_os_print */
+#include <adf_os_lock.h>  /* adf_os_rcu_read_lock, etc. */
 /* header files for utilities */
 #include <queue.h>        /* TAILQ */
 
@@ -133,12 +134,28 @@ ol_txrx_peer_find_hash_attach(struct ol_txrx_pdev_t *pdev)
     for (i = 0; i < hash_elems; i++) {
         TAILQ_INIT(&pdev->peer_hash.bins[i]);
     }
+
+    /* lookup stats are optional - carry on without them if need be */
+    pdev->peer_hash.num_stats = adf_os_num_cpu_ids();
+    pdev->peer_hash.stats = adf_os_mem_alloc(
+        pdev->osdev,
+        pdev->peer_hash.num_stats * sizeof(pdev->peer_hash.stats[0]));
+    if (pdev->peer_hash.stats) {
+        adf_os_mem_zero(
+            pdev->peer_hash.stats,
+            pdev->peer_hash.num_stats * sizeof(pdev->peer_hash.stats[0]));
+    } else {
+        pdev->peer_hash.num_stats = 0;
+    }
     return 0; /* success */
 }
 
 static void
 ol_txrx_peer_find_hash_detach(struct ol_txrx_pdev_t *pdev)
 {
+    if (pdev->peer_hash.stats) {
+        adf_os_mem_free(pdev->peer_hash.stats);
+    }
     adf_os_mem_free(pdev->peer_hash.bins);
 }
 
@@ -174,11 +191,92 @@ ol_txrx_peer_find_hash_add(
      * search from head to tail, this ensures that if two entries with
      * the same MAC address are stored, the one added first will be
      * found first.
+     * This is TAILQ_INSERT_TAIL, except that the peer's own links are
+     * set up before the peer is made reachable, since lookups walk the
+     * bin without holding peer_ref_mutex.
      */
-    TAILQ_INSERT_TAIL(&pdev->peer_hash.bins[index], peer, hash_list_elem);
+    TAILQ_NEXT(peer, hash_list_elem) = NULL;
+    peer->hash_list_elem.tqe_prev = pdev->peer_hash.bins[index].tqh_last;
+    adf_os_rcu_assign_pointer(*pdev->peer_hash.bins[index].tqh_last, peer);
+    pdev->peer_hash.bins[index].tqh_last = &TAILQ_NEXT(peer, hash_list_elem);
     adf_os_spin_unlock_bh(&pdev->peer_ref_mutex);
 }
 
+/*
+ * Search the hash table for a peer with the given MAC address (and vdev,
+ * if specified), and take a reference to it.
+ * This runs under RCU rather than peer_ref_mutex: a peer found here is
+ * not freed until after the RCU read section ends (see
+ * ol_txrx_peer_find_free), and a peer whose ref count has already
+ * dropped to zero is being deleted, so is skipped rather than revived.
+ */
+static struct ol_txrx_peer_t *
+ol_txrx_peer_find_hash_lookup(
+    struct ol_txrx_pdev_t *pdev,
+    struct ol_txrx_vdev_t *vdev,
+    union ol_txrx_align_mac_addr_t *mac_addr,
+    u_int8_t check_valid)
+{
+    unsigned index;
+    struct ol_txrx_peer_t *peer;
+    u_int32_t probes = 0;
+    int cache_hit = 0;
+
+    adf_os_rcu_read_lock();
+    if (vdev) {
+        peer = adf_os_rcu_dereference(vdev->last_hit_peer);
+        if (peer &&
+            ol_txrx_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr) == 0 &&
+            (check_valid == 0 || peer->valid) &&
+            adf_os_atomic_inc_not_zero(&peer->ref_cnt))
+        {
+            cache_hit = 1;
+            goto done;
+        }
+    }
+    index = ol_txrx_peer_find_hash_index(pdev, mac_addr);
+    /* TAILQ_FOREACH, with each link fetched as an RCU-protected pointer */
+    for (peer = adf_os_rcu_dereference(
+                    TAILQ_FIRST(&pdev->peer_hash.bins[index]));
+         peer != NULL;
+         peer = adf_os_rcu_dereference(TAILQ_NEXT(peer, hash_list_elem)))
+    {
+        probes++;
+        if (ol_txrx_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr) == 0
+            && (check_valid == 0 || peer->valid)
+            && (vdev == NULL || peer->vdev == vdev)
+            && adf_os_atomic_inc_not_zero(&peer->ref_cnt))
+        {
+            if (vdev) {
+                adf_os_rcu_assign_pointer(vdev->last_hit_peer, peer);
+            }
+            break;
+        }
+    }
+done:
+    adf_os_rcu_read_unlock();
+
+    if (pdev->peer_hash.stats) {
+        struct ol_txrx_peer_find_stats_t *stats;
+        a_bool_t bh_disabled;
+        int cpu;
+
+        cpu = adf_os_get_cpu_bh(&bh_disabled);
+        if (cpu < pdev->peer_hash.num_stats) {
+            stats = &pdev->peer_hash.stats[cpu];
+            stats->lookups++;
+            stats->probes += probes;
+            if (cache_hit) {
+                stats->cache_hits++;
+            } else if (!peer) {
+                stats->misses++;
+            }
+        }
+        adf_os_put_cpu_bh(bh_disabled);
+    }
+    return peer;
+}
+
 struct ol_txrx_peer_t *
 ol_txrx_peer_vdev_find_hash(struct ol_txrx_pdev_t *pdev,
                             struct ol_txrx_vdev_t *vdev,
@@ -187,8 +285,6 @@ ol_txrx_peer_vdev_find_hash(struct ol_txrx_pdev_t *pdev,
                             u_int8_t check_valid)
 {
     union ol_txrx_align_mac_addr_t local_mac_addr_aligned, *mac_addr;
-    unsigned index;
-    struct ol_txrx_peer_t *peer;
 
     if (mac_addr_is_aligned) {
         mac_addr = (union ol_txrx_align_mac_addr_t *) peer_mac_addr;
@@ -198,19 +294,7 @@ ol_txrx_peer_vdev_find_hash(struct ol_txrx_pdev_t *pdev,
             peer_mac_addr, OL_TXRX_MAC_ADDR_LEN);
         mac_addr = &local_mac_addr_aligned;
     }
-    index = ol_txrx_peer_find_hash_index(pdev, mac_addr);
-    adf_os_spin_lock_bh(&pdev->peer_ref_mutex);
-    TAILQ_FOREACH(peer, &pdev->peer_hash.bins[index], hash_list_elem) {
-        if (ol_txrx_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr) == 0
-            && (check_valid == 0 || peer->valid) && peer->vdev == vdev )  {
-            /* found it - increment the ref count before releasing the lock */
-            adf_os_atomic_inc(&peer->ref_cnt);
-            adf_os_spin_unlock_bh(&pdev->peer_ref_mutex);
-            return peer;
-        }
-    }
-    adf_os_spin_unlock_bh(&pdev->peer_ref_mutex);
-    return NULL; /* failure */
+    return ol_txrx_peer_find_hash_lookup(pdev, vdev, mac_addr, check_valid);
 }
 
 struct ol_txrx_peer_t *
@@ -221,8 +305,6 @@ ol_txrx_peer_find_hash_find(
     u_int8_t check_valid)
 {
     union ol_txrx_align_mac_addr_t local_mac_addr_aligned, *mac_addr;
-    unsigned index;
-    struct ol_txrx_peer_t *peer;
 
     if (mac_addr_is_aligned) {
         mac_addr = (union ol_txrx_align_mac_addr_t *) peer_mac_addr;
@@ -232,19 +314,7 @@ ol_txrx_peer_find_hash_find(
             peer_mac_addr, OL_TXRX_MAC_ADDR_LEN);
         mac_addr = &local_mac_addr_aligned;
     }
-    index = ol_txrx_peer_find_hash_index(pdev, mac_addr);
-    adf_os_spin_lock_bh(&pdev->peer_ref_mutex);
-    TAILQ_FOREACH(peer, &pdev->peer_hash.bins[index], hash_list_elem) {
-        if (ol_txrx_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr) == 0
-            && (check_valid == 0 || peer->valid)) {
-            /* found it - increment the ref count before releasing the lock */
-            adf_os_atomic_inc(&peer->ref_cnt);
-            adf_os_spin_unlock_bh(&pdev->peer_ref_mutex);
-            return peer;
-        }
-    }
-    adf_os_spin_unlock_bh(&pdev->peer_ref_mutex);
-    return NULL; /* failure */
+    return ol_txrx_peer_find_hash_lookup(pdev, NULL, mac_addr, check_valid);
 }
 
 void
@@ -268,12 +338,50 @@ ol_txrx_peer_find_hash_remove(
      * if it looks up the peer object from its MAC address just after the
      * peer ref count is decremented to zero, but just before the peer
      * object reference is removed from the hash table.
+     * (Lookups themselves don't take the lock, but they refuse to take a
+     * reference to a peer whose ref count has already reached zero.)
      */
     //adf_os_spin_lock_bh(&pdev->peer_ref_mutex);
-    TAILQ_REMOVE(&pdev->peer_hash.bins[index], peer, hash_list_elem);
+    /*
+     * This is TAILQ_REMOVE, except that the peer's own next link is left
+     * intact, so a lookup that is currently looking at this peer can
+     * continue its walk down the bin.
+     */
+    if (TAILQ_NEXT(peer, hash_list_elem) != NULL) {
+        TAILQ_NEXT(peer, hash_list_elem)->hash_list_elem.tqe_prev =
+            peer->hash_list_elem.tqe_prev;
+    } else {
+        pdev->peer_hash.bins[index].tqh_last = peer->hash_list_elem.tqe_prev;
+    }
+    adf_os_rcu_assign_pointer(
+        *peer->hash_list_elem.tqe_prev, TAILQ_NEXT(peer, hash_list_elem));
+    if (peer->vdev->last_hit_peer == peer) {
+        adf_os_rcu_assign_pointer(peer->vdev->last_hit_peer, NULL);
+    }
     //adf_os_spin_unlock_bh(&pdev->peer_ref_mutex);
 }
 
+static void
+ol_txrx_peer_find_free_rcu(adf_os_rcu_head_t *head)
+{
+    struct ol_txrx_peer_t *peer;
+
+    peer = (struct ol_txrx_peer_t *)
+        ((char *) head - offsetof(struct ol_txrx_peer_t, rcu_head));
+    adf_os_mem_free(peer);
+}
+
+void
+ol_txrx_peer_find_free(struct ol_txrx_peer_t *peer)
+{
+    /*
+     * The peer has been removed from the hash table, but a lookup that
+     * started before then may still be comparing its MAC address.
+     * Wait for any such lookups to finish before freeing the peer.
+     */
+    adf_os_call_rcu(&peer->rcu_head, ol_txrx_peer_find_free_rcu);
+}
+
 void
 ol_txrx_peer_find_hash_erase(struct ol_txrx_pdev_t *pdev)
 {
@@ -402,6 +510,8 @@ ol_txrx_peer_find_attach(struct ol_txrx_pdev_t *pdev)
 void
 ol_txrx_peer_find_detach(struct ol_txrx_pdev_t *pdev)
 {
+    /* let any peer frees deferred by ol_txrx_peer_find_free complete */
+    adf_os_rcu_barrier();
     ol_txrx_peer_find_map_detach(pdev);
     ol_txrx_peer_find_hash_detach(pdev);
 }
@@ -517,6 +627,47 @@ ol_txrx_assoc_peer_find(struct ol_txrx_vdev_t *vdev)
 
 /*=== function definitions for debug ========================================*/
 
+void
+ol_txrx_peer_find_stats_display(ol_txrx_pdev_handle pdev)
+{
+    u_int32_t lookups = 0, cache_hits = 0, misses = 0, probes = 0;
+    int num_peers = 0, num_bins_used = 0, max_chain = 0;
+    int i;
+
+    for (i = 0; i < pdev->peer_hash.num_stats; i++) {
+        lookups += pdev->peer_hash.stats[i].lookups;
+        cache_hits += pdev->peer_hash.stats[i].cache_hits;
+        misses += pdev->peer_hash.stats[i].misses;
+        probes += pdev->peer_hash.stats[i].probes;
+    }
+
+    adf_os_spin_lock_bh(&pdev->peer_ref_mutex);
+    for (i = 0; i <= pdev->peer_hash.mask; i++) {
+        struct ol_txrx_peer_t *peer;
+        int chain = 0;
+
+        TAILQ_FOREACH(peer, &pdev->peer_hash.bins[i], hash_list_elem) {
+            chain++;
+        }
+        if (chain) {
+            num_bins_used++;
+            num_peers += chain;
+            if (chain > max_chain) {
+                max_chain = chain;
+            }
+        }
+    }
+    adf_os_spin_unlock_bh(&pdev->peer_ref_mutex);
+
+    VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_INFO,
+        "  peer find: %u lookups, %u vdev cache hits, %u misses, "
+        "%u bin entries compared\n",
+        lookups, cache_hits, misses, probes);
+    VOS_TRACE(VOS_MODULE_ID_TXRX, VOS_TRACE_LEVEL_INFO,
+        "  peer hash: %d peers in %d of %u bins, longest chain %d\n",
+        num_peers, num_bins_used, pdev->peer_hash.mask + 1, max_chain);
+}
+
 #if defined (TXRX_DEBUG_LEVEL) && TXRX_DEBUG_LEVEL > 5
 void
 ol_txrx_peer_find_display(ol_txrx_pdev_handle pdev, int indent)
@@ -548,5 +699,6 @@ ol_txrx_peer_find_display(ol_txrx_pdev_handle pdev, int indent)
             }
         }
     }
+    ol_txrx_peer_find_stats_display(pdev);
 }
 #endif /* if TXRX_DEBUG_LEVEL */
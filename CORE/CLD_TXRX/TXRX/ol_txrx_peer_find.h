@@ -118,9 +118,18 @@ void
 ol_txrx_peer_find_hash_erase(
     struct ol_txrx_pdev_t *pdev);
 
+/*
+ * Free a peer that has been removed from the hash table, once lookups
+ * that may still be examining it have finished.
+ */
+void
+ol_txrx_peer_find_free(struct ol_txrx_peer_t *peer);
+
 struct ol_txrx_peer_t *
 ol_txrx_assoc_peer_find(struct ol_txrx_vdev_t *vdev);
 
+void ol_txrx_peer_find_stats_display(ol_txrx_pdev_handle pdev);
+
 #if defined(TXRX_DEBUG_LEVEL) && TXRX_DEBUG_LEVEL > 5
 void ol_txrx_peer_find_display(ol_txrx_pdev_handle pdev, int indent);
 #else
@@ -79,6 +79,9 @@
 #define OL_TX_MUTEX_TYPE adf_os_spinlock_t
 #define OL_RX_MUTEX_TYPE adf_os_spinlock_t
 
+#define OL_TX_COMPL_HIST_BINS 8 /* log2 bins of msdus per tx completion */
+#define OL_RX_REORDER_DEPTH_HIST_BINS 7 /* log2 bins of held rx mpdus */
+
 struct ol_txrx_pdev_t;
 struct ol_txrx_vdev_t;
 struct ol_txrx_peer_t;
@@ -115,6 +118,36 @@ typedef struct _privacy_excemption_filter {
 	privacy_filter_packet_type packet_type;
 } privacy_exemption;
 
+#ifdef QCA_LL_TX_BQL
+#define OL_TX_BQL_MAX_VDEVS 16
+#define OL_TX_BQL_VDEV_ID_NONE 0xff /* tx desc not charged to any limit */
+
+/*
+ * Byte queue limit for the frames of one vdev id that are downloaded to
+ * the target but not yet completed.
+ * This is kept in the pdev and indexed by vdev id, rather than kept in
+ * the vdev, since a vdev may be deleted while its frames are outstanding.
+ */
+struct ol_tx_bql_t {
+	/* bytes downloaded to the target and not yet completed */
+	adf_os_atomic_t inflight;
+	/* bytes completed since the limit was last recomputed */
+	adf_os_atomic_t completed;
+	/* in-flight byte limit, recomputed on every tx completion batch */
+	u_int32_t limit;
+	/* smallest unused part of the limit seen during this hold period */
+	u_int32_t min_slack;
+	u_int32_t slack_start_ms;
+	/* set when the OS tx queue was stopped because of the limit */
+	u_int8_t over_limit;
+	struct {
+		u_int32_t stops;
+		u_int32_t grows;
+		u_int32_t shrinks;
+	} stats;
+};
+#endif /* QCA_LL_TX_BQL */
+
 enum ol_tx_frm_type {
     ol_tx_frm_std = 0, /* regular frame - no added header fragments */
     ol_tx_frm_tso,     /* TSO segment, with a modified IP header added */
@@ -154,15 +187,69 @@ struct ol_tx_desc_t {
 #if defined(CONFIG_PER_VDEV_TX_DESC_POOL)
 	struct ol_txrx_vdev_t* vdev;
 #endif
+#ifdef QCA_LL_TX_BQL
+	/* bytes charged to the byte queue limit of vdev id bql_vdev_id */
+	u_int16_t bql_bytes;
+	u_int8_t bql_vdev_id;
+#endif
+#if defined(CONFIG_HL_SUPPORT) && defined(QCA_TX_SCHED_FQ_CODEL)
+	/*
+	 * FQ-CoDel tx scheduler state: the flow (within the TID) this frame
+	 * hashed to, the tx queue that holds it, and when it was queued
+	 * to the scheduler (for sojourn time measurement).
+	 * fq_txq is NULL while the frame is not linked into a flow.
+	 */
+	TAILQ_ENTRY(ol_tx_desc_t) fq_flow_elem;
+	struct ol_tx_frms_queue_t *fq_txq;
+	unsigned long fq_enqueue_ticks;
+	u_int8_t fq_flow;
+#endif
 };
 
-typedef TAILQ_HEAD(, ol_tx_desc_t) ol_tx_desc_list;
+typedef TAILQ_HEAD(ol_tx_desc_list_s, ol_tx_desc_t) ol_tx_desc_list;
 
 union ol_tx_desc_list_elem_t {
 	union ol_tx_desc_list_elem_t *next;
 	struct ol_tx_desc_t tx_desc;
 };
 
+#ifdef QCA_SUPPORT_TX_DESC_PERCPU_CACHE
+/*
+ * Per-CPU magazine of free tx descriptors.
+ * Each magazine is only touched by its own CPU with bottom halves
+ * disabled, so alloc/free hits need no lock.  Misses refill, and
+ * overflows drain, OL_TX_DESC_CACHE_BATCH descriptors at a time
+ * from/to the pdev freelist under tx_mutex.
+ */
+#define OL_TX_DESC_CACHE_SIZE  32
+#define OL_TX_DESC_CACHE_BATCH (OL_TX_DESC_CACHE_SIZE >> 1)
+
+struct ol_tx_desc_cache_t {
+	union ol_tx_desc_list_elem_t *freelist;
+	u_int16_t num_free;
+	struct {
+		u_int32_t alloc_hit;
+		u_int32_t alloc_miss;
+		u_int32_t free_hit;
+		u_int32_t refill;
+		u_int32_t drain;
+	} stats;
+} __attribute__((aligned(64)));
+#endif /* QCA_SUPPORT_TX_DESC_PERCPU_CACHE */
+
+/*
+ * Per-CPU peer MAC address lookup counters.
+ * Lookups walk the peer hash under RCU rather than peer_ref_mutex, so
+ * the counters are kept per CPU to keep lookups free of shared writes.
+ */
+struct ol_txrx_peer_find_stats_t {
+	u_int32_t lookups;
+	u_int32_t cache_hits;
+	u_int32_t misses;
+	/* hash bin entries compared, summed over all lookups */
+	u_int32_t probes;
+} __attribute__((aligned(64)));
+
 union ol_txrx_align_mac_addr_t {
 	u_int8_t raw[OL_TXRX_MAC_ADDR_LEN];
 	struct {
@@ -239,6 +326,10 @@ struct ol_tx_frms_queue_t {
 	u_int32_t bytes;
 	ol_tx_desc_list head;
 	enum ol_tx_queue_status flag;
+#if defined(QCA_SUPPORT_TX_AIRTIME_FAIRNESS)
+	/* airtime (usec) this queue may still use in the current DRR round */
+	int airtime_deficit;
+#endif
 };
 
 enum {
@@ -442,7 +533,14 @@ struct ol_txrx_pdev_t {
 	struct {
 		unsigned mask;
 		unsigned idx_bits;
+		/*
+		 * bins are modified under peer_ref_mutex, but searched
+		 * under RCU - see ol_txrx_peer_find_hash_find
+		 */
 		TAILQ_HEAD(, ol_txrx_peer_t) *bins;
+		/* lookup stats, indexed by CPU id */
+		int num_stats;
+		struct ol_txrx_peer_find_stats_t *stats;
 	} peer_hash;
 
 	/* rx specific processing */
@@ -490,6 +588,11 @@ struct ol_txrx_pdev_t {
 		u_int16_t num_free;
 		union ol_tx_desc_list_elem_t *array;
 		union ol_tx_desc_list_elem_t *freelist;
+#ifdef QCA_SUPPORT_TX_DESC_PERCPU_CACHE
+		/* per-CPU caches, indexed by CPU id */
+		int num_caches;
+		struct ol_tx_desc_cache_t *caches;
+#endif
 	} tx_desc;
 
 	struct {
@@ -528,6 +631,14 @@ struct ol_txrx_pdev_t {
 #if TXRX_STATS_LEVEL != TXRX_STATS_LEVEL_OFF
 	struct {
 		struct {
+			struct {
+				/*
+				 * tx completion indications, binned by the
+				 * number of msdus they complete: 1, 2-3, 4-7,
+				 * ..., 64-127, 128+
+				 */
+				u_int32_t compl_hist[OL_TX_COMPL_HIST_BINS];
+			} tx;
 			struct {
 				struct {
 					u_int64_t ppdus;
@@ -546,6 +657,19 @@ struct ol_txrx_pdev_t {
 					//u_int64_t mpdu_flushed;
 					//u_int64_t msdu_defrag_mic_err;
 				} err;
+				struct {
+					/*
+					 * MPDUs held in the peer-TID reorder
+					 * array after each store, binned as
+					 * 1, 2-3, 4-7, ..., 32-63, 64
+					 */
+					u_int32_t depth_hist[
+						OL_RX_REORDER_DEPTH_HIST_BINS];
+					u_int32_t depth_max;
+					/* flushes forced by the host reorder timer */
+					u_int32_t timeout_flushes;
+					u_int64_t timeout_flush_mpdus;
+				} reorder;
 			} rx;
 		} priv;
 		struct ol_txrx_stats pub;
@@ -687,6 +811,10 @@ struct ol_txrx_pdev_t {
 		a_bool_t is_paused;
 	} tx_throttle;
 
+#ifdef QCA_LL_TX_BQL
+	struct ol_tx_bql_t tx_bql[OL_TX_BQL_MAX_VDEVS];
+#endif
+
 #ifdef IPA_UC_OFFLOAD
     ipa_uc_op_cb_type ipa_uc_op_cb;
     void *osif_dev;
@@ -714,6 +842,11 @@ struct ol_txrx_vdev_t {
 	TAILQ_HEAD(peer_list_t, ol_txrx_peer_t) peer_list;
 	/* last real peer created for this vdev (not "self" pseudo-peer) */
 	struct ol_txrx_peer_t *last_real_peer;
+	/*
+	 * peer most recently found by MAC address on this vdev - only a
+	 * lookup hint, read under RCU and cleared when the peer is unhashed
+	 */
+	struct ol_txrx_peer_t *last_hit_peer;
 
 	/* transmit function used by this vdev */
 	ol_txrx_tx_fp tx;
@@ -768,6 +901,13 @@ struct ol_txrx_vdev_t {
 		int max_q_depth;
 	} ll_pause;
 	a_bool_t disable_intrabss_fwd;
+	/* intra-BSS forwarding counters, see ol_rx_fwd_check */
+	struct {
+		u_int32_t ucast;
+		u_int32_t mcast;
+		u_int32_t batches;
+		u_int32_t dropped;
+	} fwd_stats;
 	adf_os_atomic_t os_q_paused;
 	u_int16_t tx_fl_lwm;
 	u_int16_t tx_fl_hwm;
@@ -796,6 +936,10 @@ struct ol_rx_reorder_t {
 	struct ol_rx_reorder_array_elem_t *array;
 	/* base - single rx reorder element used for non-aggr cases */
 	struct ol_rx_reorder_array_elem_t base;
+#if defined(QCA_SUPPORT_RX_REORDER_BITMAP)
+	/* bit N is set while array[N] holds an MPDU (win_sz <= 64) */
+	u_int64_t bitmap;
+#endif
 #if defined(QCA_SUPPORT_OL_RX_REORDER_TIMEOUT)
 	struct ol_rx_reorder_timeout_list_elem_t timeout;
 #endif
@@ -844,6 +988,8 @@ struct ol_txrx_peer_t {
 	TAILQ_ENTRY(ol_txrx_peer_t) peer_list_elem;
 	/* node in the hash table bin's list of peers */
 	TAILQ_ENTRY(ol_txrx_peer_t) hash_list_elem;
+	/* defers the peer's free until lockless hash lookups are done */
+	adf_os_rcu_head_t rcu_head;
 
 	/*
 	 * per TID info -
@@ -872,6 +1018,15 @@ struct ol_txrx_peer_t {
 
 #if defined(CONFIG_HL_SUPPORT)
 	struct ol_tx_frms_queue_t txqs[OL_TX_NUM_TIDS];
+#if defined(QCA_SUPPORT_TX_AIRTIME_FAIRNESS)
+	struct {
+		/* PHY tx rate used to convert downloaded bytes into airtime */
+		u_int32_t rate_kbps;
+		/* estimated airtime and bytes charged to this peer so far */
+		u_int64_t airtime_us;
+		u_int64_t bytes;
+	} tx_airtime;
+#endif
 #endif
 
 #ifdef QCA_ENABLE_OL_TXRX_PEER_STATS
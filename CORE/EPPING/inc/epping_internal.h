@@ -179,6 +179,7 @@ void epping_tx_dup_pkt(epping_adapter_t *pAdapter,
                               HTC_ENDPOINT_ID eid, adf_nbuf_t skb);
 /* epping_rx signatures */
 void epping_rx(void *Context, HTC_PACKET *pPacket);
+void epping_rx_decap_bench(epping_adapter_t *pAdapter, unsigned int num_iter);
 
 #ifdef HIF_SDIO
 void epping_refill(void *ctx, HTC_ENDPOINT_ID Endpoint);
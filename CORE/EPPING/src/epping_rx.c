@@ -58,8 +58,13 @@
 #include <linux/rtnetlink.h>
 #include <linux/semaphore.h>
 #include <linux/ctype.h>
+#include <linux/timex.h>
+#include <linux/ktime.h>
+#include <linux/math64.h>
+#include <linux/sched.h>
 #include <wlan_hdd_hostapd.h>
 #include <wlan_hdd_softap_tx_rx.h>
+#include <ol_txrx_encap.h>
 #include "epping_main.h"
 #include "epping_internal.h"
 #include "epping_test.h"
@@ -68,6 +73,12 @@
 #define AR6000_BUFFER_SIZE 1664
 #define AR6000_MIN_HEAD_ROOM 64
 
+#define EPPING_DECAP_BENCH_DEF_ITER 10000
+#define EPPING_DECAP_BENCH_MAX_ITER 1000000
+/* iterations between reschedule points in the bench loop */
+#define EPPING_DECAP_BENCH_RESCHED  1024
+#define EPPING_DECAP_BENCH_PAYLOAD  1500
+
 static bool enb_rx_dump = 0;
 
 #ifdef HIF_SDIO
@@ -202,3 +213,122 @@ void epping_rx(void *ctx, HTC_PACKET *pPacket)
       }
    }
 }
+
+/*
+ * Reference for the decap bench: stage the subframe header in a local
+ * buffer, strip the LLC and write the rebuilt 802.3 header back, as
+ * ol_rx_decap_to_8023 does for A-MSDU subframes.
+ */
+static void epping_decap_bench_hdr_copy(adf_nbuf_t msdu)
+{
+   u_int8_t localbuf[ETHERNET_HDR_LEN];
+   struct ethernet_hdr_t *ethr_hdr = (struct ethernet_hdr_t *)localbuf;
+   struct llc_snap_hdr_t *llc_hdr;
+   u_int8_t *buf;
+
+   adf_os_mem_copy(ethr_hdr, adf_nbuf_data(msdu), ETHERNET_HDR_LEN);
+   llc_hdr = (struct llc_snap_hdr_t *)adf_nbuf_pull_head(msdu,
+                                                         ETHERNET_HDR_LEN);
+   ethr_hdr->ethertype[0] = llc_hdr->ethertype[0];
+   ethr_hdr->ethertype[1] = llc_hdr->ethertype[1];
+   buf = adf_nbuf_push_head(msdu, ETHERNET_HDR_LEN - LLC_SNAP_HDR_LEN);
+   adf_os_mem_copy(buf, ethr_hdr, ETHERNET_HDR_LEN);
+}
+
+/*
+ * Microbenchmark for A-MSDU subframe decap: cycles per MSDU for
+ * rebuilding the header through a local copy, for the in-place decap
+ * and for copying the whole frame before decapping it. The first pass
+ * only restores the subframe header and is the baseline to subtract.
+ */
+void epping_rx_decap_bench(epping_adapter_t *pAdapter, unsigned int num_iter)
+{
+   static const char * const bench_name[] = {
+      "restore only", "hdr copy", "in place", "frame copy"
+   };
+   u_int8_t template[ETHERNET_HDR_LEN + LLC_SNAP_HDR_LEN];
+   struct ethernet_hdr_t *ethr_hdr = (struct ethernet_hdr_t *)template;
+   struct llc_snap_hdr_t *llc_hdr;
+   adf_nbuf_t msdu, copy;
+   u_int8_t *orig;
+   unsigned int i;
+   int bench;
+
+   if (!num_iter) {
+      num_iter = EPPING_DECAP_BENCH_DEF_ITER;
+   } else if (num_iter > EPPING_DECAP_BENCH_MAX_ITER) {
+      num_iter = EPPING_DECAP_BENCH_MAX_ITER;
+   }
+   msdu = adf_nbuf_alloc(NULL, AR6000_BUFFER_SIZE,
+                         AR6000_MIN_HEAD_ROOM, 4, FALSE);
+   if (!msdu) {
+      EPPING_LOG(VOS_TRACE_LEVEL_ERROR, "%s: no mem", __func__);
+      return;
+   }
+   adf_nbuf_put_tail(msdu, sizeof(template) + EPPING_DECAP_BENCH_PAYLOAD);
+   orig = adf_nbuf_data(msdu);
+   adf_os_mem_set(orig + sizeof(template), 0x5a, EPPING_DECAP_BENCH_PAYLOAD);
+
+   /* RFC1042 encapsulated IPv4 subframe */
+   adf_os_mem_copy(ethr_hdr->dest_addr, pAdapter->macAddressCurrent.bytes,
+                   ETHERNET_ADDR_LEN);
+   adf_os_mem_copy(ethr_hdr->src_addr, pAdapter->macAddressCurrent.bytes,
+                   ETHERNET_ADDR_LEN);
+   ethr_hdr->src_addr[5] ^= 0x1;
+   ethr_hdr->ethertype[0] = (LLC_SNAP_HDR_LEN + EPPING_DECAP_BENCH_PAYLOAD) >> 8;
+   ethr_hdr->ethertype[1] = (LLC_SNAP_HDR_LEN + EPPING_DECAP_BENCH_PAYLOAD) & 0xff;
+   llc_hdr = (struct llc_snap_hdr_t *)(template + ETHERNET_HDR_LEN);
+   llc_hdr->dsap = LLC_SNAP_LSAP;
+   llc_hdr->ssap = LLC_SNAP_LSAP;
+   llc_hdr->cntl = LLC_UI;
+   llc_hdr->org_code[0] = RFC1042_SNAP_ORGCODE_0;
+   llc_hdr->org_code[1] = RFC1042_SNAP_ORGCODE_1;
+   llc_hdr->org_code[2] = RFC1042_SNAP_ORGCODE_2;
+   llc_hdr->ethertype[0] = ETHERTYPE_IPV4 >> 8;
+   llc_hdr->ethertype[1] = ETHERTYPE_IPV4 & 0xff;
+
+   for (bench = 0; bench < ARRAY_SIZE(bench_name); bench++) {
+      cycles_t start_cycles, cycles;
+      ktime_t start_time;
+      s64 ns;
+
+      start_time = ktime_get();
+      start_cycles = get_cycles();
+      for (i = 0; i < num_iter; i++) {
+         /* undo the previous decap */
+         adf_nbuf_push_head(msdu, adf_nbuf_data(msdu) - orig);
+         adf_os_mem_copy(orig, template, sizeof(template));
+         switch (bench) {
+         case 1:
+            epping_decap_bench_hdr_copy(msdu);
+            break;
+         case 2:
+            ol_rx_decap_subfrm_8023_inplace(msdu);
+            break;
+         case 3:
+            copy = adf_nbuf_copy(msdu);
+            if (copy) {
+               ol_rx_decap_subfrm_8023_inplace(copy);
+               adf_nbuf_free(copy);
+            }
+            break;
+         default:
+            break;
+         }
+         /*
+          * The ioctl runs with rtnl held; let others run now and then.
+          * Every pass pays the same cost, so the baseline cancels it.
+          */
+         if (!(i % EPPING_DECAP_BENCH_RESCHED)) {
+            cond_resched();
+         }
+      }
+      cycles = get_cycles() - start_cycles;
+      ns = ktime_to_ns(ktime_sub(ktime_get(), start_time));
+      EPPING_LOG(VOS_TRACE_LEVEL_FATAL,
+         "%s: %s: %llu cycles/msdu, %lld ns/msdu (%u msdus)",
+         __func__, bench_name[bench],
+         div_u64((u64)cycles, num_iter), div_s64(ns, num_iter), num_iter);
+   }
+   adf_nbuf_free(msdu);
+}
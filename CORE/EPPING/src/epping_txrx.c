@@ -220,6 +220,22 @@ int epping_ndev_ioctl(struct net_device *dev, struct ifreq *ifr, int cmd)
          "%s: do not support ioctl %d (SIOCDEVPRIVATE + 1)",
          __func__, cmd);
       break;
+   case (SIOCDEVPRIVATE + 2):
+   {
+      unsigned int num_iter;
+
+      /* A-MSDU decap microbenchmark, ifr_data holds the iteration count */
+      if (!capable(CAP_NET_ADMIN)) {
+         ret = -EPERM;
+         break;
+      }
+      if (copy_from_user(&num_iter, ifr->ifr_data, sizeof(num_iter))) {
+         ret = -EFAULT;
+         break;
+      }
+      epping_rx_decap_bench(pAdapter, num_iter);
+      break;
+   }
    default:
       EPPING_LOG(VOS_TRACE_LEVEL_ERROR, "%s: unknown ioctl %d",
              __func__, cmd);
@@ -2474,6 +2474,16 @@ This feature requires the dependent cfg.ini "gRoamPrefer5GHz" set to 1 */
 #define CFG_ENABLE_RX_THREAD_MAX                   (1)
 #define CFG_ENABLE_RX_THREAD_DEFAULT               (1)
 
+/*
+ * Deliver rx frames to the network stack through a per-adapter NAPI
+ * context (napi_gro_receive) instead of netif_rx, so TCP segments can
+ * be coalesced by GRO before they traverse the stack.
+ */
+#define CFG_ENABLE_RX_NAPI                         "gEnableRxNapi"
+#define CFG_ENABLE_RX_NAPI_MIN                     (0)
+#define CFG_ENABLE_RX_NAPI_MAX                     (1)
+#define CFG_ENABLE_RX_NAPI_DEFAULT                 (0)
+
 /* SAR Thermal limit values for 2g and 5g */
 
 #define CFG_SET_TXPOWER_LIMIT2G_NAME               "TxPower2g"
@@ -2681,6 +2691,17 @@ This feature requires the dependent cfg.ini "gRoamPrefer5GHz" set to 1 */
 #define CFG_REORDER_OFFLOAD_SUPPORT_MAX     ( 1 )
 #define CFG_REORDER_OFFLOAD_SUPPORT_DEFAULT ( 0 )
 
+/*
+ * Lookup structure used to map rx buffer physical addresses back to
+ * network buffers when rx reorder is offloaded to the target.
+ * 0 - bucketed linked-list hash
+ * 1 - open-addressed table sized to the rx ring
+ */
+#define CFG_RX_IN_ORDER_LOOKUP_MODE_NAME    "gRxInOrderLookupMode"
+#define CFG_RX_IN_ORDER_LOOKUP_MODE_MIN     ( 0 )
+#define CFG_RX_IN_ORDER_LOOKUP_MODE_MAX     ( 1 )
+#define CFG_RX_IN_ORDER_LOOKUP_MODE_DEFAULT ( 0 )
+
 #ifdef WLAN_FEATURE_ROAM_OFFLOAD
 #define CFG_ROAMING_OFFLOAD_NAME                "gRoamOffloadEnabled"
 #define CFG_ROAMING_OFFLOAD_MIN                 (0)
@@ -3328,6 +3349,7 @@ typedef struct
    v_U32_t                     TxPower5g;
    v_U32_t                     gEnableDebugLog;
    v_U8_t                      enableRxThread;
+   v_U8_t                      enableRxNapi;
    v_BOOL_t                    fDfsPhyerrFilterOffload;
    v_U8_t                      gSapPreferredChanLocation;
    v_U8_t                      gDisableDfsJapanW53;
@@ -3394,6 +3416,7 @@ typedef struct
 
    v_S31_t                     dfsRadarPriMultiplier;
    v_U8_t                      reorderOffloadSupport;
+   v_U8_t                      rxInOrderLookupMode;
 
 #ifdef WLAN_FEATURE_ROAM_OFFLOAD
    v_BOOL_t                    isRoamOffloadEnabled;
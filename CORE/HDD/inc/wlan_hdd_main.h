@@ -341,6 +341,12 @@ typedef struct hdd_tx_rx_stats_s
    __u32    rxDropped;
    __u32    rxDelivered;
    __u32    rxRefused;
+   // rx NAPI / GRO stats
+   __u32    rxNapiPolls;
+   __u32    rxGroAggregated;  // merged into a segment already held by GRO
+   __u32    rxGroHeld;        // held by GRO as the head of a new segment
+   __u32    rxGroFlushed;     // passed up the stack without being held
+   __u32    rxNapiQueueDropped; // dropped, rx NAPI queue was full
    __u32    pkt_tx_count; //TX pkt Counter used for dynamic splitscan
    __u32    pkt_rx_count; //RX pkt Counter used for dynamic splitscan
 
@@ -925,6 +931,8 @@ struct hdd_adapter_s
    struct net_device_stats stats;
    /** HDD statistics*/
    hdd_stats_t hdd_stats;
+   /** Serializes the rx counter updates from the per-core rx threads */
+   spinlock_t rx_stats_lock;
    /** linkspeed statistics */
    tSirLinkSpeedInfo ls_stats;
    /**Mib information*/
@@ -993,6 +1001,16 @@ struct hdd_adapter_s
    hdd_wmm_status_t hddWmmStatus;
 /*************************************************************
  */
+/*************************************************************
+ *  Rx NAPI (gEnableRxNapi)
+ */
+   /** NAPI context the rx callbacks feed, for GRO */
+   struct napi_struct rx_napi;
+   /** rx frames waiting for the next NAPI poll */
+   struct sk_buff_head rx_napi_queue;
+   v_BOOL_t rx_napi_enabled;
+/*************************************************************
+ */
 /*************************************************************
  * TODO - Remove it later
  */
@@ -1719,6 +1737,10 @@ void hdd_wlan_green_ap_mc(hdd_context_t *pHddCtx,
 void wlan_hdd_cfg80211_stats_ext_init(hdd_context_t *pHddCtx);
 #endif
 
+#ifdef FEATURE_WLAN_SCAN_RESULT_STREAMING
+void wlan_hdd_cfg80211_scan_result_stream_init(hdd_context_t *pHddCtx);
+#endif
+
 #ifdef WLAN_FEATURE_LINK_LAYER_STATS
 void wlan_hdd_cfg80211_link_layer_stats_init(hdd_context_t *pHddCtx);
 #endif
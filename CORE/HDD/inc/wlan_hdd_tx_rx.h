@@ -212,6 +212,67 @@ extern VOS_STATUS hdd_tx_low_resource_cbk( vos_pkt_t *pVosPacket,
 extern VOS_STATUS hdd_rx_packet_cbk(v_VOID_t *vosContext, adf_nbuf_t rxBufChain,
                                     v_U8_t staId);
 
+/* rx counters gathered over one rx chain or NAPI poll */
+typedef struct hdd_rx_chain_stats_s
+{
+   __u32    chains;
+   __u32    packets;
+   __u32    bytes;
+   __u32    dropped;
+   __u32    delivered;
+   __u32    refused;
+   __u32    napiQueueDropped;
+} hdd_rx_chain_stats_t;
+
+/**============================================================================
+  @brief hdd_rx_stats_update() - Add the counters gathered over one rx chain
+  to the adapter's rx stats. Rx chains of one adapter may be delivered
+  by several rx threads at once, so the rx callbacks count locally and
+  only take rx_stats_lock once per chain here.
+
+  @param pAdapter : [in] pointer to HDD adapter
+  @param pRxStats : [in] counters to add
+  ===========================================================================*/
+void hdd_rx_stats_update(hdd_adapter_t *pAdapter,
+                         const hdd_rx_chain_stats_t *pRxStats);
+
+/**============================================================================
+  @brief hdd_rx_napi_init() - Set up the adapter's rx NAPI context.
+  Rx frames for this adapter are then handed to GRO from the NAPI poll
+  instead of being pushed up with netif_rx.
+
+  @param pAdapter : [in] pointer to HDD adapter
+  ===========================================================================*/
+void hdd_rx_napi_init(hdd_adapter_t *pAdapter);
+
+/**============================================================================
+  @brief hdd_rx_napi_deinit() - Tear down the adapter's rx NAPI context,
+  dropping any frames still waiting to be polled.
+
+  @param pAdapter : [in] pointer to HDD adapter
+  ===========================================================================*/
+void hdd_rx_napi_deinit(hdd_adapter_t *pAdapter);
+
+/**============================================================================
+  @brief hdd_rx_napi_enqueue() - Queue an rx frame for the adapter's NAPI
+  poll. The frame is dropped if netdev_max_backlog frames are already
+  waiting; the caller accounts for it.
+
+  @param pAdapter : [in] pointer to HDD adapter
+  @param skb      : [in] rx frame, already through eth_type_trans
+
+  @return         : NET_RX_SUCCESS if queued, NET_RX_DROP if dropped
+  ===========================================================================*/
+int hdd_rx_napi_enqueue(hdd_adapter_t *pAdapter, struct sk_buff *skb);
+
+/**============================================================================
+  @brief hdd_rx_napi_schedule() - Kick the adapter's rx NAPI poll after
+  frames have been queued to pAdapter->rx_napi_queue.
+
+  @param pAdapter : [in] pointer to HDD adapter
+  ===========================================================================*/
+void hdd_rx_napi_schedule(hdd_adapter_t *pAdapter);
+
 /**============================================================================
   @brief hdd_IsEAPOLPacket() - Checks the packet is EAPOL or not.
 
@@ -3410,6 +3410,13 @@ REG_TABLE_ENTRY g_registry_table[] =
                  CFG_ENABLE_RX_THREAD_MIN,
                  CFG_ENABLE_RX_THREAD_MAX),
 
+   REG_VARIABLE( CFG_ENABLE_RX_NAPI, WLAN_PARAM_Integer,
+                 hdd_config_t, enableRxNapi,
+                 VAR_FLAGS_OPTIONAL | VAR_FLAGS_RANGE_CHECK_ASSUME_DEFAULT,
+                 CFG_ENABLE_RX_NAPI_DEFAULT,
+                 CFG_ENABLE_RX_NAPI_MIN,
+                 CFG_ENABLE_RX_NAPI_MAX),
+
    REG_VARIABLE( CFG_ENABLE_DFS_PHYERR_FILTEROFFLOAD_NAME, WLAN_PARAM_Integer,
                  hdd_config_t, fDfsPhyerrFilterOffload,
                  VAR_FLAGS_OPTIONAL | VAR_FLAGS_RANGE_CHECK_ASSUME_DEFAULT,
@@ -3740,6 +3747,13 @@ REG_TABLE_ENTRY g_registry_table[] =
                         CFG_REORDER_OFFLOAD_SUPPORT_DEFAULT,
                         CFG_REORDER_OFFLOAD_SUPPORT_MIN,
                         CFG_REORDER_OFFLOAD_SUPPORT_MAX ),
+
+   REG_VARIABLE( CFG_RX_IN_ORDER_LOOKUP_MODE_NAME, WLAN_PARAM_Integer,
+                        hdd_config_t, rxInOrderLookupMode,
+                        VAR_FLAGS_OPTIONAL | VAR_FLAGS_RANGE_CHECK_ASSUME_DEFAULT,
+                        CFG_RX_IN_ORDER_LOOKUP_MODE_DEFAULT,
+                        CFG_RX_IN_ORDER_LOOKUP_MODE_MIN,
+                        CFG_RX_IN_ORDER_LOOKUP_MODE_MAX ),
 #ifdef IPA_UC_OFFLOAD
    REG_VARIABLE( CFG_IPA_UC_OFFLOAD_ENABLED_NAME, WLAN_PARAM_Integer,
                  hdd_config_t, IpaUcOffloadEnabled,
@@ -4087,15 +4101,36 @@ static char *i_trim(char *str)
 }
 
 
+#define i_iseol(ch)  ((ch) == '\n' || (ch) == 0xd)
+
 //Structure to store each entry in qcom_cfg.ini file
 typedef struct
 {
    char *name;
    char *value;
+   v_U32_t hash;
+   /* index + 1 of the next entry in the same hash bucket, 0 ends the chain */
+   v_U16_t next;
 }tCfgIniEntry;
 
+/* Must be a power of 2 */
+#define CFG_INI_HASH_SIZE   512
+
+/*
+ * Parsed qcom_cfg.ini file.
+ * The entries are hashed by name so that resolving each of the registry
+ * table items does not have to walk the whole ini file.
+ */
+typedef struct
+{
+   tCfgIniEntry entry[MAX_CFG_INI_ITEMS];
+   /* index + 1 of the first entry of each hash bucket */
+   v_U16_t bucket[CFG_INI_HASH_SIZE];
+   unsigned long count;
+}tCfgIniTable;
+
 static VOS_STATUS hdd_apply_cfg_ini( hdd_context_t * pHddCtx,
-    tCfgIniEntry* iniTable, unsigned long entries);
+    tCfgIniTable* iniTable);
 
 #ifdef WLAN_CFG_DEBUG
 void dump_cfg_ini (tCfgIniEntry* iniTable, unsigned long entries)
@@ -4109,24 +4144,78 @@ void dump_cfg_ini (tCfgIniEntry* iniTable, unsigned long entries)
 }
 #endif
 
+/* FNV-1a hash of a NUL terminated ini item name */
+static v_U32_t cfg_ini_name_hash(const char *name)
+{
+   v_U32_t hash = 2166136261u;
+
+   while (*name) {
+      hash ^= (v_U8_t)*name++;
+      hash *= 16777619u;
+   }
+   return hash;
+}
+
+static tCfgIniEntry *cfg_ini_lookup(tCfgIniTable *iniTable, const char *name,
+    v_U32_t hash)
+{
+   v_U16_t i = iniTable->bucket[hash & (CFG_INI_HASH_SIZE - 1)];
+   tCfgIniEntry *entry;
+
+   while (i) {
+      entry = &iniTable->entry[i - 1];
+      if (entry->hash == hash && strcmp(entry->name, name) == 0)
+         return entry;
+      i = entry->next;
+   }
+   return NULL;
+}
+
+/*
+ * Add a parsed item to the ini table. As with the earlier linear lookup,
+ * the first occurrence of a name wins.
+ */
+static void cfg_ini_add(tCfgIniTable *iniTable, char *name, char *value)
+{
+   v_U32_t hash = cfg_ini_name_hash(name);
+   v_U16_t *bucket = &iniTable->bucket[hash & (CFG_INI_HASH_SIZE - 1)];
+   tCfgIniEntry *entry;
+
+   if (cfg_ini_lookup(iniTable, name, hash)) {
+      hddLog(LOGW, "%s: duplicate %s entry %s ignored",
+             __func__, WLAN_INI_FILE, name);
+      return;
+   }
+
+   entry = &iniTable->entry[iniTable->count++];
+   entry->name = name;
+   entry->value = value;
+   entry->hash = hash;
+   entry->next = *bucket;
+   *bucket = iniTable->count;
+}
+
 /*
  * This function reads the qcom_cfg.ini file and
  * parses each 'Name=Value' pair in the ini file
  */
 VOS_STATUS hdd_parse_config_ini(hdd_context_t* pHddCtx)
 {
-   int status, i=0;
+   int status;
    /** Pointer for firmware image data */
    const struct firmware *fw = NULL;
-   char *buffer, *line, *pTemp = NULL;
+   char *buffer, *end, *pTemp = NULL;
    size_t size;
-   char *name, *value;
+   char *name, *name_end, *value;
+   v_BOOL_t at_eol;
    /* cfgIniTable is static to avoid excess stack usage */
-   static tCfgIniEntry cfgIniTable[MAX_CFG_INI_ITEMS];
+   static tCfgIniTable cfgIniTable;
    VOS_STATUS vos_status = VOS_STATUS_SUCCESS;
+   v_TIME_t start, fw_time, parse_time;
 
-   memset(cfgIniTable, 0, sizeof(cfgIniTable));
+   memset(&cfgIniTable, 0, sizeof(cfgIniTable));
 
+   start = vos_timer_get_system_time();
    status = request_firmware(&fw, WLAN_INI_FILE, pHddCtx->parent_dev);
 
    if(status)
@@ -4145,7 +4234,10 @@ VOS_STATUS hdd_parse_config_ini(hdd_context_t* pHddCtx)
 
    hddLog(LOG1, "%s: qcom_cfg.ini Size %zu", __func__, fw->size);
 
-   buffer = (char*)vos_mem_malloc(fw->size);
+   fw_time = vos_timer_get_system_time();
+
+   /* one extra byte so that the copy is always NUL terminated */
+   buffer = (char*)vos_mem_malloc(fw->size + 1);
 
    if(NULL == buffer) {
       hddLog(VOS_TRACE_LEVEL_FATAL, "%s: kmalloc failure",__func__);
@@ -4156,52 +4248,76 @@ VOS_STATUS hdd_parse_config_ini(hdd_context_t* pHddCtx)
 
    vos_mem_copy((void*)buffer,(void *)fw->data, fw->size);
    size = fw->size;
+   buffer[size] = '\0';
+   end = buffer + size;
 
-   while (buffer != NULL)
+   /*
+    * Walk the file once: each line is either blank, a '#' comment, the END
+    * marker or 'Name = Value', where the value stops at the first white
+    * space. Name and value are NUL terminated in place.
+    */
+   while (buffer < end)
    {
-      line = get_next_line(buffer);
-      buffer = i_trim(buffer);
+      while (buffer < end && i_isspace(*buffer))
+         buffer++;
+      if (buffer >= end)
+         break;
 
-      hddLog(LOG1, "%s: item", buffer);
+      if (*buffer == '#')
+         goto next_line;
+      if (strncmp(buffer, "END", 3) == 0)
+         break;
 
-      if(strlen((char*)buffer) == 0 || *buffer == '#')  {
-         buffer = line;
+      name = buffer;
+      while (buffer < end && *buffer != '=' && !i_iseol(*buffer))
+         buffer++;
+      if (buffer >= end || *buffer != '=')
          continue;
-      }
-      else if(strncmp(buffer, "END", 3) == 0 ) {
+
+      name_end = buffer++;
+      while (name_end > name && i_isspace(name_end[-1]))
+         name_end--;
+      *name_end = '\0';
+      if (name_end == name)
+         goto next_line;
+
+      while (buffer < end && i_isspace(*buffer) && !i_iseol(*buffer))
+         buffer++;
+      value = buffer;
+      while (buffer < end && !i_isspace(*buffer))
+         buffer++;
+      if (buffer == value)
+         continue;
+
+      at_eol = (buffer >= end) || i_iseol(*buffer);
+      *buffer = '\0';
+      if (buffer < end)
+         buffer++;
+
+      hddLog(LOG1, "%s: item %s=%s", __func__, name, value);
+      cfg_ini_add(&cfgIniTable, name, value);
+      if (cfgIniTable.count >= MAX_CFG_INI_ITEMS) {
+         hddLog(LOGE,"%s: Number of items in %s > %d",
+            __func__, WLAN_INI_FILE, MAX_CFG_INI_ITEMS);
          break;
       }
-      else
-      {
-         name = buffer;
-         while(*buffer != '=' && *buffer != '\0')
-            buffer++;
-         if(*buffer != '\0') {
-            *buffer++ = '\0';
-            i_trim(name);
-            if(strlen (name) != 0) {
-               buffer = i_trim(buffer);
-               if(strlen(buffer)>0) {
-                  value = buffer;
-                  while(!i_isspace(*buffer) && *buffer != '\0')
-                     buffer++;
-                  *buffer = '\0';
-                  cfgIniTable[i].name= name;
-                  cfgIniTable[i++].value= value;
-                  if(i >= MAX_CFG_INI_ITEMS) {
-                     hddLog(LOGE,"%s: Number of items in %s > %d",
-                        __func__, WLAN_INI_FILE, MAX_CFG_INI_ITEMS);
-                     break;
-                  }
-               }
-            }
-         }
-      }
-      buffer = line;
+      if (at_eol)
+         continue;
+
+next_line:
+      while (buffer < end && !i_iseol(*buffer))
+         buffer++;
    }
+   parse_time = vos_timer_get_system_time();
 
    //Loop through the registry table and apply all these configs
-   vos_status = hdd_apply_cfg_ini(pHddCtx, cfgIniTable, i);
+   vos_status = hdd_apply_cfg_ini(pHddCtx, &cfgIniTable);
+
+   hddLog(VOS_TRACE_LEVEL_INFO,
+          "%s: %s %zu bytes, %lu items: load %lu ms, parse %lu ms, apply %lu ms",
+          __func__, WLAN_INI_FILE, size, cfgIniTable.count,
+          fw_time - start, parse_time - fw_time,
+          vos_timer_get_system_time() - parse_time);
 
 config_exit:
    release_firmware(fw);
@@ -4691,22 +4807,20 @@ VOS_STATUS hdd_cfg_get_sap_dyn_config(hdd_adapter_t *pAdapter, char *pBuf,
 }
 #endif
 
-static VOS_STATUS find_cfg_item (tCfgIniEntry* iniTable, unsigned long entries,
-    char *name, char** value)
+static VOS_STATUS find_cfg_item (tCfgIniTable* iniTable, char *name,
+    char** value)
 {
-   VOS_STATUS status = VOS_STATUS_E_FAILURE;
-   unsigned long i;
-
-   for (i = 0; i < entries; i++) {
-     if (strcmp(iniTable[i].name, name) == 0) {
-       *value = iniTable[i].value;
-       VOS_TRACE(VOS_MODULE_ID_HDD, VOS_TRACE_LEVEL_INFO_HIGH, "Found %s entry for Name=[%s] Value=[%s] ",
-           WLAN_INI_FILE, name, *value);
-       return VOS_STATUS_SUCCESS;
-     }
+   tCfgIniEntry *entry;
+
+   entry = cfg_ini_lookup(iniTable, name, cfg_ini_name_hash(name));
+   if (entry) {
+      *value = entry->value;
+      VOS_TRACE(VOS_MODULE_ID_HDD, VOS_TRACE_LEVEL_INFO_HIGH, "Found %s entry for Name=[%s] Value=[%s] ",
+          WLAN_INI_FILE, name, *value);
+      return VOS_STATUS_SUCCESS;
    }
 
-   return status;
+   return VOS_STATUS_E_FAILURE;
 }
 
 static int parseHexDigit(char c)
@@ -5050,7 +5164,7 @@ crypto_hash_err:
     return cryptoStatus;
 }
 
-static VOS_STATUS hdd_apply_cfg_ini( hdd_context_t *pHddCtx, tCfgIniEntry* iniTable, unsigned long entries)
+static VOS_STATUS hdd_apply_cfg_ini( hdd_context_t *pHddCtx, tCfgIniTable* iniTable)
 {
    VOS_STATUS match_status = VOS_STATUS_E_FAILURE;
    VOS_STATUS ret_status = VOS_STATUS_SUCCESS;
@@ -5080,7 +5194,7 @@ static VOS_STATUS hdd_apply_cfg_ini( hdd_context_t *pHddCtx, tCfgIniEntry* iniTa
       //Calculate the address of the destination field in the structure.
       pField = ( (v_U8_t *)pStructBase )+ pRegEntry->VarOffset;
 
-      match_status = find_cfg_item(iniTable, entries, pRegEntry->RegName, &value_str);
+      match_status = find_cfg_item(iniTable, pRegEntry->RegName, &value_str);
 
       if( (match_status != VOS_STATUS_SUCCESS) && ( pRegEntry->Flags & VAR_FLAGS_REQUIRED ) )
       {
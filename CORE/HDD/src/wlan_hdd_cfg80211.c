@@ -9094,6 +9094,61 @@ static int wlan_hdd_cfg80211_update_bss( struct wiphy *wiphy,
     return 0;
 }
 
+#ifdef FEATURE_WLAN_SCAN_RESULT_STREAMING
+/*
+ * FUNCTION: wlan_hdd_cfg80211_scan_result_stream_cb
+ * Reports the BSSs found by a running offloaded scan to cfg80211, so that
+ * they show up before the scan done update of the whole cache.
+ */
+static void wlan_hdd_cfg80211_scan_result_stream_cb(void *pContext,
+                                                    tANI_U8 sessionId,
+                                                    tScanResultHandle hResult)
+{
+    hdd_context_t *pHddCtx = (hdd_context_t *)pContext;
+    hdd_adapter_t *pAdapter;
+    tCsrScanResultInfo *pScanResult;
+    struct cfg80211_bss *bss_status;
+    int count = 0;
+
+    if (0 != wlan_hdd_validate_context(pHddCtx)) {
+        return;
+    }
+
+    pAdapter = hdd_get_adapter_by_vdev(pHddCtx, sessionId);
+    if (NULL == pAdapter) {
+        hddLog(LOGE, FL("No adapter for session %d"), sessionId);
+        sme_ScanResultPurge(pHddCtx->hHal, hResult);
+        return;
+    }
+
+    pScanResult = sme_ScanResultGetFirst(pHddCtx->hHal, hResult);
+    while (pScanResult) {
+        bss_status = wlan_hdd_cfg80211_inform_bss_frame(pAdapter,
+                                                   &pScanResult->BssDescriptor);
+        if (NULL != bss_status) {
+            cfg80211_put_bss(
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(3,9,0))
+                             pHddCtx->wiphy,
+#endif
+                             bss_status);
+            count++;
+        }
+        pScanResult = sme_ScanResultGetNext(pHddCtx->hHal, hResult);
+    }
+
+    sme_ScanResultPurge(pHddCtx->hHal, hResult);
+
+    hddLog(LOG1, FL("Streamed %d BSS on session %d"), count, sessionId);
+}
+
+void wlan_hdd_cfg80211_scan_result_stream_init(hdd_context_t *pHddCtx)
+{
+    sme_ScanRegisterResultStreamCallback(pHddCtx->hHal,
+                                         wlan_hdd_cfg80211_scan_result_stream_cb,
+                                         pHddCtx);
+}
+#endif /* FEATURE_WLAN_SCAN_RESULT_STREAMING */
+
 void
 hddPrintPmkId(tANI_U8 *pmkId, tANI_U8 logLevel)
 {
@@ -14726,7 +14781,7 @@ int __wlan_hdd_cfg80211_resume_wlan(struct wiphy *wiphy)
 #ifdef QCA_CONFIG_SMP
     /* Resume tlshim Rx thread */
     if (pHddCtx->isTlshimRxThreadSuspended) {
-        complete(&vosSchedContext->ResumeTlshimRxEvent);
+        vos_sched_resume_tlshim_rx(vosSchedContext);
         pHddCtx->isTlshimRxThreadSuspended = FALSE;
     }
 
@@ -14947,14 +15002,9 @@ int __wlan_hdd_cfg80211_suspend_wlan(struct wiphy *wiphy,
     pHddCtx->isMcThreadSuspended = TRUE;
 
 #ifdef QCA_CONFIG_SMP
-    /* Suspend tlshim rx thread */
-    set_bit(RX_SUSPEND_EVENT_MASK, &vosSchedContext->tlshimRxEvtFlg);
-    wake_up_interruptible(&vosSchedContext->tlshimRxWaitQueue);
-    rc = wait_for_completion_timeout(
-                     &vosSchedContext->SuspndTlshimRxEvent,
-                     msecs_to_jiffies(RX_TLSHIM_SUSPEND_TIMEOUT));
-    if (!rc) {
-        clear_bit(RX_SUSPEND_EVENT_MASK, &vosSchedContext->tlshimRxEvtFlg);
+    /* Suspend tlshim rx threads */
+    if (vos_sched_suspend_tlshim_rx(vosSchedContext,
+                                    RX_TLSHIM_SUSPEND_TIMEOUT)) {
         VOS_TRACE( VOS_MODULE_ID_HDD, VOS_TRACE_LEVEL_ERROR,
                    "%s: Failed to stop tl_shim rx thread", __func__);
         goto resume_all;
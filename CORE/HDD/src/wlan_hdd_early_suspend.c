@@ -1815,7 +1815,7 @@ VOS_STATUS hdd_wlan_shutdown(void)
    }
 #ifdef QCA_CONFIG_SMP
    if (TRUE == pHddCtx->isTlshimRxThreadSuspended) {
-      complete(&vosSchedContext->ResumeTlshimRxEvent);
+      vos_sched_resume_tlshim_rx(vosSchedContext);
       pHddCtx->isTlshimRxThreadSuspended = FALSE;
     }
 #endif
@@ -1850,21 +1850,10 @@ VOS_STATUS hdd_wlan_shutdown(void)
 
 #ifdef QCA_CONFIG_SMP
    /* Wait for TLshim RX to exit */
-   hddLog(VOS_TRACE_LEVEL_FATAL, "%s: Shutting down TLshim RX thread",
+   hddLog(VOS_TRACE_LEVEL_FATAL, "%s: Shutting down TLshim RX threads",
           __func__);
    unregister_hotcpu_notifier(vosSchedContext->cpuHotPlugNotifier);
-   set_bit(RX_SHUTDOWN_EVENT_MASK, &vosSchedContext->tlshimRxEvtFlg);
-   set_bit(RX_POST_EVENT_MASK, &vosSchedContext->tlshimRxEvtFlg);
-   wake_up_interruptible(&vosSchedContext->tlshimRxWaitQueue);
-   hddLog(VOS_TRACE_LEVEL_FATAL, "%s: Waiting for TLshim RX thread to exit",
-          __func__);
-   wait_for_completion(&vosSchedContext->TlshimRxShutdown);
-   vosSchedContext->TlshimRxThread = NULL;
-   hddLog(VOS_TRACE_LEVEL_FATAL, "%s: Waiting for dropping RX packets",
-          __func__);
-   vos_drop_rxpkt_by_staid(vosSchedContext, WLAN_MAX_STA_COUNT);
-   hddLog(VOS_TRACE_LEVEL_FATAL, "%s: Waiting for freeing freeQ", __func__);
-   vos_free_tlshim_pkt_freeq(vosSchedContext);
+   vos_sched_stop_tlshim_rx(vosSchedContext);
 #endif
 
 #ifdef WLAN_BTAMP_FEATURE
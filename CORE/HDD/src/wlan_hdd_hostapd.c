@@ -5154,6 +5154,9 @@ hdd_adapter_t* hdd_wlan_create_ap_dev( hdd_context_t *pHddCtx, tSirMacAddr macAd
         pHostapdAdapter->scan_info.scan_pending_option = WEXT_SCAN_PENDING_GIVEUP;
 
         SET_NETDEV_DEV(pWlanHostapdDev, pHddCtx->parent_dev);
+        spin_lock_init(&pHostapdAdapter->rx_stats_lock);
+        if (pHddCtx->cfg_ini->enableRxNapi)
+            hdd_rx_napi_init(pHostapdAdapter);
     }
     return pHostapdAdapter;
 }
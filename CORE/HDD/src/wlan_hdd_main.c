@@ -8267,6 +8267,9 @@ static hdd_adapter_t* hdd_alloc_station_adapter( hdd_context_t *pHddCtx, tSirMac
       /* set pWlanDev's parent to underlying device */
       SET_NETDEV_DEV(pWlanDev, pHddCtx->parent_dev);
       hdd_wmm_init( pAdapter );
+      spin_lock_init(&pAdapter->rx_stats_lock);
+      if (pHddCtx->cfg_ini->enableRxNapi)
+         hdd_rx_napi_init(pAdapter);
    }
 
    return pAdapter;
@@ -8630,6 +8633,8 @@ void hdd_cleanup_adapter(hdd_context_t *pHddCtx, hdd_adapter_t *pAdapter,
     */
    clear_bit(DEVICE_IFACE_OPENED, &pAdapter->event_flags);
 
+   hdd_rx_napi_deinit(pAdapter);
+
    if (test_bit(NET_DEVICE_REGISTERED, &pAdapter->event_flags)) {
       if (rtnl_held) {
          unregister_netdevice(pWlanDev);
@@ -12445,6 +12450,9 @@ int hdd_wlan_startup(struct device *dev, v_VOID_t *hif_sc)
 #ifdef WLAN_FEATURE_STATS_EXT
    wlan_hdd_cfg80211_stats_ext_init(pHddCtx);
 #endif
+#ifdef FEATURE_WLAN_SCAN_RESULT_STREAMING
+   wlan_hdd_cfg80211_scan_result_stream_init(pHddCtx);
+#endif
 #ifdef FEATURE_WLAN_EXTSCAN
     sme_ExtScanRegisterCallback(pHddCtx->hHal,
                                 wlan_hdd_cfg80211_extscan_callback);
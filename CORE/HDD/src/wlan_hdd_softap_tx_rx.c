@@ -1235,6 +1235,7 @@ VOS_STATUS hdd_softap_rx_packet_cbk(v_VOID_t *vosContext,
    v_U8_t proto_type;
 #endif /* QCA_PKT_PROTO_TRACE */
    struct sk_buff *skb_next;
+   hdd_rx_chain_stats_t rxStats = { 0 };
 
    //Sanity check on inputs
    if ((NULL == vosContext) || (NULL == rxBuf))
@@ -1269,7 +1270,7 @@ VOS_STATUS hdd_softap_rx_packet_cbk(v_VOID_t *vosContext,
        return VOS_STATUS_E_FAILURE;
    }
 
-   ++pAdapter->hdd_stats.hddTxRxStats.rxChains;
+   rxStats.chains = 1;
 
    // walk the chain until all are processed
    skb = (struct sk_buff *) rxBuf;
@@ -1278,9 +1279,8 @@ VOS_STATUS hdd_softap_rx_packet_cbk(v_VOID_t *vosContext,
       skb_next = skb->next;
       skb->dev = pAdapter->dev;
 
-      ++pAdapter->hdd_stats.hddTxRxStats.rxPackets;
-      ++pAdapter->stats.rx_packets;
-      pAdapter->stats.rx_bytes += skb->len;
+      ++rxStats.packets;
+      rxStats.bytes += skb->len;
 
 #ifdef QCA_PKT_PROTO_TRACE
       if ((pHddCtx->cfg_ini->gEnableDebugLog & VOS_PKT_TRAC_TYPE_EAPOL) ||
@@ -1299,6 +1299,15 @@ VOS_STATUS hdd_softap_rx_packet_cbk(v_VOID_t *vosContext,
 
       skb->protocol = eth_type_trans(skb, skb->dev);
 
+      if (pAdapter->rx_napi_enabled) {
+         if (NET_RX_SUCCESS != hdd_rx_napi_enqueue(pAdapter, skb)) {
+            ++rxStats.napiQueueDropped;
+            ++rxStats.refused;
+         }
+         skb = skb_next;
+         continue;
+      }
+
       /*
        * If this is not a last packet on the chain
        * Just put packet into backlog queue, not scheduling RX sirq
@@ -1318,12 +1327,21 @@ VOS_STATUS hdd_softap_rx_packet_cbk(v_VOID_t *vosContext,
       }
 
       if (NET_RX_SUCCESS == rxstat)
-         ++pAdapter->hdd_stats.hddTxRxStats.rxDelivered;
+         ++rxStats.delivered;
       else
-         ++pAdapter->hdd_stats.hddTxRxStats.rxRefused;
+         ++rxStats.refused;
 
       skb = skb_next;
    }
+   hdd_rx_stats_update(pAdapter, &rxStats);
+
+   if (pAdapter->rx_napi_enabled) {
+#ifdef WLAN_FEATURE_HOLD_RX_WAKELOCK
+      vos_wake_lock_timeout_acquire(&pHddCtx->rx_wake_lock,
+                                    HDD_WAKE_LOCK_DURATION);
+#endif
+      hdd_rx_napi_schedule(pAdapter);
+   }
    pAdapter->dev->last_rx = jiffies;
 
    return VOS_STATUS_SUCCESS;
@@ -1691,6 +1691,125 @@ bool drop_ip6_mcast(struct sk_buff *skb)
 #define drop_ip6_mcast(_a) 0
 #endif
 
+/* max frames handed to GRO per NAPI poll */
+#define HDD_RX_NAPI_BUDGET 64
+
+/**============================================================================
+  @brief hdd_rx_napi_poll() - NAPI poll handler, hands queued rx frames
+  to GRO.
+
+  @param napi   : [in] the adapter's rx NAPI context
+  @param budget : [in] max number of frames to process
+
+  @return       : number of frames processed
+  ===========================================================================*/
+static int hdd_rx_napi_poll(struct napi_struct *napi, int budget)
+{
+   hdd_adapter_t *pAdapter = container_of(napi, hdd_adapter_t, rx_napi);
+   hdd_rx_chain_stats_t rxStats = { 0 };
+   struct sk_buff *skb;
+   int work_done = 0;
+
+   /* the GRO counters are only updated here, and polls never overlap */
+   ++pAdapter->hdd_stats.hddTxRxStats.rxNapiPolls;
+   while (work_done < budget &&
+          NULL != (skb = skb_dequeue(&pAdapter->rx_napi_queue))) {
+      switch (napi_gro_receive(napi, skb)) {
+      case GRO_MERGED:
+      case GRO_MERGED_FREE:
+         ++pAdapter->hdd_stats.hddTxRxStats.rxGroAggregated;
+         ++rxStats.delivered;
+         break;
+      case GRO_HELD:
+         ++pAdapter->hdd_stats.hddTxRxStats.rxGroHeld;
+         ++rxStats.delivered;
+         break;
+      case GRO_DROP:
+         ++rxStats.refused;
+         break;
+      default:
+         ++pAdapter->hdd_stats.hddTxRxStats.rxGroFlushed;
+         ++rxStats.delivered;
+         break;
+      }
+      work_done++;
+   }
+   hdd_rx_stats_update(pAdapter, &rxStats);
+
+   if (work_done < budget) {
+      /* napi_complete also flushes the segments GRO is still holding */
+      napi_complete(napi);
+      /* catch frames queued after the last dequeue, before completion */
+      if (!skb_queue_empty(&pAdapter->rx_napi_queue))
+         napi_schedule(napi);
+   }
+   return work_done;
+}
+
+void hdd_rx_stats_update(hdd_adapter_t *pAdapter,
+                         const hdd_rx_chain_stats_t *pRxStats)
+{
+   hdd_tx_rx_stats_t *pStats = &pAdapter->hdd_stats.hddTxRxStats;
+
+   spin_lock_bh(&pAdapter->rx_stats_lock);
+   pStats->rxChains += pRxStats->chains;
+   pStats->rxPackets += pRxStats->packets;
+   pStats->rxDropped += pRxStats->dropped;
+   pStats->rxDelivered += pRxStats->delivered;
+   pStats->rxRefused += pRxStats->refused;
+   pStats->rxNapiQueueDropped += pRxStats->napiQueueDropped;
+   pAdapter->stats.rx_packets += pRxStats->packets;
+   pAdapter->stats.rx_bytes += pRxStats->bytes;
+   spin_unlock_bh(&pAdapter->rx_stats_lock);
+}
+
+void hdd_rx_napi_init(hdd_adapter_t *pAdapter)
+{
+   skb_queue_head_init(&pAdapter->rx_napi_queue);
+   netif_napi_add(pAdapter->dev, &pAdapter->rx_napi, hdd_rx_napi_poll,
+                  HDD_RX_NAPI_BUDGET);
+   napi_enable(&pAdapter->rx_napi);
+   pAdapter->rx_napi_enabled = VOS_TRUE;
+}
+
+void hdd_rx_napi_deinit(hdd_adapter_t *pAdapter)
+{
+   if (!pAdapter->rx_napi_enabled)
+      return;
+
+   pAdapter->rx_napi_enabled = VOS_FALSE;
+   napi_disable(&pAdapter->rx_napi);
+   netif_napi_del(&pAdapter->rx_napi);
+   skb_queue_purge(&pAdapter->rx_napi_queue);
+}
+
+int hdd_rx_napi_enqueue(hdd_adapter_t *pAdapter, struct sk_buff *skb)
+{
+   /*
+    * The poll only runs once the rx thread lets go of the CPU, so bound
+    * the queue the same way netif_rx bounds the per-CPU backlog.
+    */
+   if (skb_queue_len(&pAdapter->rx_napi_queue) >= netdev_max_backlog) {
+      kfree_skb(skb);
+      return NET_RX_DROP;
+   }
+   /* delivered to GRO from hdd_rx_napi_poll */
+   skb_queue_tail(&pAdapter->rx_napi_queue, skb);
+   return NET_RX_SUCCESS;
+}
+
+void hdd_rx_napi_schedule(hdd_adapter_t *pAdapter)
+{
+   /*
+    * The rx callbacks normally run in the TL shim rx thread, so keep
+    * bottom halves off around the schedule; the NET_RX softirq then
+    * runs the poll as soon as they are re-enabled.
+    */
+   local_bh_disable();
+   napi_schedule(&pAdapter->rx_napi);
+   local_bh_enable();
+}
+
 
 
 /**============================================================================
@@ -1717,6 +1836,7 @@ VOS_STATUS hdd_rx_packet_cbk(v_VOID_t *vosContext,
    v_U8_t proto_type;
 #endif /* QCA_PKT_PROTO_TRACE */
    hdd_station_ctx_t *pHddStaCtx = NULL;
+   hdd_rx_chain_stats_t rxStats = { 0 };
 
    //Sanity check on inputs
    if ((NULL == vosContext) || (NULL == rxBuf))
@@ -1744,7 +1864,7 @@ VOS_STATUS hdd_rx_packet_cbk(v_VOID_t *vosContext,
           pAdapter->magic);
        return VOS_STATUS_E_FAILURE;
    }
-   ++pAdapter->hdd_stats.hddTxRxStats.rxChains;
+   rxStats.chains = 1;
 
    // walk the chain until all are processed
    skb = (struct sk_buff *) rxBuf;
@@ -1754,7 +1874,7 @@ VOS_STATUS hdd_rx_packet_cbk(v_VOID_t *vosContext,
 
        if ((pHddStaCtx->conn_info.proxyARPService) &&
           cfg80211_is_gratuitous_arp_unsolicited_na(skb)) {
-             ++pAdapter->hdd_stats.hddTxRxStats.rxDropped;
+             ++rxStats.dropped;
              VOS_TRACE(VOS_MODULE_ID_HDD_DATA, VOS_TRACE_LEVEL_INFO,
                 "%s: Dropping HS 2.0 Gratuitous ARP or Unsolicited NA", __func__);
              kfree_skb(skb);
@@ -1782,7 +1902,7 @@ VOS_STATUS hdd_rx_packet_cbk(v_VOID_t *vosContext,
    if (drop_ip6_mcast(skb)) {
          print_hex_dump_bytes("MAC Header",
          DUMP_PREFIX_NONE, skb_mac_header(skb), 16);
-         ++pAdapter->hdd_stats.hddTxRxStats.rxDropped;
+         ++rxStats.dropped;
          VOS_TRACE(VOS_MODULE_ID_HDD_DATA, VOS_TRACE_LEVEL_ERROR,
             "%s: Dropping multicast to self NA", __func__);
           kfree_skb(skb);
@@ -1791,9 +1911,24 @@ VOS_STATUS hdd_rx_packet_cbk(v_VOID_t *vosContext,
           continue;
        }
  
-       ++pAdapter->hdd_stats.hddTxRxStats.rxPackets;
-       ++pAdapter->stats.rx_packets;
-       pAdapter->stats.rx_bytes += skb->len;
+       ++rxStats.packets;
+       rxStats.bytes += skb->len;
+
+       if ((NULL == skb->next) && (dumpEnable == 1)) {
+          VOS_TRACE(VOS_MODULE_ID_HDD, VOS_TRACE_LEVEL_ERROR,
+                    "%s: RX-data dump\n", __func__);
+          VOS_TRACE_HEX_DUMP(VOS_MODULE_ID_HDD, VOS_TRACE_LEVEL_ERROR,
+                             skb->data, 64);
+       }
+
+       if (pAdapter->rx_napi_enabled) {
+          if (NET_RX_SUCCESS != hdd_rx_napi_enqueue(pAdapter, skb)) {
+             ++rxStats.napiQueueDropped;
+             ++rxStats.refused;
+          }
+          skb = skb_next;
+          continue;
+       }
  
        /*
         * If this is not a last packet on the chain
@@ -1806,12 +1941,6 @@ VOS_STATUS hdd_rx_packet_cbk(v_VOID_t *vosContext,
            vos_wake_lock_timeout_acquire(&pHddCtx->rx_wake_lock,
                    HDD_WAKE_LOCK_DURATION);
 #endif
-                  if (dumpEnable == 1) {
-                          VOS_TRACE(VOS_MODULE_ID_HDD, VOS_TRACE_LEVEL_ERROR, 
-                              "%s: RX-data dump\n", __func__);
-                          VOS_TRACE_HEX_DUMP(VOS_MODULE_ID_HDD, VOS_TRACE_LEVEL_ERROR,
-                              skb->data, 64);
-                  }
           /*
            * This is the last packet on the chain
            * Scheduling rx sirq
@@ -1820,12 +1949,21 @@ VOS_STATUS hdd_rx_packet_cbk(v_VOID_t *vosContext,
        }
  
        if (NET_RX_SUCCESS == rxstat)
-          ++pAdapter->hdd_stats.hddTxRxStats.rxDelivered;
+          ++rxStats.delivered;
        else
-          ++pAdapter->hdd_stats.hddTxRxStats.rxRefused;
+          ++rxStats.refused;
  
        skb = skb_next;
    }
+   hdd_rx_stats_update(pAdapter, &rxStats);
+
+   if (pAdapter->rx_napi_enabled) {
+#ifdef WLAN_FEATURE_HOLD_RX_WAKELOCK
+      vos_wake_lock_timeout_acquire(&pHddCtx->rx_wake_lock,
+                                    HDD_WAKE_LOCK_DURATION);
+#endif
+      hdd_rx_napi_schedule(pAdapter);
+   }
 
    pAdapter->dev->last_rx = jiffies;
 
@@ -102,6 +102,7 @@
 #include "wlan_qct_wda.h"
 #include "vos_trace.h"
 #include "wlan_hdd_assoc.h"
+#include "vos_sched.h"
 
 #ifdef QCA_PKT_PROTO_TRACE
 #include "vos_packet.h"
@@ -367,6 +368,9 @@ static const hdd_freq_chan_map_t freq_chan_map[] = { {2412, 1}, {2417, 2},
 #define WE_DUMP_PCIE_LOG           16
 #endif
 #define WE_GET_RECOVERY_STAT       17
+#ifdef HIF_PCI_CE_INTR_MOD
+#define WE_DUMP_CE_INTR_MOD        18
+#endif
 
 /* Private ioctls and their sub-ioctls */
 #define WLAN_PRIV_SET_VAR_INT_GET_NONE   (SIOCIWFIRSTPRIV + 7)
@@ -6852,6 +6856,8 @@ static int iw_get_char_setnone(struct net_device *dev, struct iw_request_info *i
                      "\n      flushed BK %u, BE %u, VI %u, VO %u"
                      "\n\nReceive"
                      "\nchains %u, packets %u, dropped %u, delivered %u, refused %u"
+                     "\nnapi polls %u, napi queue dropped %u"
+                     "\ngro aggregated %u, gro held %u, gro flushed %u"
                      "\n",
                      pStats->txXmitCalled,
                      pStats->txXmitDropped,
@@ -6918,8 +6924,23 @@ static int iw_get_char_setnone(struct net_device *dev, struct iw_request_info *i
                      pStats->rxPackets,
                      pStats->rxDropped,
                      pStats->rxDelivered,
-                     pStats->rxRefused
+                     pStats->rxRefused,
+                     pStats->rxNapiPolls,
+                     pStats->rxNapiQueueDropped,
+                     pStats->rxGroAggregated,
+                     pStats->rxGroHeld,
+                     pStats->rxGroFlushed
                      );
+#ifdef QCA_CONFIG_SMP
+            {
+                pVosSchedContext sched_ctx = get_vos_sched_ctxt();
+                int len = strlen(extra);
+
+                if (sched_ctx)
+                    vos_sched_tlshim_rx_stats_print(sched_ctx, extra + len,
+                                                    WE_MAX_STR_LEN - len);
+            }
+#endif
             wrqu->data.length = strlen(extra)+1;
             break;
         }
@@ -7468,6 +7489,16 @@ static int iw_setnone_getnone(struct net_device *dev, struct iw_request_info *in
                                         0, GEN_CMD);
           break;
         }
+#endif
+#ifdef HIF_PCI_CE_INTR_MOD
+        case WE_DUMP_CE_INTR_MOD:
+        {
+            hddLog(LOG1, "WE_DUMP_CE_INTR_MOD");
+            ret = process_wma_set_command((int)pAdapter->sessionId,
+                                          (int)GEN_PARAM_DUMP_CE_INTR_MOD,
+                                          0, GEN_CMD);
+            break;
+        }
 #endif
         default:
         {
@@ -10686,6 +10717,12 @@ static const struct iw_priv_args we_private_args[] = {
         0,
         0,
         "dump_pcie_log" },
+#endif
+#ifdef HIF_PCI_CE_INTR_MOD
+    {   WE_DUMP_CE_INTR_MOD,
+        0,
+        0,
+        "dump_ce_intr" },
 #endif
     /* handlers for main ioctl */
     {   WLAN_PRIV_SET_VAR_INT_GET_NONE,
@@ -889,6 +889,7 @@ tLimMlmOemDataRsp       *gpLimMlmOemDataRsp;
     tANI_U8 fOffloadScanPending; /*Flag to track offload scan */
     tANI_U8 fOffloadScanP2PSearch; /*Flag to track the p2p search */
     tANI_U8 fOffloadScanP2PListen; /*Flag to track the p2p listen */
+    tANI_U8 offloadScanSessionId; /*SME session of the pending offload scan */
     tANI_U8 probeCounter;
     tANI_U8 maxProbe;
 } tAniSirLim, *tpAniSirLim;
@@ -980,6 +981,9 @@ typedef struct sMacOpenParameters
     /* is RX re-ordering offloaded to the fw */
     tANI_U8 reorderOffload;
 
+    /* rx in-order paddr -> netbuf lookup structure */
+    tANI_U8 rxInOrderLookupMode;
+
     /* dfs radar pri multiplier */
     tANI_S32 dfsRadarPriMultiplier;
 
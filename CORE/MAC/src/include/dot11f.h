@@ -7934,6 +7934,9 @@ tANI_U32 dot11fUnpackWMMDelTS(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf,
 tANI_U32 dot11fPackWMMDelTS(tpAniSirGlobal pCtx, tDot11fWMMDelTS *pFrm, tANI_U8 *pBuf, tANI_U32 nBuf, tANI_U32 *pnConsumed);
 tANI_U32 dot11fGetPackedWMMDelTSSize(tpAniSirGlobal pCtx, tDot11fWMMDelTS *pFrm, tANI_U32 *pnNeeded);
 
+/* Build the EID lookup indexes of the unpackers; call once before unpacking */
+void dot11fInitIEIndexes(void);
+
 #ifdef __cplusplus
 } /* End extern "C". */
 #endif /* C++ */
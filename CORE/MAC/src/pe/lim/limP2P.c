@@ -162,6 +162,7 @@ static eHalStatus limSendHalReqRemainOnChanOffload(tpAniSirGlobal pMac,
     }
 
     pMac->lim.fOffloadScanPending = 1;
+    pMac->lim.offloadScanSessionId = pRemOnChnReq->sessionId;
     pMac->lim.fOffloadScanP2PListen = 1;
 
     return eHAL_STATUS_SUCCESS;
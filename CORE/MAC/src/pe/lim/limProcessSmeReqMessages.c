@@ -1256,6 +1256,7 @@ static eHalStatus limSendHalStartScanOffloadReq(tpAniSirGlobal pMac,
     }
 
     pMac->lim.fOffloadScanPending = 1;
+    pMac->lim.offloadScanSessionId = pScanReq->sessionId;
     if (pScanReq->p2pSearch)
         pMac->lim.fOffloadScanP2PSearch = 1;
 
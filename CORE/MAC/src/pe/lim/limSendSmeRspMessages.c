@@ -2169,7 +2169,9 @@ limSendSmeRemoveKeyRsp(tpAniSirGlobal pMac,
  *NOTE:
  * This function is used for sending eWNI_SME_NEIGHBOR_BSS_IND to
  * host upon detecting new BSS during background scanning if CFG
- * option is enabled for sending such indication
+ * option is enabled for sending such indication. With scan result
+ * streaming, it is also sent for every new BSS heard during an
+ * offloaded scan so that SME can report it before the scan ends.
  *
  * @param  pMac - Pointer to Global MAC structure
  * @return None
@@ -2182,26 +2184,34 @@ limSendSmeNeighborBssInd(tpAniSirGlobal pMac,
     tSirMsgQ                 msgQ;
     tANI_U32                      val;
     tSirSmeNeighborBssInd    *pNewBssInd;
+    tANI_BOOLEAN             fStreaming = eANI_BOOLEAN_FALSE;
 
-    if ((pMac->lim.gLimSmeState != eLIM_SME_LINK_EST_WT_SCAN_STATE) ||
-        ((pMac->lim.gLimSmeState == eLIM_SME_LINK_EST_WT_SCAN_STATE) &&
-         pMac->lim.gLimRspReqd))
-    {
-        // LIM is not in background scan state OR
-        // current scan is initiated by HDD.
-        // No need to send new BSS indication to HDD
-        return;
-    }
+#ifdef FEATURE_WLAN_SCAN_RESULT_STREAMING
+    fStreaming = (pMac->fScanOffload && pMac->lim.fOffloadScanPending);
+#endif
 
-    if (wlan_cfgGetInt(pMac, WNI_CFG_NEW_BSS_FOUND_IND, &val) != eSIR_SUCCESS)
+    if (!fStreaming)
     {
-        limLog(pMac, LOGP, FL("could not get NEIGHBOR_BSS_IND from CFG"));
+        if ((pMac->lim.gLimSmeState != eLIM_SME_LINK_EST_WT_SCAN_STATE) ||
+            ((pMac->lim.gLimSmeState == eLIM_SME_LINK_EST_WT_SCAN_STATE) &&
+             pMac->lim.gLimRspReqd))
+        {
+            // LIM is not in background scan state OR
+            // current scan is initiated by HDD.
+            // No need to send new BSS indication to HDD
+            return;
+        }
 
-        return;
-    }
+        if (wlan_cfgGetInt(pMac, WNI_CFG_NEW_BSS_FOUND_IND, &val) != eSIR_SUCCESS)
+        {
+            limLog(pMac, LOGP, FL("could not get NEIGHBOR_BSS_IND from CFG"));
 
-    if (val == 0)
-        return;
+            return;
+        }
+
+        if (val == 0)
+            return;
+    }
 
     /**
      * Need to indicate new BSSs found during
@@ -2223,7 +2233,8 @@ limSendSmeNeighborBssInd(tpAniSirGlobal pMac,
 
     pNewBssInd->messageType = eWNI_SME_NEIGHBOR_BSS_IND;
     pNewBssInd->length      = (tANI_U16) val;
-    pNewBssInd->sessionId = 0;
+    //Streamed results are reported on the session that requested the scan
+    pNewBssInd->sessionId = fStreaming ? pMac->lim.offloadScanSessionId : 0;
 
     vos_mem_copy( (tANI_U8 *) pNewBssInd->bssDescription,
                   (tANI_U8 *) &pBssDescr->bssDescription,
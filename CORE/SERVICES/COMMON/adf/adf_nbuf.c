@@ -29,6 +29,7 @@
 #include <linux/kernel.h>
 #include <linux/version.h>
 #include <linux/skbuff.h>
+#include <linux/interrupt.h>
 #include <linux/module.h>
 #include <adf_os_types.h>
 #include <adf_nbuf.h>
@@ -111,6 +112,41 @@ __adf_nbuf_free(struct sk_buff *skb)
     dev_kfree_skb_any(skb);
 }
 
+/*
+ * @brief free a list of nbufs chained through their next pointers
+ * @details
+ *  When called from softirq context (tx completion processing), the skbs
+ *  are handed to the NAPI bulk free cache, which returns the skb heads to
+ *  the slab in batches instead of one kmem_cache_free per frame.
+ * @param skb - head of the list
+ */
+void
+__adf_nbuf_free_list(struct sk_buff *skb)
+{
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 6, 0)
+    int budget = (in_serving_softirq() && !in_irq() && !irqs_disabled());
+#endif
+
+    while (skb) {
+        struct sk_buff *next = skb->next;
+
+        skb->next = NULL;
+#if defined(IPA_OFFLOAD) && !defined(IPA_UC_OFFLOAD)
+        if ((NBUF_OWNER_ID(skb) == IPA_NBUF_OWNER_ID) && NBUF_CALLBACK_FN(skb)) {
+            NBUF_CALLBACK_FN_EXEC(skb);
+            skb = next;
+            continue;
+        }
+#endif
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 6, 0)
+        napi_consume_skb(skb, budget);
+#else
+        dev_kfree_skb_any(skb);
+#endif
+        skb = next;
+    }
+}
+
 
 /*
  * @brief Reference the nbuf so it can get held until the last free.
@@ -255,6 +291,145 @@ __adf_nbuf_unmap_single(
 #endif	/* #if !defined(A_SIMOS_DEVHOST) */
 }
 
+#ifdef __ADF_NBUF_RX_PAGE_POOL
+/**
+ * @brief allocate a page for rx netbufs and map the whole page
+ *        for the life of the page
+ *
+ * @param osdev
+ * @param rx_page
+ * @param dir
+ *
+ * @return a_status_t
+ */
+a_status_t
+__adf_nbuf_rx_page_alloc(adf_os_device_t osdev,
+                         __adf_nbuf_rx_page_t *rx_page, adf_os_dma_dir_t dir)
+{
+    struct page *page;
+    dma_addr_t paddr;
+
+    /* leave the emergency reserves to the stack */
+    page = alloc_page(GFP_ATOMIC | __GFP_NOMEMALLOC);
+    if (!page)
+        return A_STATUS_ENOMEM;
+
+    paddr = dma_map_single(osdev->dev, page_address(page), PAGE_SIZE, dir);
+    if (dma_mapping_error(osdev->dev, paddr)) {
+        __free_page(page);
+        return A_STATUS_FAILED;
+    }
+    rx_page->page = page;
+    rx_page->paddr = paddr;
+    return A_STATUS_OK;
+}
+
+/**
+ * @brief unmap an rx page and drop the pool's reference to it
+ * @details
+ *  Netbufs built on the page may still be held by the stack. Their data
+ *  was synced for the CPU when they left the device, so the unmap must
+ *  not invalidate the cache again.
+ *
+ * @param osdev
+ * @param rx_page
+ * @param dir
+ */
+void
+__adf_nbuf_rx_page_release(adf_os_device_t osdev,
+                           __adf_nbuf_rx_page_t *rx_page, adf_os_dma_dir_t dir)
+{
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 8, 0)
+    dma_unmap_single_attrs(osdev->dev, rx_page->paddr, PAGE_SIZE, dir,
+                           DMA_ATTR_SKIP_CPU_SYNC);
+#else
+    DEFINE_DMA_ATTRS(attrs);
+
+    dma_set_attr(DMA_ATTR_SKIP_CPU_SYNC, &attrs);
+    dma_unmap_single_attrs(osdev->dev, rx_page->paddr, PAGE_SIZE, dir,
+                           &attrs);
+#endif
+    put_page(rx_page->page);
+    rx_page->page = NULL;
+}
+
+/**
+ * @brief build an nbuf on an rx page, in the state __adf_nbuf_alloc()
+ *        leaves a new one in
+ *
+ * @param osdev
+ * @param rx_page
+ *
+ * @return nbuf or NULL if no memory
+ */
+struct sk_buff *
+__adf_nbuf_rx_page_build(adf_os_device_t osdev, __adf_nbuf_rx_page_t *rx_page)
+{
+    struct sk_buff *skb;
+
+    skb = build_skb(page_address(rx_page->page), PAGE_SIZE);
+    if (!skb)
+        return NULL;
+
+    /* dropped by the stack's put_page() of the head when the skb is freed */
+    get_page(rx_page->page);
+
+    skb_reserve(skb, NET_SKB_PAD);
+    memset(skb->cb, 0x0, sizeof(skb->cb));
+    NBUF_EXTRA_FRAG_WORDSTREAM_FLAGS(skb) =
+        (1 << (CVG_NBUF_MAX_EXTRA_FRAGS + 1)) - 1;
+    return skb;
+}
+
+/**
+ * @brief hand an nbuf built on an rx page to the device
+ * @details
+ *  The page is already mapped, so this only syncs the nbuf's data for
+ *  the device and records its bus address, as __adf_nbuf_map() does.
+ *  The device holds a page reference until __adf_nbuf_rx_page_unmap().
+ *
+ * @param osdev
+ * @param rx_page
+ * @param skb
+ * @param dir
+ */
+void
+__adf_nbuf_rx_page_map(adf_os_device_t osdev, __adf_nbuf_rx_page_t *rx_page,
+                       struct sk_buff *skb, adf_os_dma_dir_t dir)
+{
+    unsigned long offset =
+        skb->data - (unsigned char *)page_address(rx_page->page);
+
+    get_page(rx_page->page);
+    dma_sync_single_range_for_device(osdev->dev, rx_page->paddr, offset,
+                                     skb_end_pointer(skb) - skb->data, dir);
+    NBUF_MAPPED_PADDR_LO(skb) = rx_page->paddr + offset;
+}
+
+/**
+ * @brief take an nbuf built on an rx page back from the device
+ * @details
+ *  Syncs the nbuf's data for the CPU and drops the device's page
+ *  reference. The page itself stays mapped.
+ *
+ * @param osdev
+ * @param skb
+ * @param dir
+ */
+void
+__adf_nbuf_rx_page_unmap(adf_os_device_t osdev, struct sk_buff *skb,
+                         adf_os_dma_dir_t dir)
+{
+    struct page *page = virt_to_head_page(skb->head);
+    unsigned long offset = skb->data - (unsigned char *)page_address(page);
+
+    dma_sync_single_range_for_cpu(osdev->dev,
+                                  NBUF_MAPPED_PADDR_LO(skb) - offset, offset,
+                                  skb_end_pointer(skb) - skb->data, dir);
+    put_page(page);
+}
+#endif /* __ADF_NBUF_RX_PAGE_POOL */
+
 /**
  * @brief return the dma map info
  *
@@ -431,6 +606,7 @@ __adf_nbuf_trace_update(struct sk_buff *buf, char *event_string)
 
 EXPORT_SYMBOL(__adf_nbuf_alloc);
 EXPORT_SYMBOL(__adf_nbuf_free);
+EXPORT_SYMBOL(__adf_nbuf_free_list);
 EXPORT_SYMBOL(__adf_nbuf_ref);
 EXPORT_SYMBOL(__adf_nbuf_shared);
 EXPORT_SYMBOL(__adf_nbuf_frag_info);
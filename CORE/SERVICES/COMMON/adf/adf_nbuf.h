@@ -58,6 +58,7 @@
  * @brief Platform indepedent packet abstraction
  */
 typedef __adf_nbuf_t         adf_nbuf_t;
+typedef __adf_nbuf_timestamp_t adf_nbuf_timestamp_t;
 
 /**
  * @brief Dma map callback prototype
@@ -185,6 +186,120 @@ adf_nbuf_unmap_single(
 #endif
 }
 
+#ifdef __ADF_NBUF_RX_PAGE_POOL
+/**
+ * rx page pool support
+ *
+ * An rx page is mapped once when it is allocated and stays mapped until
+ * it is released. Netbufs are built on it one at a time and handed to
+ * the device with adf_nbuf_rx_page_map(), which only syncs the data for
+ * the device. A netbuf freed by whoever holds it last, the driver or the
+ * network stack, gives the page back to its owner without any callback.
+ */
+#define ADF_NBUF_RX_PAGE_POOL
+
+typedef __adf_nbuf_rx_page_t adf_nbuf_rx_page_t;
+
+/**
+ * @brief Allocate an rx page and map it to local bus address space
+ *
+ * @param[in]  osdev    os device
+ * @param[out] rx_page  page and its bus address
+ * @param[in]  dir      DMA direction
+ *
+ * @return status of the operation
+ */
+static inline a_status_t
+adf_nbuf_rx_page_alloc(adf_os_device_t osdev, adf_nbuf_rx_page_t *rx_page,
+                       adf_os_dma_dir_t dir)
+{
+    return __adf_nbuf_rx_page_alloc(osdev, rx_page, dir);
+}
+
+/**
+ * @brief Unmap an rx page and drop the owner's reference
+ * @details
+ *  The page is freed once the netbufs built on it are freed.
+ *
+ * @param[in] osdev    os device
+ * @param[in] rx_page  page from adf_nbuf_rx_page_alloc()
+ * @param[in] dir      DMA direction
+ */
+static inline void
+adf_nbuf_rx_page_release(adf_os_device_t osdev, adf_nbuf_rx_page_t *rx_page,
+                         adf_os_dma_dir_t dir)
+{
+    __adf_nbuf_rx_page_release(osdev, rx_page, dir);
+}
+
+/**
+ * @brief Number of references held on an rx page
+ * @details
+ *  1 if only the owner holds the page, plus one for each netbuf built on
+ *  it and one while such a netbuf is mapped for the device.
+ *
+ * @param[in] rx_page  page from adf_nbuf_rx_page_alloc()
+ *
+ * @return reference count
+ */
+static inline int
+adf_nbuf_rx_page_refs(adf_nbuf_rx_page_t *rx_page)
+{
+    return __adf_nbuf_rx_page_refs(rx_page);
+}
+
+/**
+ * @brief Build a netbuf on an rx page
+ * @details
+ *  The netbuf is in the state adf_nbuf_alloc() returns a new one in,
+ *  with NET_SKB_PAD headroom and 4 byte aligned data.
+ *
+ * @param[in] osdev    os device
+ * @param[in] rx_page  page from adf_nbuf_rx_page_alloc()
+ *
+ * @return netbuf or NULL if no memory
+ */
+static inline adf_nbuf_t
+adf_nbuf_rx_page_build(adf_os_device_t osdev, adf_nbuf_rx_page_t *rx_page)
+{
+    return __adf_nbuf_rx_page_build(osdev, rx_page);
+}
+
+/**
+ * @brief Hand a netbuf built on an rx page to the device
+ * @details
+ *  Counterpart of adf_nbuf_map(), the mapping info is stored in the
+ *  buf's meta-data area.
+ *
+ * @param[in] osdev    os device
+ * @param[in] rx_page  page the netbuf was built on
+ * @param[in] buf      netbuf from adf_nbuf_rx_page_build()
+ * @param[in] dir      DMA direction
+ */
+static inline void
+adf_nbuf_rx_page_map(adf_os_device_t osdev, adf_nbuf_rx_page_t *rx_page,
+                     adf_nbuf_t buf, adf_os_dma_dir_t dir)
+{
+    __adf_nbuf_rx_page_map(osdev, rx_page, buf, dir);
+}
+
+/**
+ * @brief Take a netbuf built on an rx page back from the device
+ * @details
+ *  Counterpart of adf_nbuf_unmap(). The page stays mapped.
+ *
+ * @param[in] osdev  os device
+ * @param[in] buf    netbuf passed to adf_nbuf_rx_page_map()
+ * @param[in] dir    DMA direction
+ */
+static inline void
+adf_nbuf_rx_page_unmap(adf_os_device_t osdev, adf_nbuf_t buf,
+                       adf_os_dma_dir_t dir)
+{
+    __adf_nbuf_rx_page_unmap(osdev, buf, dir);
+}
+#endif /* __ADF_NBUF_RX_PAGE_POOL */
+
 static inline int
 adf_nbuf_get_num_frags(adf_nbuf_t buf)
 {
@@ -858,6 +973,49 @@ adf_nbuf_set_next(adf_nbuf_t this_buf, adf_nbuf_t next_buf)
     __adf_nbuf_set_next(this_buf, next_buf);
 }
 
+/**
+ * @brief record the current time in the buffer
+ * @details
+ *  The time is kept in the buffer itself, so it is only meaningful while
+ *  the buffer is owned by the driver (e.g. while it waits in a queue).
+ *
+ * @param[in] buf buffer
+ */
+static inline void
+adf_nbuf_set_timestamp(adf_nbuf_t buf)
+{
+    __adf_nbuf_set_timestamp(buf);
+}
+
+/**
+ * @brief get the time recorded by adf_nbuf_set_timestamp
+ * @details
+ *  The value can be kept after the buffer is freed, to measure the time
+ *  elapsed since with adf_nbuf_timestamp_delta_us.
+ *
+ * @param[in] buf buffer
+ *
+ * @return the recorded time
+ */
+static inline adf_nbuf_timestamp_t
+adf_nbuf_get_timestamp(adf_nbuf_t buf)
+{
+    return __adf_nbuf_get_timestamp(buf);
+}
+
+/**
+ * @brief get the time elapsed since a recorded time
+ *
+ * @param[in] ts time returned by adf_nbuf_get_timestamp
+ *
+ * @return elapsed time in microseconds
+ */
+static inline uint64_t
+adf_nbuf_timestamp_delta_us(adf_nbuf_timestamp_t ts)
+{
+    return __adf_nbuf_timestamp_delta_us(ts);
+}
+
 
 /*
  * nbuf extension routines XXX
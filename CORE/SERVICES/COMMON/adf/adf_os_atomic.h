@@ -111,6 +111,19 @@ adf_os_atomic_dec_and_test(adf_os_atomic_t *v)
     return __adf_os_atomic_dec_and_test(v);
 }
 
+/**
+ * @brief Increment an atomic variable unless its value is zero.
+ * @param v a pointer to an opaque atomic variable
+ * @return
+ *      true (non-zero) if the variable was incremented,
+ *      or false (0) if it was already zero
+ */
+static inline a_uint32_t
+adf_os_atomic_inc_not_zero(adf_os_atomic_t *v)
+{
+    return __adf_os_atomic_inc_not_zero(v);
+}
+
 /**
  * @brief Set a value to the value of an atomic variable.
  * @param v a pointer to an opaque atomic variable
@@ -174,4 +174,94 @@ adf_os_spinlock_irq_exec(adf_os_handle_t           hdl,
 
 #define adf_os_in_softirq() __adf_os_in_softirq()
 
+/**
+ * @brief pin the caller to the local CPU with bottom halves disabled
+ *
+ * Softirq and irq-disabled callers are already non-preemptible on the
+ * local CPU, so bottom halves are only disabled for process context.
+ * The returned CPU id may be used to index per-CPU data until the
+ * matching adf_os_put_cpu_bh call.
+ *
+ * @param[out] bh_disabled whether bottom halves were disabled here
+ *
+ * @return the local CPU id
+ */
+#define adf_os_get_cpu_bh(_bh_disabled) __adf_os_get_cpu_bh(_bh_disabled)
+
+/**
+ * @brief release the CPU pinned by adf_os_get_cpu_bh
+ *
+ * @param[in] bh_disabled value returned through adf_os_get_cpu_bh
+ */
+#define adf_os_put_cpu_bh(_bh_disabled) __adf_os_put_cpu_bh(_bh_disabled)
+
+/**
+ * @brief upper bound (exclusive) on the CPU ids handed out by the OS
+ */
+#define adf_os_num_cpu_ids() __adf_os_num_cpu_ids()
+
+/**
+ * @brief RCU callback head, embedded in objects that are freed through
+ *        adf_os_call_rcu
+ */
+typedef __adf_os_rcu_head_t       adf_os_rcu_head_t;
+
+/**
+ * @brief RCU callback prototype
+ */
+typedef void (*adf_os_rcu_func_t)(adf_os_rcu_head_t *head);
+
+/**
+ * @brief enter / exit an RCU read-side critical section
+ *
+ * Objects reached inside the section are not freed through
+ * adf_os_call_rcu until all such sections that were running when the
+ * object was unpublished have exited.
+ */
+#define adf_os_rcu_read_lock()   __adf_os_rcu_read_lock()
+#define adf_os_rcu_read_unlock() __adf_os_rcu_read_unlock()
+
+/**
+ * @brief fetch an RCU-protected pointer for use inside a read-side section
+ *
+ * @param[in] _p  the pointer (lvalue) published with adf_os_rcu_assign_pointer
+ *
+ * @return the pointer value, safe to dereference until adf_os_rcu_read_unlock
+ */
+#define adf_os_rcu_dereference(_p) __adf_os_rcu_dereference(_p)
+
+/**
+ * @brief publish a pointer to RCU readers
+ *
+ * Stores made to the object before it is published are visible to any
+ * reader that fetches the pointer with adf_os_rcu_dereference.
+ *
+ * @param[in] _p  the pointer (lvalue) to update
+ * @param[in] _v  the new value
+ */
+#define adf_os_rcu_assign_pointer(_p, _v) __adf_os_rcu_assign_pointer(_p, _v)
+
+/**
+ * @brief invoke func(head) once all current RCU readers are done
+ *
+ * @param[in] head  callback head embedded in the object to be released
+ * @param[in] func  callback, run in softirq context
+ */
+#define adf_os_call_rcu(_head, _func) __adf_os_call_rcu(_head, _func)
+
+/**
+ * @brief wait for all pending adf_os_call_rcu callbacks to complete
+ *
+ * May sleep - only for use from process context (e.g. detach).
+ */
+#define adf_os_rcu_barrier() __adf_os_rcu_barrier()
+
+/**
+ * @brief wait until all RCU read-side sections running at the time of
+ *        the call have exited
+ *
+ * May sleep - only for use from process context.
+ */
+#define adf_os_rcu_synchronize() __adf_os_rcu_synchronize()
+
 #endif
@@ -131,6 +131,32 @@ adf_os_int_sqrt(a_uint32_t x)
 	return __adf_os_int_sqrt(x);
 }
 
+/**
+ * @brief  Find the least significant set bit of a 64-bit word
+ *
+ * @param[in] x     Word to scan, must be non-zero
+ *
+ * @return  Zero-based index of the lowest set bit
+ */
+static adf_os_inline a_uint32_t
+adf_os_ffs64(a_uint64_t x)
+{
+	return __adf_os_ffs64(x);
+}
+
+/**
+ * @brief  Count the set bits of a 64-bit word
+ *
+ * @param[in] x     Word to count
+ *
+ * @return  Number of bits set in x
+ */
+static adf_os_inline a_uint32_t
+adf_os_hweight64(a_uint64_t x)
+{
+	return __adf_os_hweight64(x);
+}
+
 /**
  * @brief initialize completion structure
  *
@@ -32,6 +32,7 @@
 #ifndef _ADF_CMN_NET_PVT_BUF_H
 #define _ADF_CMN_NET_PVT_BUF_H
 
+#include <linux/version.h>
 #include <linux/skbuff.h>
 #include <linux/netdevice.h>
 #include <linux/dma-mapping.h>
@@ -49,6 +50,7 @@
 typedef struct sk_buff *        __adf_nbuf_t;
 
 typedef void (*__adf_nbuf_callback_fn) (struct sk_buff *skb);
+typedef ktime_t                 __adf_nbuf_timestamp_t;
 #define OSDEP_EAPOL_TID 6  /* send it on VO queue */
 
 /* CVG_NBUF_MAX_OS_FRAGS -
@@ -246,6 +248,7 @@ typedef struct __adf_nbuf_qhead {
  */
 __adf_nbuf_t    __adf_nbuf_alloc(__adf_os_device_t osdev, size_t size, int reserve, int align, int prio);
 void            __adf_nbuf_free (struct sk_buff *skb);
+void            __adf_nbuf_free_list(struct sk_buff *skb);
 void            __adf_nbuf_ref (struct sk_buff *skb);
 int             __adf_nbuf_shared (struct sk_buff *skb);
 a_status_t      __adf_nbuf_dmamap_create(__adf_os_device_t osdev,
@@ -265,6 +268,41 @@ void            __adf_nbuf_frag_info(struct sk_buff *skb, adf_os_sglist_t  *sg);
 void            __adf_nbuf_dmamap_set_cb(__adf_os_dma_map_t dmap, void *cb, void *arg);
 void            __adf_nbuf_reg_trace_cb(adf_nbuf_trace_update_t cb_func_ptr);
 
+/*
+ * rx netbufs built on driver owned pages that stay DMA mapped across
+ * reuse. Needs build_skb() with a frag size and DMA_ATTR_SKIP_CPU_SYNC.
+ */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(3, 6, 0)
+#define __ADF_NBUF_RX_PAGE_POOL
+
+typedef struct {
+    struct page *page;
+    dma_addr_t   paddr;
+} __adf_nbuf_rx_page_t;
+
+a_status_t      __adf_nbuf_rx_page_alloc(__adf_os_device_t osdev,
+                    __adf_nbuf_rx_page_t *rx_page, adf_os_dma_dir_t dir);
+void            __adf_nbuf_rx_page_release(__adf_os_device_t osdev,
+                    __adf_nbuf_rx_page_t *rx_page, adf_os_dma_dir_t dir);
+struct sk_buff *__adf_nbuf_rx_page_build(__adf_os_device_t osdev,
+                    __adf_nbuf_rx_page_t *rx_page);
+void            __adf_nbuf_rx_page_map(__adf_os_device_t osdev,
+                    __adf_nbuf_rx_page_t *rx_page, struct sk_buff *skb,
+                    adf_os_dma_dir_t dir);
+void            __adf_nbuf_rx_page_unmap(__adf_os_device_t osdev,
+                    struct sk_buff *skb, adf_os_dma_dir_t dir);
+
+/*
+ * Page references: one for the pool, one for each netbuf built on the
+ * page and one while a netbuf is posted to the device.
+ */
+static inline int
+__adf_nbuf_rx_page_refs(__adf_nbuf_rx_page_t *rx_page)
+{
+    return page_count(rx_page->page);
+}
+#endif
+
 #ifdef QCA_PKT_PROTO_TRACE
 void
 __adf_nbuf_trace_update(struct sk_buff *buf, char *event_string);
@@ -965,6 +1003,45 @@ __adf_nbuf_set_priority(struct sk_buff *skb, uint32_t p)
     skb->priority = p;
 }
 
+/**
+ * @brief stamp the skb with the current monotonic time
+ *
+ * @param skb
+ *
+ * @return void
+ */
+static inline void
+__adf_nbuf_set_timestamp(struct sk_buff *skb)
+{
+    skb->tstamp = ktime_get();
+}
+
+/**
+ * @brief the time recorded by __adf_nbuf_set_timestamp
+ *
+ * @param skb
+ *
+ * @return __adf_nbuf_timestamp_t
+ */
+static inline __adf_nbuf_timestamp_t
+__adf_nbuf_get_timestamp(struct sk_buff *skb)
+{
+    return skb->tstamp;
+}
+
+/**
+ * @brief microseconds elapsed since a timestamp
+ *
+ * @param ts
+ *
+ * @return uint64_t
+ */
+static inline uint64_t
+__adf_nbuf_timestamp_delta_us(__adf_nbuf_timestamp_t ts)
+{
+    return ktime_us_delta(ktime_get(), ts);
+}
+
 /**
  * @brief sets the next skb pointer of the current skb
  *
@@ -1041,11 +1118,7 @@ __adf_nbuf_append_ext_list(
 static inline void
 __adf_nbuf_tx_free(struct sk_buff *bufs, int tx_err)
 {
-    while (bufs) {
-        struct sk_buff *next = __adf_nbuf_next(bufs);
-        __adf_nbuf_free(bufs);
-        bufs = next;
-    }
+    __adf_nbuf_free_list(bufs);
 }
 
 /**
@@ -72,6 +72,12 @@ static inline a_uint32_t
     return(atomic_dec_and_test(v));
 }
 
+static inline a_uint32_t
+__adf_os_atomic_inc_not_zero(__adf_os_atomic_t *v)
+{
+    return atomic_inc_not_zero(v);
+}
+
 static inline void
  __adf_os_atomic_set(__adf_os_atomic_t *v, int i)
 {
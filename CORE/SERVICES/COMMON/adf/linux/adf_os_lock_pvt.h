@@ -32,6 +32,9 @@
 #include <linux/semaphore.h>
 #include <linux/interrupt.h>
 #include <linux/spinlock.h>
+#include <linux/smp.h>
+#include <linux/cpumask.h>
+#include <linux/rcupdate.h>
 #include <adf_os_types.h>
 
 typedef struct __adf_os_linux_spinlock {
@@ -187,4 +190,35 @@ __adf_os_in_softirq(void)
 {
     return (in_softirq());
 }
+
+static inline int
+__adf_os_get_cpu_bh(a_bool_t *bh_disabled)
+{
+	if (likely(irqs_disabled() || in_softirq())) {
+		*bh_disabled = A_FALSE;
+	} else {
+		local_bh_disable();
+		*bh_disabled = A_TRUE;
+	}
+	return smp_processor_id();
+}
+
+static inline void
+__adf_os_put_cpu_bh(a_bool_t bh_disabled)
+{
+	if (unlikely(bh_disabled))
+		local_bh_enable();
+}
+
+#define __adf_os_num_cpu_ids() (nr_cpu_ids)
+
+typedef struct rcu_head __adf_os_rcu_head_t;
+
+#define __adf_os_rcu_read_lock()       rcu_read_lock()
+#define __adf_os_rcu_read_unlock()     rcu_read_unlock()
+#define __adf_os_rcu_dereference(p)    rcu_dereference(p)
+#define __adf_os_rcu_assign_pointer(p, v) rcu_assign_pointer(p, v)
+#define __adf_os_call_rcu(head, func)  call_rcu(head, func)
+#define __adf_os_rcu_barrier()         rcu_barrier()
+#define __adf_os_rcu_synchronize()     synchronize_rcu()
 #endif /*_ADF_CMN_OS_LOCK_PVT_H*/
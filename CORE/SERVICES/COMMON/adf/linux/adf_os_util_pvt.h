@@ -34,6 +34,7 @@
 #include <linux/types.h>
 
 #include <linux/random.h>
+#include <linux/bitops.h>
 
 //#include <asm/system.h>
 #include <adf_os_types.h>
@@ -102,6 +103,22 @@ static __adf_os_inline a_uint32_t __adf_os_int_sqrt(a_uint32_t x)
 	return int_sqrt(x);
 }
 
+/**
+ * @brief index of the least significant set bit; x must be non-zero
+ */
+static __adf_os_inline a_uint32_t __adf_os_ffs64(a_uint64_t x)
+{
+	return __ffs64(x);
+}
+
+/**
+ * @brief number of set bits
+ */
+static __adf_os_inline a_uint32_t __adf_os_hweight64(a_uint64_t x)
+{
+	return hweight64(x);
+}
+
 /**
  * @brief completion structure initialization
  */
@@ -103,6 +103,28 @@ int HIFSend(HIF_DEVICE *hifDevice, u_int8_t PipeID,
 int HIFSend_head(HIF_DEVICE *hifDevice, u_int8_t PipeID,
 		 unsigned int transferID, unsigned int nbytes, adf_nbuf_t wbuf);
 
+/**
+ * @brief: Send the heads of a batch of buffers, notifying the target once.
+ * @details:
+ *  Equivalent to calling HIFSend_head for each buffer in turn, except
+ *  that the target is only told about the new transfers once, after the
+ *  last buffer of the batch has been queued.
+ *  Sending stops at the first buffer that cannot be accepted.
+ *  Currently only implemented for PCIe.
+ *
+ * @param[in]: hifDevice - HIF handle
+ * @param[in]: pipeID - pipe to use
+ * @param[in]: transferID - upper-layer ID for these transfers
+ * @param[in]: num_bufs - number of buffers in the batch
+ * @param[in]: bufs - buffers to send
+ * @param[in]: nbytes - number of initial bytes to send from each buffer
+ * @param[out]:
+ * @return: Number of buffers (from the start of bufs) that were accepted.
+ */
+int HIFSend_head_batch(HIF_DEVICE *hifDevice, u_int8_t PipeID,
+		       unsigned int transferID, int num_bufs,
+		       adf_nbuf_t *bufs, unsigned int *nbytes);
+
 /**
  * @brief: Check if prior sends have completed.
  * @details:
@@ -433,6 +433,25 @@ A_STATUS    HTCSendPkt(HTC_HANDLE HTCHandle, HTC_PACKET *pPacket);
 #ifdef ATH_11AC_TXCOMPACT
 A_STATUS     HTCSendDataPkt(HTC_HANDLE HTCHandle, adf_nbuf_t       netbuf,
                             int Epid, int ActualLength);
+/*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  @desc: Send a batch of tx descriptor + data network buffers
+  @function name: HTCSendDataPktBatch
+  @input:  HTCHandle - HTC handle
+           netbufs - network buffers to send, in order
+           ActualLengths - download length of each network buffer
+           num - number of network buffers in the batch
+           Epid - endpoint to send the batch on
+  @output:
+  @return: number of network buffers (from the start of netbufs) accepted
+  @notes:  Same requirements as HTCSendDataPkt for each network buffer.
+           The HIF layer notifies the target once for the whole batch
+           rather than once per network buffer.
+           Network buffers that are not accepted remain owned by the caller.
+  @example:
+  @see also: HTCSendDataPkt
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+int          HTCSendDataPktBatch(HTC_HANDLE HTCHandle, adf_nbuf_t *netbufs,
+                                 unsigned int *ActualLengths, int num, int Epid);
 #else  /*ATH_11AC_TXCOMPACT*/
 A_STATUS   HTCSendDataPkt(HTC_HANDLE HTCHandle, HTC_PACKET *pPacket,
                           A_UINT8 more_data);
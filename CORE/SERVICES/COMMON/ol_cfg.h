@@ -80,6 +80,7 @@ struct txrx_pdev_cfg_t {
 	u8 rx_fwd_disabled;
 	u8 is_packet_log_enabled;
 	u8 is_full_reorder_offload;
+	u8 rx_in_order_lookup_mode;
 #ifdef IPA_UC_OFFLOAD
 	struct wlan_ipa_uc_rsc_t ipa_uc_rsc;
 #endif /* IPA_UC_OFFLOAD */
@@ -364,6 +365,17 @@ int ol_cfg_throttle_period_ms(ol_pdev_handle pdev);
  */
 int ol_cfg_is_full_reorder_offload(ol_pdev_handle pdev);
 
+/**
+ * @brief Select how rx buffer paddrs are mapped back to netbufs
+ * @details
+ *   Only meaningful when full reorder offload is enabled, since the
+ *   target then returns rx buffers to the host by physical address.
+ *
+ * @param pdev - handle to the physical device
+ * @return 0 - bucketed linked-list hash, 1 - open-addressed table
+ */
+int ol_cfg_rx_in_order_lookup_mode(ol_pdev_handle pdev);
+
 typedef enum {
    wlan_frm_tran_cap_raw = 0x01,
    wlan_frm_tran_cap_native_wifi = 0x02,
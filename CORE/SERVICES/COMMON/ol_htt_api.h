@@ -217,6 +217,28 @@ void htt_display(htt_pdev_handle pdev, int indent);
 #define htt_display(pdev, indent)
 #endif
 
+/**
+ * @brief Print the rx in-order paddr lookup structure statistics
+ * @details
+ *  Only prints when full rx reorder offload is in use.
+ *
+ * @param pdev - handle to the HTT instance
+ */
+void htt_rx_in_order_lookup_stats_display(htt_pdev_handle pdev);
+
+#ifdef HTT_RX_BUF_RECYCLE
+/**
+ * @brief Print the rx page pool statistics
+ * @details
+ *  Includes the share of rx ring refills that reused a mapped page.
+ *
+ * @param pdev - handle to the HTT instance
+ */
+void htt_rx_buf_recycle_stats_display(htt_pdev_handle pdev);
+#else
+#define htt_rx_buf_recycle_stats_display(pdev)
+#endif
+
 #define HTT_DXE_RX_LOG 0
 #define htt_rx_reorder_log_print(pdev)
 
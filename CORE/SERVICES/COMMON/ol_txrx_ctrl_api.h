@@ -749,6 +749,26 @@ ol_txrx_peer_keyinstalled_state_update(
     ol_txrx_peer_handle data_peer,
     u_int8_t val);
 
+/**
+ * @brief Specify the PHY rate currently used to transmit to a peer
+ * @details
+ *  The HL tx scheduler uses this rate to estimate how much airtime each
+ *  peer's downloaded frames will take, so that tx queues can be served
+ *  by airtime rather than by frame count.
+ *  This function applies only to HL systems with airtime fairness enabled.
+ *
+ * @param data_pdev - the physical device the peer belongs to
+ * @param peer_addr - MAC address of the peer
+ * @param rate_kbps - the peer's tx PHY rate, in kbps (0 if unknown)
+ */
+#if defined(CONFIG_HL_SUPPORT) && defined(QCA_SUPPORT_TX_AIRTIME_FAIRNESS)
+void
+ol_txrx_peer_tx_rate_update(ol_txrx_pdev_handle data_pdev,
+                            u_int8_t *peer_addr, u_int32_t rate_kbps);
+#else
+#define ol_txrx_peer_tx_rate_update(data_pdev, peer_addr, rate_kbps) /* no-op */
+#endif
+
 #define ol_tx_addba_conf(data_peer, tid, status) /* no-op */
 
 /**
@@ -846,6 +866,8 @@ ol_txrx_peer_stats_copy(
 /* Config parameters for txrx_pdev */
 struct txrx_pdev_cfg_param_t {
     u_int8_t is_full_reorder_offload;
+    /* rx in-order paddr -> netbuf lookup structure, see ol_cfg.h */
+    u_int8_t rx_in_order_lookup_mode;
     /* IPA Micro controller data path offload enable flag */
     u_int8_t is_uc_offload_enabled;
     /* IPA Micro controller data path offload TX buffer count */
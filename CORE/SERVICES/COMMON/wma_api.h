@@ -74,7 +74,10 @@ typedef enum {
     GEN_PARAM_DUMP_WATCHDOG,
     GEN_PARAM_CRASH_INJECT,
 #ifdef CONFIG_ATH_PCIE_ACCESS_DEBUG
-    GEN_PARAM_DUMP_PCIE_ACCESS_LOG
+    GEN_PARAM_DUMP_PCIE_ACCESS_LOG,
+#endif
+#ifdef HIF_PCI_CE_INTR_MOD
+    GEN_PARAM_DUMP_CE_INTR_MOD,
 #endif
 } GEN_PARAM;
 
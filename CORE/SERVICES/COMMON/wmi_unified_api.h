@@ -80,6 +80,55 @@ wmi_buf_alloc(wmi_unified_t wmi_handle, u_int16_t len);
 int
 wmi_unified_cmd_send(wmi_unified_t wmi_handle, wmi_buf_t buf, int buflen, WMI_CMD_ID cmd_id);
 
+/**
+ * WMI command batch.
+ * Commands added to a batch are validated and queued on the caller's
+ * stack, then handed to HTC together on flush so that they share one
+ * credit pass and can be bundled.
+ */
+struct wmi_cmd_batch {
+	HTC_PACKET_QUEUE pkt_queue;
+	u_int32_t num_cmds;
+};
+
+/**
+ * initialize an empty WMI command batch
+ *
+ *  @param batch           : batch to initialize
+ *  @return void.
+ */
+void
+wmi_unified_cmd_batch_init(struct wmi_cmd_batch *batch);
+
+/**
+ * add a unified WMI command to a batch
+ *
+ *  @param wmi_handle      : handle to WMI.
+ *  @param batch           : batch the command is added to
+ *  @param buf             : wmi command buffer, owned by the batch on success
+ *  @param buflen          : wmi command buffer length
+ *  @param cmd_id          : WMI command ID
+ *  @return 0  on success and -ve on failure.
+ */
+int
+wmi_unified_cmd_batch_add(wmi_unified_t wmi_handle, struct wmi_cmd_batch *batch,
+			  wmi_buf_t buf, int buflen, WMI_CMD_ID cmd_id);
+
+/**
+ * send all commands of a batch, in the order they were added
+ *
+ * HTC owns the commands once this returns; a command that cannot be
+ * sent is completed and freed through the WMI tx completion, so callers
+ * that need a per-command send status must use wmi_unified_cmd_send().
+ *
+ *  @param wmi_handle      : handle to WMI.
+ *  @param batch           : batch to send, left empty on return
+ *  @return void.
+ */
+void
+wmi_unified_cmd_batch_flush(wmi_unified_t wmi_handle,
+			    struct wmi_cmd_batch *batch);
+
 /**
  * WMI event handler register function
  *
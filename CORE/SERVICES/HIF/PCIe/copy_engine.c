@@ -35,13 +35,28 @@
 #include "copy_engine_api.h"
 #include "copy_engine_internal.h"
 #include "adf_os_lock.h"
+#include "adf_os_time.h"
 #include "hif_pci.h"
 #include "regtable.h"
 #include <vos_getBin.h>
 #include "epping_main.h"
+#include <linux/math64.h>
 
 #define CE_POLL_TIMEOUT 10 /* ms */
 
+#ifdef HIF_PCI_CE_INTR_MOD
+/*
+ * Adaptive interrupt moderation: once a CE completes more than
+ * CE_INTR_MOD_POLL_THRESH entries per CE_INTR_MOD_WINDOW_MS, its copy
+ * complete interrupt is masked and the CE is polled from the tasklet,
+ * bounded by the existing per-pass receive budget. It goes back to
+ * interrupts once its polls have found nothing for CE_INTR_MOD_IDLE_US.
+ */
+#define CE_INTR_MOD_WINDOW_MS    10
+#define CE_INTR_MOD_POLL_THRESH  128
+#define CE_INTR_MOD_IDLE_US      500
+#endif
+
 static int war1_allow_sleep;
 extern int hif_pci_war1;
 
@@ -188,7 +203,8 @@ CE_send_nolock(struct CE_handle *copyeng,
         write_index = CE_RING_IDX_INCR(nentries_mask, write_index);
 
         /* WORKAROUND */
-        if (!shadow_src_desc->gather) {
+        if (!shadow_src_desc->gather &&
+            !(flags & CE_SEND_FLAG_NO_DOORBELL)) {
             WAR_CE_SRC_RING_WRITE_IDX_SET(sc, targid, ctrl_addr, write_index);
         }
 
@@ -220,6 +236,27 @@ CE_send(struct CE_handle *copyeng,
     return status;
 }
 
+void
+CE_send_doorbell(struct CE_handle *copyeng)
+{
+    struct CE_state *CE_state = (struct CE_state *)copyeng;
+    struct CE_ring_state *src_ring = CE_state->src_ring;
+    struct hif_pci_softc *sc = CE_state->sc;
+    A_target_id_t targid = TARGID(sc);
+    int val = 0;
+
+    adf_os_spin_lock_bh(&sc->target_lock);
+    A_TARGET_ACCESS_BEGIN_RET_EXT(targid, val);
+    if (val == -1) {
+        adf_os_spin_unlock_bh(&sc->target_lock);
+        return;
+    }
+    WAR_CE_SRC_RING_WRITE_IDX_SET(sc, targid, CE_state->ctrl_addr,
+                                  src_ring->write_index);
+    A_TARGET_ACCESS_END_RET_EXT(targid, val);
+    adf_os_spin_unlock_bh(&sc->target_lock);
+}
+
 unsigned int
 CE_sendlist_sizeof(void)
 {
@@ -895,6 +932,170 @@ CE_per_engine_servicereap(struct hif_pci_softc *sc, unsigned int CE_id)
  */
 #define CE_TXRX_COMP_CHECK_THRESHOLD 20
 
+#ifdef HIF_PCI_CE_INTR_MOD
+/*
+ * Only CEs that complete through the shared tasklet can be polled:
+ * per-CE MSI handlers service in hard irq context and never come back
+ * for pending work, and CEs without a copy complete interrupt are left
+ * to their own poll timer.
+ */
+static inline bool
+CE_intr_mod_eligible(struct hif_pci_softc *sc, struct CE_state *CE_state)
+{
+    return (sc->num_msi_intrs <= 1) &&
+           !CE_state->disable_copy_compl_intr &&
+           !(CE_state->attr_flags & CE_ATTR_ENABLE_POLL) &&
+           (CE_state->send_cb || CE_state->recv_cb);
+}
+
+/*
+ * Account the completions of one service pass and move the CE between
+ * interrupt and polling mode. Called with target access held and
+ * target_lock released.
+ */
+static void
+CE_intr_mod_update(struct hif_pci_softc *sc, struct CE_state *CE_state,
+                   unsigned int completions)
+{
+    struct CE_intr_mod_stats *stats = &CE_state->intr_mod_stats;
+    A_target_id_t targid = TARGID(sc);
+    unsigned long now, elapsed_ms;
+
+    if (!CE_intr_mod_eligible(sc, CE_state))
+        return;
+
+    if (CE_state->intr_mod_polling) {
+        stats->polls++;
+        stats->poll_completions += completions;
+        if (completions > stats->max_per_poll)
+            stats->max_per_poll = completions;
+
+        if (completions) {
+            CE_state->intr_mod_idle = false;
+        } else if (!CE_state->intr_mod_idle) {
+            CE_state->intr_mod_idle = true;
+            CE_state->intr_mod_idle_start = ktime_get();
+        } else if (ktime_us_delta(ktime_get(),
+                                  CE_state->intr_mod_idle_start) >=
+                   CE_INTR_MOD_IDLE_US) {
+            /*
+             * Idle again: unmask the interrupt. Anything that completed
+             * since the last poll has already latched the status bit and
+             * raises the interrupt as soon as it is enabled.
+             */
+            adf_os_spin_lock(&sc->target_lock);
+            CE_state->intr_mod_polling = false;
+            CE_COPY_COMPLETE_INTR_ENABLE(targid, CE_state->ctrl_addr);
+            adf_os_spin_unlock(&sc->target_lock);
+            CE_state->intr_mod_window_start = adf_os_ticks();
+            CE_state->intr_mod_window_comp = 0;
+            stats->to_intr++;
+            return;
+        }
+        /* keep the tasklet coming back to this CE */
+        adf_os_atomic_set(&CE_state->rx_pending, 1);
+        return;
+    }
+
+    stats->intr_completions += completions;
+    CE_state->intr_mod_window_comp += completions;
+
+    now = adf_os_ticks();
+    elapsed_ms = adf_os_ticks_to_msecs(now - CE_state->intr_mod_window_start);
+    if (elapsed_ms < CE_INTR_MOD_WINDOW_MS)
+        return;
+
+    if (CE_state->intr_mod_window_comp > stats->peak_window_comp)
+        stats->peak_window_comp = CE_state->intr_mod_window_comp;
+
+    /* normalize, the window may have been stretched by an idle period */
+    if ((CE_state->intr_mod_window_comp * CE_INTR_MOD_WINDOW_MS) >=
+        (CE_INTR_MOD_POLL_THRESH * elapsed_ms)) {
+        adf_os_spin_lock(&sc->target_lock);
+        CE_state->intr_mod_polling = true;
+        CE_COPY_COMPLETE_INTR_DISABLE(targid, CE_state->ctrl_addr);
+        adf_os_spin_unlock(&sc->target_lock);
+        CE_state->intr_mod_idle = false;
+        stats->to_poll++;
+        adf_os_atomic_set(&CE_state->rx_pending, 1);
+    }
+    CE_state->intr_mod_window_start = now;
+    CE_state->intr_mod_window_comp = 0;
+}
+
+static inline bool
+CE_intr_mod_any_polling(struct hif_pci_softc *sc)
+{
+    int CE_id;
+
+    for (CE_id = 0; CE_id < sc->ce_count; CE_id++) {
+        if (sc->CE_id_to_state[CE_id] &&
+            sc->CE_id_to_state[CE_id]->intr_mod_polling)
+            return true;
+    }
+    return false;
+}
+
+/* Record an interrupt driven service of CE_state and its irq latency */
+static inline void
+CE_intr_mod_intr_taken(struct hif_pci_softc *sc, struct CE_state *CE_state)
+{
+    struct CE_intr_mod_stats *stats = &CE_state->intr_mod_stats;
+    u_int32_t latency_us;
+
+    latency_us = (u_int32_t)ktime_us_delta(ktime_get(), sc->ce_irq_tstamp);
+    stats->intrs++;
+    stats->latency_sum_us += latency_us;
+    if (latency_us > stats->latency_max_us)
+        stats->latency_max_us = latency_us;
+}
+
+void
+CE_intr_mod_stats_display(struct hif_pci_softc *sc)
+{
+    int CE_id;
+
+    adf_os_print("CE interrupt moderation: poll above %d completions/%d ms, "
+                 "back to interrupt after %d us idle\n",
+                 CE_INTR_MOD_POLL_THRESH, CE_INTR_MOD_WINDOW_MS,
+                 CE_INTR_MOD_IDLE_US);
+    for (CE_id = 0; CE_id < sc->ce_count; CE_id++) {
+        struct CE_state *CE_state = sc->CE_id_to_state[CE_id];
+        struct CE_intr_mod_stats *stats;
+        unsigned long elapsed_ms;
+
+        if (!CE_state)
+            continue;
+        stats = &CE_state->intr_mod_stats;
+        elapsed_ms = adf_os_ticks_to_msecs(adf_os_ticks() - stats->start);
+        adf_os_print("CE%d: %s, intrs %u (%lu/s), avg latency %llu us, "
+                     "max latency %u us\n",
+                     CE_id, CE_state->intr_mod_polling ? "polling" : "intr",
+                     stats->intrs,
+                     elapsed_ms ? (unsigned long)
+                         div_u64((u_int64_t)stats->intrs * 1000, elapsed_ms) : 0,
+                     stats->intrs ?
+                         (unsigned long long)div_u64(stats->latency_sum_us,
+                                                     stats->intrs) : 0,
+                     stats->latency_max_us);
+        adf_os_print("     intr compl %llu, polls %u, poll compl %llu "
+                     "(avg %llu, max %u per poll), peak %u per window, "
+                     "to poll %u, to intr %u\n",
+                     (unsigned long long)stats->intr_completions,
+                     stats->polls,
+                     (unsigned long long)stats->poll_completions,
+                     stats->polls ?
+                         (unsigned long long)div_u64(stats->poll_completions,
+                                                     stats->polls) : 0,
+                     stats->max_per_poll, stats->peak_window_comp,
+                     stats->to_poll, stats->to_intr);
+    }
+}
+#else
+#define CE_intr_mod_update(sc, CE_state, completions) /* no-op */
+#define CE_intr_mod_any_polling(sc) false
+#endif /* HIF_PCI_CE_INTR_MOD */
+
 /*
  * Guts of interrupt handler for per-engine interrupts on a particular CE.
  *
@@ -917,6 +1118,7 @@ CE_per_engine_service(struct hif_pci_softc *sc, unsigned int CE_id)
     unsigned int more_comp_cnt = 0;
     unsigned int more_snd_comp_cnt = 0;
     unsigned int sw_idx, hw_idx;
+    unsigned int completions = 0;
 
     A_TARGET_ACCESS_BEGIN(targid);
 
@@ -935,6 +1137,7 @@ more_completions:
                 adf_os_spin_unlock(&sc->target_lock);
                 CE_state->recv_cb((struct CE_handle *)CE_state, CE_context, transfer_context,
                                     buf, nbytes, id, flags);
+                completions++;
 
                 /*
                  * EV #112693 - [Peregrine][ES1][WB342][Win8x86][Performance] BSoD_0x133 occurred in VHT80 UDP_DL
@@ -948,6 +1151,7 @@ more_completions:
                 {
                     adf_os_atomic_set(&CE_state->rx_pending, 1);
                     CE_ENGINE_INT_STATUS_CLEAR(targid, ctrl_addr, HOST_IS_COPY_COMPLETE_MASK);
+                    CE_intr_mod_update(sc, CE_state, completions);
                     A_TARGET_ACCESS_END(targid);
                     return;
                 }
@@ -966,6 +1170,7 @@ more_completions:
 #ifdef ATH_11AC_TXCOMPACT
         while (CE_completed_send_next_nolock(CE_state, &CE_context, &transfer_context,
                     &buf, &nbytes, &id, &sw_idx, &hw_idx) == A_OK){
+            completions++;
 
             if(CE_id != CE_HTT_H2T_MSG ||
                     WLAN_IS_EPPING_ENABLED(vos_get_conparam())){
@@ -984,6 +1189,7 @@ more_completions:
 #else  /*ATH_11AC_TXCOMPACT*/
         while (CE_completed_send_next_nolock(CE_state, &CE_context, &transfer_context,
                     &buf, &nbytes, &id, &sw_idx, &hw_idx) == A_OK){
+            completions++;
             adf_os_spin_unlock(&sc->target_lock);
             CE_state->send_cb((struct CE_handle *)CE_state, CE_context, transfer_context, buf, nbytes, id,
                               sw_idx, hw_idx);
@@ -1062,6 +1268,7 @@ more_watermarks:
 
     adf_os_spin_unlock(&sc->target_lock);
     adf_os_atomic_set(&CE_state->rx_pending, 0);
+    CE_intr_mod_update(sc, CE_state, completions);
     A_TARGET_ACCESS_END(targid);
 }
 
@@ -1100,8 +1307,15 @@ CE_per_engine_service_any(int irq, void *arg)
              }
         }
 
-        A_TARGET_ACCESS_END(targid);
-        return;
+        /*
+         * A polled CE keeps the tasklet (and with legacy interrupts, the
+         * line interrupt) busy for as long as traffic lasts; pick up the
+         * other CEs' interrupts here so they are not starved behind it.
+         */
+        if (!CE_intr_mod_any_polling(sc)) {
+            A_TARGET_ACCESS_END(targid);
+            return;
+        }
     }
 
     intr_summary = CE_INTERRUPT_SUMMARY(targid);
@@ -1113,6 +1327,10 @@ CE_per_engine_service_any(int irq, void *arg)
             continue; /* no intr pending on this CE */
         }
 
+#ifdef HIF_PCI_CE_INTR_MOD
+        if (adf_os_atomic_read(&sc->tasklet_from_intr))
+            CE_intr_mod_intr_taken(sc, sc->CE_id_to_state[CE_id]);
+#endif
         CE_per_engine_service(sc, CE_id);
     }
 
@@ -1193,6 +1411,9 @@ void CE_enable_any_copy_compl_intr_nolock(struct hif_pci_softc *sc)
         */
         if (!CE_state->disable_copy_compl_intr && (CE_state->send_cb || CE_state->recv_cb)) {
             CE_COPY_COMPLETE_INTR_ENABLE(targid, ctrl_addr);
+#ifdef HIF_PCI_CE_INTR_MOD
+            CE_state->intr_mod_polling = false;
+#endif
         }
 
         if (CE_state->watermark_cb) {
@@ -1348,6 +1569,10 @@ CE_init(struct hif_pci_softc *sc,
             CE_state->ctrl_addr = ctrl_addr;
             CE_state->state = CE_RUNNING;
             CE_state->attr_flags = attr->flags; /* Save attribute flags */
+#ifdef HIF_PCI_CE_INTR_MOD
+            CE_state->intr_mod_window_start = adf_os_ticks();
+            CE_state->intr_mod_stats.start = CE_state->intr_mod_window_start;
+#endif
         } else {
             /*
              * We released target_lock in order to allocate CE state,
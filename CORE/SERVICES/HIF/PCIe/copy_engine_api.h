@@ -125,6 +125,11 @@ struct CE_attr;
              /* CE_send flags */
 /* disable ring's byte swap, even if the default policy is to swap */
 #define CE_SEND_FLAG_SWAP_DISABLE        1
+/*
+ * don't update the source ring write index (the "doorbell") for this send;
+ * the caller rings it later through CE_send_doorbell
+ */
+#define CE_SEND_FLAG_NO_DOORBELL         2
 
 /*
  * Queue a source buffer to be sent to an anonymous destination buffer.
@@ -189,6 +194,16 @@ int CE_sendlist_send(struct CE_handle *copyeng,
                           struct CE_sendlist *sendlist,
                           unsigned int transfer_id); /* 14 bits */
 
+/*
+ * Publish to the target all source ring entries queued so far with
+ * CE_SEND_FLAG_NO_DOORBELL, by writing the source ring write index once.
+ *   copyeng         - which copy engine to use
+ *
+ * Implementation note: a single register write covers any number of
+ * deferred sends, which is what makes batched downloads cheap.
+ */
+void CE_send_doorbell(struct CE_handle *copyeng);
+
 /*==================Recv======================================================*/
 
 /*
@@ -374,6 +389,11 @@ void CE_enable_any_copy_compl_intr_nolock(struct hif_pci_softc *sc);
 /* API to check if any of the copy engine pipes has pending frames for prcoessing */
 bool CE_get_rx_pending(struct hif_pci_softc *sc);
 
+#ifdef HIF_PCI_CE_INTR_MOD
+/* Display the per-CE interrupt moderation statistics */
+void CE_intr_mod_stats_display(struct hif_pci_softc *sc);
+#endif
+
 /* CE_attr.flags values */
 #define CE_ATTR_NO_SNOOP                0x01  /* Use NonSnooping PCIe accesses? */
 #define CE_ATTR_BYTE_SWAP_DATA          0x02  /* Byte swap data words */
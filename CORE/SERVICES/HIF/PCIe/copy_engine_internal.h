@@ -96,6 +96,23 @@ struct CE_ring_state {
     OS_DMA_MEM_CONTEXT(ce_dmacontext)   // OS Specific DMA context
 };
 
+#ifdef HIF_PCI_CE_INTR_MOD
+/* Per-CE interrupt moderation statistics */
+struct CE_intr_mod_stats {
+    unsigned long start;          /* ticks when the stats were (re)started */
+    u_int32_t intrs;              /* services triggered by an interrupt */
+    u_int32_t polls;              /* budgeted polls with the interrupt masked */
+    u_int64_t intr_completions;
+    u_int64_t poll_completions;
+    u_int32_t max_per_poll;
+    u_int32_t peak_window_comp;   /* most completions seen in one window */
+    u_int32_t to_poll;            /* interrupt -> polling switches */
+    u_int32_t to_intr;            /* polling -> interrupt switches */
+    u_int64_t latency_sum_us;     /* interrupt to service latency */
+    u_int32_t latency_max_us;
+};
+#endif
+
 /* Copy Engine internal state */
 struct CE_state {
     struct hif_pci_softc *sc; /* back pointer to device's sc */
@@ -127,6 +144,16 @@ struct CE_state {
     /* epping */
     bool timer_inited;
     adf_os_timer_t poll_timer;
+
+#ifdef HIF_PCI_CE_INTR_MOD
+    /* adaptive interrupt moderation */
+    bool intr_mod_polling;           /* copy complete intr masked, CE polled */
+    bool intr_mod_idle;              /* last poll found no work */
+    ktime_t intr_mod_idle_start;     /* first empty poll of this idle stretch */
+    unsigned long intr_mod_window_start; /* ticks, start of rate window */
+    u_int32_t intr_mod_window_comp;  /* completions in current rate window */
+    struct CE_intr_mod_stats intr_mod_stats;
+#endif
 };
 
 /* Descriptor rings must be aligned to this boundary */
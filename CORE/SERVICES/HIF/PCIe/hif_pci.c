@@ -114,6 +114,9 @@ static int hif_post_recv_buffers_for_pipe(struct HIF_CE_pipe_info *pipe_info);
 #ifdef CONFIG_ATH_PCIE_ACCESS_DEBUG
 #define PCIE_ACCESS_DUMP 4
 #endif
+#ifdef HIF_PCI_CE_INTR_MOD
+#define CE_INTR_MOD_DUMP 5
+#endif
 /*
  * Fix EV118783, poll to check whether a BMI response comes
  * other than waiting for the interruption which may be lost.
@@ -276,9 +279,10 @@ HIFDetachHTC(HIF_DEVICE *hif_device)
 }
 
 /* Send the first nbytes bytes of the buffer */
-A_STATUS
-HIFSend_head(HIF_DEVICE *hif_device,
-             a_uint8_t pipe, unsigned int transfer_id, unsigned int nbytes, adf_nbuf_t nbuf)
+static inline A_STATUS
+hif_pci_send_head(HIF_DEVICE *hif_device,
+                  a_uint8_t pipe, unsigned int transfer_id, unsigned int nbytes,
+                  adf_nbuf_t nbuf, u_int32_t ce_flags)
 {
     struct HIF_CE_state *hif_state = (struct HIF_CE_state *)hif_device;
     struct HIF_CE_pipe_info *pipe_info = &(hif_state->pipe_info[pipe]);
@@ -308,8 +312,8 @@ HIFSend_head(HIF_DEVICE *hif_device,
         status = CE_sendlist_buf_add(
             &sendlist, frag_paddr,
             frag_bytes > bytes ? bytes : frag_bytes,
-            adf_nbuf_get_frag_is_wordstream(nbuf, nfrags) ?
-                0 : CE_SEND_FLAG_SWAP_DISABLE);
+            ce_flags | (adf_nbuf_get_frag_is_wordstream(nbuf, nfrags) ?
+                0 : CE_SEND_FLAG_SWAP_DISABLE));
         if (status != A_OK) {
             AR_DEBUG_PRINTF(ATH_DEBUG_ERR,
             ("%s: error, frag_num %d larger than the given limit\n",
@@ -344,6 +348,38 @@ HIFSend_head(HIF_DEVICE *hif_device,
     return status;
 }
 
+A_STATUS
+HIFSend_head(HIF_DEVICE *hif_device,
+             a_uint8_t pipe, unsigned int transfer_id, unsigned int nbytes, adf_nbuf_t nbuf)
+{
+    return hif_pci_send_head(hif_device, pipe, transfer_id, nbytes, nbuf, 0);
+}
+
+int
+HIFSend_head_batch(HIF_DEVICE *hif_device, a_uint8_t pipe,
+                   unsigned int transfer_id, int num_bufs,
+                   adf_nbuf_t *nbufs, unsigned int *nbytes)
+{
+    struct HIF_CE_state *hif_state = (struct HIF_CE_state *)hif_device;
+    struct HIF_CE_pipe_info *pipe_info = &(hif_state->pipe_info[pipe]);
+    int i;
+
+    /*
+     * Queue every buffer in the CE source ring without telling the
+     * target, then publish them all with a single write index update.
+     */
+    for (i = 0; i < num_bufs; i++) {
+        if (hif_pci_send_head(hif_device, pipe, transfer_id, nbytes[i],
+                              nbufs[i], CE_SEND_FLAG_NO_DOORBELL) != A_OK) {
+            break;
+        }
+    }
+    if (i > 0) {
+        CE_send_doorbell(pipe_info->ce_hdl);
+    }
+    return i;
+}
+
 /* Send the entire buffer */
 A_STATUS
 HIFSend(HIF_DEVICE *hif_device, a_uint8_t pipe, adf_nbuf_t hdr_buf, adf_nbuf_t netbuf)
@@ -1610,6 +1646,11 @@ void HIFDump(HIF_DEVICE *hif_device, u_int8_t cmd_id, bool start)
     case PCIE_ACCESS_DUMP:
         HIFTargetDumpAccessLog();
         break;
+#endif
+#ifdef HIF_PCI_CE_INTR_MOD
+    case CE_INTR_MOD_DUMP:
+        CE_intr_mod_stats_display(sc);
+        break;
 #endif
     default:
         AR_DEBUG_PRINTF(ATH_DEBUG_INFO, ("Invalid htc dump command\n"));
@@ -45,6 +45,7 @@
 #include "vos_sched.h"
 #include "wma_api.h"
 #include "adf_os_atomic.h"
+#include "adf_os_time.h"
 #include "wlan_hdd_power.h"
 #include "wlan_hdd_main.h"
 #ifdef CONFIG_CNSS
@@ -186,6 +187,9 @@ hif_pci_interrupt_handler(int irq, void *arg)
     /* TBDXXX: Add support for WMAC */
 
     sc->irq_event = irq;
+#ifdef HIF_PCI_CE_INTR_MOD
+    sc->ce_irq_tstamp = ktime_get();
+#endif
     adf_os_atomic_set(&sc->tasklet_from_intr, 1);
     tasklet_schedule(&sc->intr_tq);
 
@@ -33,6 +33,7 @@
 #include <linux/version.h>
 #include <linux/semaphore.h>
 #include <linux/interrupt.h>
+#include <linux/ktime.h>
 
 #define CONFIG_COPY_ENGINE_SUPPORT /* TBDXXX: here for now */
 #define ATH_DBG_DEFAULT   0
@@ -90,6 +91,9 @@ struct hif_pci_softc {
     bool hif_init_done;
     bool recovery;
     int htc_endpoint;
+#ifdef HIF_PCI_CE_INTR_MOD
+    ktime_t ce_irq_tstamp; /* when the last CE interrupt was taken */
+#endif
 };
 #define TARGID(sc) ((A_target_id_t)(&(sc)->mem))
 #define TARGID_TO_HIF(targid) (((struct hif_pci_softc *)((char *)(targid) - (char *)&(((struct hif_pci_softc *)0)->mem)))->hif_device)
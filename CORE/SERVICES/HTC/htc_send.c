@@ -1168,6 +1168,66 @@ A_STATUS HTCSendDataPkt(HTC_HANDLE HTCHandle, adf_nbuf_t       netbuf, int Epid,
     UNLOCK_HTC_TX(target);
     return status ;
 }
+
+int HTCSendDataPktBatch(HTC_HANDLE HTCHandle, adf_nbuf_t *netbufs,
+                        unsigned int *ActualLengths, int num, int Epid)
+{
+    HTC_TARGET       *target = GET_HTC_TARGET_FROM_HANDLE(HTCHandle);
+    HTC_ENDPOINT     *pEndpoint;
+    HTC_FRAME_HDR    *pHtcHdr;
+    int              tx_resources;
+    int              i, num_sent;
+
+    pEndpoint = &target->EndPoint[Epid];
+
+    tx_resources = HIFGetFreeQueueNumber(target->hif_dev, pEndpoint->UL_PipeID);
+
+    if(tx_resources < num * HTC_DATA_MINDESC_PERPACKET){
+        if (pEndpoint->ul_is_polled){
+            HIFSendCompleteCheck(
+                    pEndpoint->target->hif_dev, pEndpoint->UL_PipeID, 1);
+            tx_resources = HIFGetFreeQueueNumber(target->hif_dev, pEndpoint->UL_PipeID);
+        }
+        /* only hand down as many frames as the CE ring has room for */
+        if(tx_resources < num * HTC_DATA_MINDESC_PERPACKET){
+            num = tx_resources / HTC_DATA_MINDESC_PERPACKET;
+            if (!num) {
+                return 0;
+            }
+        }
+    }
+
+    for (i = 0; i < num; i++) {
+        pHtcHdr = (HTC_FRAME_HDR *) adf_nbuf_get_frag_vaddr(netbufs[i], 0);
+        AR_DEBUG_ASSERT(pHtcHdr);
+        HTC_WRITE32(pHtcHdr, SM(ActualLengths[i], HTC_FRAME_HDR_PAYLOADLEN) |
+                             SM(Epid, HTC_FRAME_HDR_ENDPOINTID));
+    }
+
+    LOCK_HTC_TX(target);
+
+    for (i = 0; i < num; i++) {
+        pHtcHdr = (HTC_FRAME_HDR *) adf_nbuf_get_frag_vaddr(netbufs[i], 0);
+        HTC_WRITE32(((A_UINT32 *)pHtcHdr) + 1,
+                    SM(pEndpoint->SeqNo, HTC_FRAME_HDR_CONTROLBYTES1));
+        pEndpoint->SeqNo++;
+    }
+
+    num_sent = HIFSend_head_batch(target->hif_dev,
+                                  pEndpoint->UL_PipeID,
+                                  pEndpoint->Id,
+                                  num,
+                                  netbufs,
+                                  ActualLengths);
+    /*
+     * The frames that were not accepted get a new sequence number
+     * when they are resent, so give back the ones they were assigned.
+     */
+    pEndpoint->SeqNo -= (num - num_sent);
+
+    UNLOCK_HTC_TX(target);
+    return num_sent;
+}
 #else /*ATH_11AC_TXCOMPACT*/
 
 A_STATUS HTCSendDataPkt(HTC_HANDLE HTCHandle, HTC_PACKET *pPacket,
@@ -144,6 +144,9 @@
 #ifdef CONFIG_ATH_PCIE_ACCESS_DEBUG
 #define PCIE_DUMP 4
 #endif
+#ifdef HIF_PCI_CE_INTR_MOD
+#define CE_INTR_MOD_DUMP 5
+#endif
 
 /* conformance test limits */
 #define FCC       0x10
@@ -1067,11 +1070,10 @@ static int wma_unified_debug_print_event_handler(void *handle, u_int8_t *datap,
 #endif
 }
 
-static int
-wmi_unified_vdev_set_param_send(wmi_unified_t wmi_handle, u_int32_t if_id,
-				u_int32_t param_id, u_int32_t param_value)
+static wmi_buf_t
+wmi_unified_vdev_set_param_buf(wmi_unified_t wmi_handle, u_int32_t if_id,
+			       u_int32_t param_id, u_int32_t param_value)
 {
-	int ret;
 	wmi_vdev_set_param_cmd_fixed_param *cmd;
 	wmi_buf_t buf;
 	u_int16_t len = sizeof(*cmd);
@@ -1079,7 +1081,7 @@ wmi_unified_vdev_set_param_send(wmi_unified_t wmi_handle, u_int32_t if_id,
 	buf = wmi_buf_alloc(wmi_handle, len);
 	if (!buf) {
 		WMA_LOGE("%s:wmi_buf_alloc failed", __func__);
-		return -ENOMEM;
+		return NULL;
 	}
 	cmd = (wmi_vdev_set_param_cmd_fixed_param *) wmi_buf_data(buf);
 	WMITLV_SET_HDR(&cmd->tlv_header,
@@ -1091,8 +1093,24 @@ wmi_unified_vdev_set_param_send(wmi_unified_t wmi_handle, u_int32_t if_id,
 	cmd->param_value = param_value;
 	WMA_LOGD("Setting vdev %d param = %x, value = %u",
 				if_id, param_id, param_value);
-	ret = wmi_unified_cmd_send(wmi_handle, buf, len,
-					WMI_VDEV_SET_PARAM_CMDID);
+	return buf;
+}
+
+static int
+wmi_unified_vdev_set_param_send(wmi_unified_t wmi_handle, u_int32_t if_id,
+				u_int32_t param_id, u_int32_t param_value)
+{
+	int ret;
+	wmi_buf_t buf;
+
+	buf = wmi_unified_vdev_set_param_buf(wmi_handle, if_id, param_id,
+					     param_value);
+	if (!buf)
+		return -ENOMEM;
+
+	ret = wmi_unified_cmd_send(wmi_handle, buf,
+				   sizeof(wmi_vdev_set_param_cmd_fixed_param),
+				   WMI_VDEV_SET_PARAM_CMDID);
 	if (ret < 0) {
 		WMA_LOGE("Failed to send set param command ret = %d", ret);
 		wmi_buf_free(buf);
@@ -1100,6 +1118,33 @@ wmi_unified_vdev_set_param_send(wmi_unified_t wmi_handle, u_int32_t if_id,
 	return ret;
 }
 
+/*
+ * Same as wmi_unified_vdev_set_param_send() but queues the command on
+ * batch; it goes to the target on wmi_unified_cmd_batch_flush().
+ */
+static int
+wmi_unified_vdev_set_param_batch(wmi_unified_t wmi_handle,
+				 struct wmi_cmd_batch *batch, u_int32_t if_id,
+				 u_int32_t param_id, u_int32_t param_value)
+{
+	int ret;
+	wmi_buf_t buf;
+
+	buf = wmi_unified_vdev_set_param_buf(wmi_handle, if_id, param_id,
+					     param_value);
+	if (!buf)
+		return -ENOMEM;
+
+	ret = wmi_unified_cmd_batch_add(wmi_handle, batch, buf,
+				sizeof(wmi_vdev_set_param_cmd_fixed_param),
+				WMI_VDEV_SET_PARAM_CMDID);
+	if (ret < 0) {
+		WMA_LOGE("Failed to queue set param command ret = %d", ret);
+		wmi_buf_free(buf);
+	}
+	return ret;
+}
+
 VOS_STATUS wma_roam_scan_bmiss_cnt(tp_wma_handle wma_handle,
 	A_INT32 first_bcnt,
 	A_UINT32 final_bcnt,
@@ -2447,6 +2492,29 @@ static int wma_link_speed_event_handler(void *handle, u_int8_t *cmd_param_info,
 	return 0;
 }
 
+#ifdef QCA_SUPPORT_TX_AIRTIME_FAIRNESS
+/*
+ * Feed the FW-reported tx rate of every peer (including SoftAP clients)
+ * to the txrx airtime fairness scheduler.
+ */
+static void wma_update_peer_tx_rate(tp_wma_handle wma,
+				    wmi_peer_stats *peer_stats)
+{
+	ol_txrx_pdev_handle pdev;
+	u_int8_t peer_mac[IEEE80211_ADDR_LEN];
+
+	if (!peer_stats->peer_tx_rate)
+		return;
+
+	pdev = vos_get_context(VOS_MODULE_ID_TXRX, wma->vos_context);
+	if (!pdev)
+		return;
+
+	WMI_MAC_ADDR_TO_CHAR_ARRAY(&peer_stats->peer_macaddr, peer_mac);
+	ol_txrx_peer_tx_rate_update(pdev, peer_mac, peer_stats->peer_tx_rate);
+}
+#endif
+
 static void wma_fw_stats_ind(tp_wma_handle wma, u_int8_t *buf)
 {
 	wmi_stats_event_fixed_param *event = (wmi_stats_event_fixed_param *)buf;
@@ -2480,6 +2548,9 @@ static void wma_fw_stats_ind(tp_wma_handle wma, u_int8_t *buf)
 	if (event->num_peer_stats > 0) {
 		for (i = 0; i < event->num_peer_stats; i++) {
 			peer_stats = (wmi_peer_stats *)temp;
+#ifdef QCA_SUPPORT_TX_AIRTIME_FAIRNESS
+			wma_update_peer_tx_rate(wma, peer_stats);
+#endif
 			wma_update_peer_stats(wma, peer_stats);
 			temp += sizeof(wmi_peer_stats);
 		}
@@ -5193,6 +5264,7 @@ VOS_STATUS WDA_open(v_VOID_t *vos_context, v_VOID_t *os_ctx,
 	 * HL also sdould be enabled, schedule TBD */
 #ifdef WLAN_FEATURE_RX_FULL_REORDER_OL
 	olCfg.is_full_reorder_offload = mac_params->reorderOffload;
+	olCfg.rx_in_order_lookup_mode = mac_params->rxInOrderLookupMode;
 #else
 	olCfg.is_full_reorder_offload = 0;
 #endif
@@ -10265,6 +10337,42 @@ static void wma_update_txrx_chainmask(int num_rf_chains, int *cmd_value)
 	}
 }
 
+#ifdef QCA_SUPPORT_TX_AIRTIME_FAIRNESS
+/*
+ * Peak PHY rate (kbps, long GI) of a newly associated peer, used to seed
+ * the txrx airtime fairness scheduler until FW reports the actual tx rate.
+ */
+static u_int32_t wma_peer_phymode_tx_rate(WLAN_PHY_MODE phymode,
+					  u_int32_t nss)
+{
+	switch (phymode) {
+	case MODE_11B:
+		return 11000;
+	case MODE_11A:
+	case MODE_11G:
+	case MODE_11GONLY:
+		return 54000;
+	case MODE_11NA_HT20:
+	case MODE_11NG_HT20:
+		return 65000 * nss;
+	case MODE_11NA_HT40:
+	case MODE_11NG_HT40:
+		return 135000 * nss;
+	case MODE_11AC_VHT20:
+	case MODE_11AC_VHT20_2G:
+		return 78000 * nss;
+	case MODE_11AC_VHT40:
+	case MODE_11AC_VHT40_2G:
+		return 180000 * nss;
+	case MODE_11AC_VHT80:
+	case MODE_11AC_VHT80_2G:
+		return 390000 * nss;
+	default:
+		return 0;
+	}
+}
+#endif
+
 static int32_t wmi_unified_send_peer_assoc(tp_wma_handle wma,
 					   tSirNwType nw_type,
 					   tpAddStaParams params)
@@ -10589,6 +10697,16 @@ static int32_t wmi_unified_send_peer_assoc(tp_wma_handle wma,
 	intr->nss = cmd->peer_nss;
         cmd->peer_phymode = phymode;
 
+#ifdef QCA_SUPPORT_TX_AIRTIME_FAIRNESS
+	{
+		u_int8_t peer_mac[IEEE80211_ADDR_LEN];
+
+		WMI_MAC_ADDR_TO_CHAR_ARRAY(&cmd->peer_macaddr, peer_mac);
+		ol_txrx_peer_tx_rate_update(pdev, peer_mac,
+			wma_peer_phymode_tx_rate(phymode, cmd->peer_nss));
+	}
+#endif
+
         WMA_LOGD("%s: vdev_id %d associd %d peer_flags %x rate_caps %x "
                  "peer_caps %x listen_intval %d ht_caps %x max_mpdu %d "
                  "nss %d phymode %d peer_mpdu_density %d"
@@ -11258,6 +11376,11 @@ static void wma_process_cli_set_cmd(tp_wma_handle wma,
 		case GEN_PARAM_DUMP_PCIE_ACCESS_LOG:
 			HTCDump(wma->htc_handle, PCIE_DUMP, false);
 			break;
+#endif
+#ifdef HIF_PCI_CE_INTR_MOD
+		case GEN_PARAM_DUMP_CE_INTR_MOD:
+			HTCDump(wma->htc_handle, CE_INTR_MOD_DUMP, false);
+			break;
 #endif
 		default:
 			WMA_LOGE("Invalid param id 0x%x", privcmd->param_id);
@@ -12044,21 +12167,19 @@ wma_vdev_set_bss_params(tp_wma_handle wma, int vdev_id,
 	int ret;
 	uint32_t slot_time;
 	struct wma_txrx_node *intr = wma->interfaces;
+	struct wmi_cmd_batch batch;
+
+	wmi_unified_cmd_batch_init(&batch);
 
 	/* Beacon Interval setting */
-	ret = wmi_unified_vdev_set_param_send(wma->wmi_handle, vdev_id,
+	ret = wmi_unified_vdev_set_param_batch(wma->wmi_handle, &batch, vdev_id,
 					      WMI_VDEV_PARAM_BEACON_INTERVAL,
 					      beaconInterval);
 
 	if (ret)
 		WMA_LOGE("failed to set WMI_VDEV_PARAM_BEACON_INTERVAL");
 
-	ret = wmi_unified_vdev_set_gtx_cfg_send(wma->wmi_handle, vdev_id,
-						&intr[vdev_id].config.gtx_info);
-	if (ret)
-		WMA_LOGE("failed to set WMI_VDEV_PARAM_DTIM_PERIOD");
-
-	ret = wmi_unified_vdev_set_param_send(wma->wmi_handle, vdev_id,
+	ret = wmi_unified_vdev_set_param_batch(wma->wmi_handle, &batch, vdev_id,
 					      WMI_VDEV_PARAM_DTIM_PERIOD,
 					      dtimPeriod);
 	if (ret)
@@ -12069,7 +12190,7 @@ wma_vdev_set_bss_params(tp_wma_handle wma, int vdev_id,
 		WMA_LOGW("Setting Tx power limit to 0");
 	}
 
-	ret = wmi_unified_vdev_set_param_send(wma->wmi_handle, vdev_id,
+	ret = wmi_unified_vdev_set_param_batch(wma->wmi_handle, &batch, vdev_id,
 					WMI_VDEV_PARAM_TX_PWRLIMIT,
 					maxTxPower);
 	if (ret)
@@ -12083,12 +12204,19 @@ wma_vdev_set_bss_params(tp_wma_handle wma, int vdev_id,
 	else
 		slot_time = WMI_VDEV_SLOT_TIME_LONG;
 
-	ret = wmi_unified_vdev_set_param_send(wma->wmi_handle, vdev_id,
+	ret = wmi_unified_vdev_set_param_batch(wma->wmi_handle, &batch, vdev_id,
 					      WMI_VDEV_PARAM_SLOT_TIME,
 					      slot_time);
 	if (ret)
 		WMA_LOGE("failed to set WMI_VDEV_PARAM_SLOT_TIME");
 
+	wmi_unified_cmd_batch_flush(wma->wmi_handle, &batch);
+
+	ret = wmi_unified_vdev_set_gtx_cfg_send(wma->wmi_handle, vdev_id,
+						&intr[vdev_id].config.gtx_info);
+	if (ret)
+		WMA_LOGE("failed to set WMI_VDEV_PARAM_DTIM_PERIOD");
+
 	/* Initialize protection mode in case of coexistence */
 	wma_update_protection_mode(wma, vdev_id, llbCoexist);
 }
@@ -12212,80 +12340,95 @@ static VOS_STATUS
 wma_set_ibss_pwrsave_params(tp_wma_handle wma, u_int8_t vdev_id)
 {
 	int ret;
+	struct wmi_cmd_batch batch;
 
-	ret = wmi_unified_vdev_set_param_send(wma->wmi_handle, vdev_id,
+	wmi_unified_cmd_batch_init(&batch);
+
+	ret = wmi_unified_vdev_set_param_batch(wma->wmi_handle, &batch,
+				vdev_id,
 				WMI_VDEV_PARAM_ATIM_WINDOW_LENGTH,
 				wma->wma_ibss_power_save_params.atimWindowLength);
 	if (ret < 0) {
 		WMA_LOGE("Failed to set WMI_VDEV_PARAM_ATIM_WINDOW_LENGTH ret = %d",
 				ret);
-		return VOS_STATUS_E_FAILURE;
+		goto flush;
 	}
 
-	ret = wmi_unified_vdev_set_param_send(wma->wmi_handle, vdev_id,
+	ret = wmi_unified_vdev_set_param_batch(wma->wmi_handle, &batch,
+				vdev_id,
 				WMI_VDEV_PARAM_IS_IBSS_POWER_SAVE_ALLOWED,
 				wma->wma_ibss_power_save_params.isPowerSaveAllowed);
 	if (ret < 0) {
 		WMA_LOGE("Failed, set WMI_VDEV_PARAM_IS_IBSS_POWER_SAVE_ALLOWED ret=%d",
 				ret);
-		return VOS_STATUS_E_FAILURE;
+		goto flush;
 	}
 
-	ret = wmi_unified_vdev_set_param_send(wma->wmi_handle, vdev_id,
+	ret = wmi_unified_vdev_set_param_batch(wma->wmi_handle, &batch,
+				vdev_id,
 				WMI_VDEV_PARAM_IS_POWER_COLLAPSE_ALLOWED,
 				wma->wma_ibss_power_save_params.isPowerCollapseAllowed);
 	if (ret < 0) {
 		WMA_LOGE("Failed, set WMI_VDEV_PARAM_IS_POWER_COLLAPSE_ALLOWED ret=%d",
 				ret);
-		return VOS_STATUS_E_FAILURE;
+		goto flush;
 	}
 
-	ret = wmi_unified_vdev_set_param_send(wma->wmi_handle, vdev_id,
+	ret = wmi_unified_vdev_set_param_batch(wma->wmi_handle, &batch,
+				vdev_id,
 				WMI_VDEV_PARAM_IS_AWAKE_ON_TXRX_ENABLED,
 				wma->wma_ibss_power_save_params.isAwakeonTxRxEnabled);
 	if (ret < 0) {
 		WMA_LOGE("Failed, set WMI_VDEV_PARAM_IS_AWAKE_ON_TXRX_ENABLED ret=%d",
 				ret);
-		return VOS_STATUS_E_FAILURE;
+		goto flush;
 	}
 
-	ret = wmi_unified_vdev_set_param_send(wma->wmi_handle, vdev_id,
+	ret = wmi_unified_vdev_set_param_batch(wma->wmi_handle, &batch,
+				vdev_id,
 				WMI_VDEV_PARAM_INACTIVITY_CNT,
 				wma->wma_ibss_power_save_params.inactivityCount);
 	if (ret < 0) {
 		WMA_LOGE("Failed, set WMI_VDEV_PARAM_INACTIVITY_CNT ret=%d",
 				ret);
-		return VOS_STATUS_E_FAILURE;
+		goto flush;
 	}
 
-	ret = wmi_unified_vdev_set_param_send(wma->wmi_handle, vdev_id,
+	ret = wmi_unified_vdev_set_param_batch(wma->wmi_handle, &batch,
+				vdev_id,
 				WMI_VDEV_PARAM_TXSP_END_INACTIVITY_TIME_MS,
 				wma->wma_ibss_power_save_params.txSPEndInactivityTime);
 	if (ret < 0) {
 		WMA_LOGE("Failed, set WMI_VDEV_PARAM_TXSP_END_INACTIVITY_TIME_MS ret=%d",
 				ret);
-		return VOS_STATUS_E_FAILURE;
+		goto flush;
 	}
 
-	ret = wmi_unified_vdev_set_param_send(wma->wmi_handle, vdev_id,
+	ret = wmi_unified_vdev_set_param_batch(wma->wmi_handle, &batch,
+				vdev_id,
             WMI_VDEV_PARAM_IBSS_PS_WARMUP_TIME_SECS,
             wma->wma_ibss_power_save_params.ibssPsWarmupTime);
 	if (ret < 0) {
 		WMA_LOGE("Failed, set WMI_VDEV_PARAM_IBSS_PS_WARMUP_TIME_SECS ret=%d",
 				ret);
-		return VOS_STATUS_E_FAILURE;
+		goto flush;
 	}
 
-	ret = wmi_unified_vdev_set_param_send(wma->wmi_handle, vdev_id,
+	ret = wmi_unified_vdev_set_param_batch(wma->wmi_handle, &batch,
+				vdev_id,
 				WMI_VDEV_PARAM_IBSS_PS_1RX_CHAIN_IN_ATIM_WINDOW_ENABLE,
 				wma->wma_ibss_power_save_params.ibssPs1RxChainInAtimEnable);
 	if (ret < 0) {
 		WMA_LOGE("Failed to set IBSS_PS_1RX_CHAIN_IN_ATIM_WINDOW_ENABLE ret=%d",
 				ret);
-		return VOS_STATUS_E_FAILURE;
+		goto flush;
 	}
 
-	return VOS_STATUS_SUCCESS;
+flush:
+	/* send whatever was queued, even if a later param failed */
+	wmi_unified_cmd_batch_flush(wma->wmi_handle, &batch);
+
+	return (ret < 0) ? VOS_STATUS_E_FAILURE : VOS_STATUS_SUCCESS;
 }
 
 static void wma_add_bss_ibss_mode(tp_wma_handle wma, tpAddBssParams add_bss)
@@ -53,6 +53,11 @@
 #if defined(QCA_WIFI_2_0) && !defined(QCA_WIFI_ISOC) && defined(CONFIG_CNSS)
 #include <net/cnss.h>
 #endif
+#include <linux/ktime.h>
+#ifdef WLAN_OPEN_SOURCE
+#include <linux/debugfs.h>
+#include <linux/seq_file.h>
+#endif
 
 #define WMI_MIN_HEAD_ROOM 64
 #define WMI_MAX_LEN_BYTES 2048
@@ -633,12 +638,15 @@ static void recovery_work_handler(struct work_struct *recovery)
 
 static DECLARE_WORK(recovery_work, recovery_work_handler);
 
-/* WMI command API */
-int wmi_unified_cmd_send(wmi_unified_t wmi_handle, wmi_buf_t buf, int len,
-			 WMI_CMD_ID cmd_id)
+/*
+ * Validate a command, add the WMI header and wrap it in an HTC packet
+ * that is ready to be handed to HTC.
+ */
+static int wmi_unified_cmd_prepare(wmi_unified_t wmi_handle, wmi_buf_t buf,
+				   int len, WMI_CMD_ID cmd_id,
+				   HTC_PACKET **ppkt)
 {
 	HTC_PACKET *pkt;
-	A_STATUS status;
 	void *vos_context;
 	struct ol_softc *scn;
 
@@ -714,6 +722,22 @@ int wmi_unified_cmd_send(wmi_unified_t wmi_handle, wmi_buf_t buf, int len,
 	adf_os_spin_unlock_bh(&wmi_handle->wmi_record_lock);
 #endif
 
+	*ppkt = pkt;
+	return 0;
+}
+
+/* WMI command API */
+int wmi_unified_cmd_send(wmi_unified_t wmi_handle, wmi_buf_t buf, int len,
+			 WMI_CMD_ID cmd_id)
+{
+	HTC_PACKET *pkt;
+	A_STATUS status;
+	int ret;
+
+	ret = wmi_unified_cmd_prepare(wmi_handle, buf, len, cmd_id, &pkt);
+	if (ret)
+		return ret;
+
 	status = HTCSendPkt(wmi_handle->htc_handle, pkt);
 
 	if (A_OK != status) {
@@ -725,12 +749,84 @@ int wmi_unified_cmd_send(wmi_unified_t wmi_handle, wmi_buf_t buf, int len,
 	return ((status == A_OK) ? EOK : -1);
 }
 
+void wmi_unified_cmd_batch_init(struct wmi_cmd_batch *batch)
+{
+	INIT_HTC_PACKET_QUEUE(&batch->pkt_queue);
+	batch->num_cmds = 0;
+}
+
+int wmi_unified_cmd_batch_add(wmi_unified_t wmi_handle,
+			      struct wmi_cmd_batch *batch, wmi_buf_t buf,
+			      int len, WMI_CMD_ID cmd_id)
+{
+	HTC_PACKET *pkt;
+	int ret;
+
+	ret = wmi_unified_cmd_prepare(wmi_handle, buf, len, cmd_id, &pkt);
+	if (ret)
+		return ret;
+
+	HTC_PACKET_ENQUEUE(&batch->pkt_queue, pkt);
+	batch->num_cmds++;
+	return EOK;
+}
+
+void wmi_unified_cmd_batch_flush(wmi_unified_t wmi_handle,
+				 struct wmi_cmd_batch *batch)
+{
+	if (!batch->num_cmds)
+		return;
+
+	/*
+	 * HTC takes the credits for the whole queue in one pass. With a
+	 * non-empty queue HTCSendPktsMultiple() always takes ownership of
+	 * every packet: a command it cannot send is completed with an
+	 * error status through wmi_htc_tx_complete(), which frees it, so
+	 * there is no synchronous per-command status to report here.
+	 */
+	HTCSendPktsMultiple(wmi_handle->htc_handle, &batch->pkt_queue);
+	batch->num_cmds = 0;
+}
+
 
 /* WMI Event handler register API */
+static u_int16_t *wmi_unified_event_dispatch_slot(wmi_unified_t wmi_handle,
+						  WMI_EVT_ID event_id,
+						  A_BOOL alloc)
+{
+	u_int32_t grp = WMI_EVT_DISPATCH_GRP(event_id);
+	u_int32_t slot = WMI_EVT_DISPATCH_SLOT(event_id);
+
+	if (grp >= WMI_EVT_DISPATCH_MAX_GRP ||
+	    slot >= WMI_EVT_DISPATCH_GRP_SIZE)
+		return NULL;
+
+	if (!wmi_handle->event_dispatch[grp] && alloc) {
+		wmi_handle->event_dispatch[grp] = adf_os_mem_alloc(NULL,
+			WMI_EVT_DISPATCH_GRP_SIZE * sizeof(u_int16_t));
+	}
+	if (!wmi_handle->event_dispatch[grp])
+		return NULL;
+
+	return &wmi_handle->event_dispatch[grp][slot];
+}
+
 int wmi_unified_get_event_handler_ix(wmi_unified_t wmi_handle,
 					WMI_EVT_ID event_id)
 {
 	u_int32_t idx = 0;
+
+	if (WMI_EVT_DISPATCH_GRP(event_id) < WMI_EVT_DISPATCH_MAX_GRP &&
+	    WMI_EVT_DISPATCH_SLOT(event_id) < WMI_EVT_DISPATCH_GRP_SIZE) {
+		u_int16_t *slot;
+
+		slot = wmi_unified_event_dispatch_slot(wmi_handle, event_id,
+						       FALSE);
+		if (!slot || !*slot)
+			return -1;
+		return *slot - 1;
+	}
+
 	for (idx = 0; (idx < wmi_handle->max_event_idx &&
 		idx < WMI_UNIFIED_MAX_EVENT); ++idx) {
 		if (wmi_handle->event_id[idx] == event_id &&
@@ -746,6 +842,7 @@ int wmi_unified_register_event_handler(wmi_unified_t wmi_handle,
 				       wmi_unified_event_handler handler_func)
 {
 	u_int32_t idx=0;
+	u_int16_t *slot;
 
     if ( wmi_unified_get_event_handler_ix( wmi_handle, event_id) != -1) {
 	printk("%s : event handler already registered 0x%x \n",
@@ -758,8 +855,19 @@ int wmi_unified_register_event_handler(wmi_unified_t wmi_handle,
         return -1;
     }
     idx=wmi_handle->max_event_idx;
+    slot = wmi_unified_event_dispatch_slot(wmi_handle, event_id, TRUE);
+    if (!slot && WMI_EVT_DISPATCH_GRP(event_id) < WMI_EVT_DISPATCH_MAX_GRP &&
+        WMI_EVT_DISPATCH_SLOT(event_id) < WMI_EVT_DISPATCH_GRP_SIZE) {
+	printk("%s : no memory for dispatch table 0x%x \n",
+		__func__, event_id);
+        return -1;
+    }
+    if (slot)
+        *slot = idx + 1;
     wmi_handle->event_handler[idx] = handler_func;
     wmi_handle->event_id[idx] = event_id;
+    OS_MEMZERO(&wmi_handle->event_stats[idx],
+               sizeof(wmi_handle->event_stats[idx]));
     wmi_handle->max_event_idx++;
 
     return 0;
@@ -769,19 +877,152 @@ int wmi_unified_unregister_event_handler(wmi_unified_t wmi_handle,
                                        WMI_EVT_ID event_id)
 {
     u_int32_t idx=0;
+    u_int16_t *slot;
+
     if ( (idx = wmi_unified_get_event_handler_ix( wmi_handle, event_id)) == -1) {
         printk("%s : event handler is not registered: event id 0x%x \n",
                 __func__, event_id);
         return -1;
     }
+    slot = wmi_unified_event_dispatch_slot(wmi_handle, event_id, FALSE);
+    if (slot)
+        *slot = 0;
     wmi_handle->event_handler[idx] = NULL;
     wmi_handle->event_id[idx] = 0;
     --wmi_handle->max_event_idx;
     wmi_handle->event_handler[idx] = wmi_handle->event_handler[wmi_handle->max_event_idx];
     wmi_handle->event_id[idx]  = wmi_handle->event_id[wmi_handle->max_event_idx] ;
+    wmi_handle->event_stats[idx] =
+        wmi_handle->event_stats[wmi_handle->max_event_idx];
+    if (idx != wmi_handle->max_event_idx) {
+        slot = wmi_unified_event_dispatch_slot(wmi_handle,
+                                               wmi_handle->event_id[idx],
+                                               FALSE);
+        if (slot)
+            *slot = idx + 1;
+    }
     return 0;
 }
 
+/*
+ * Call the handler registered at idx and account the time spent in it.
+ * adf_get_boottime only has jiffy resolution without CNSS, which would
+ * round most handlers down to zero, so time them with ktime_get.
+ */
+static inline void wmi_unified_call_event_handler(wmi_unified_t wmi_handle,
+						  u_int32_t idx, u_int8_t *data,
+						  u_int32_t len)
+{
+	struct wmi_event_handler_stats *stats = &wmi_handle->event_stats[idx];
+	ktime_t start = ktime_get();
+	u_int32_t elapsed;
+
+	wmi_handle->event_handler[idx](wmi_handle->scn_handle, data, len);
+
+	elapsed = (u_int32_t)ktime_to_us(ktime_sub(ktime_get(), start));
+	stats->hits++;
+	stats->time_us += elapsed;
+	if (elapsed > stats->max_time_us)
+		stats->max_time_us = elapsed;
+}
+
+#ifdef WLAN_OPEN_SOURCE
+static int wmi_event_stats_show(struct seq_file *m, void *v)
+{
+	struct wmi_unified *wmi_handle = m->private;
+	struct wmi_event_handler_stats *stats;
+	u_int32_t idx;
+
+	seq_printf(m, "%-10s %10s %14s %10s %10s\n",
+		   "event_id", "hits", "total_us", "avg_us", "max_us");
+	for (idx = 0; idx < wmi_handle->max_event_idx; idx++) {
+		stats = &wmi_handle->event_stats[idx];
+		seq_printf(m, "0x%-8x %10u %14llu %10llu %10u\n",
+			   wmi_handle->event_id[idx], stats->hits,
+			   (unsigned long long)stats->time_us,
+			   stats->hits ? (unsigned long long)
+			   div_u64(stats->time_us, stats->hits) : 0,
+			   stats->max_time_us);
+	}
+	return 0;
+}
+
+static int wmi_event_latency_show(struct seq_file *m, void *v)
+{
+	static const char * const class_name[WMI_RX_EVENT_CLASS_MAX] = {
+		"ctrl", "bulk"
+	};
+	struct wmi_unified *wmi_handle = m->private;
+	struct wmi_rx_event_queue *q;
+	int i;
+
+	seq_printf(m, "%-5s %6s %6s %10s %8s %8s %8s %8s %8s %8s %10s\n",
+		   "class", "depth", "max", "processed", "<100us", "<1ms",
+		   "<10ms", "<100ms", "<1s", ">=1s", "max_us");
+	for (i = 0; i < WMI_RX_EVENT_CLASS_MAX; i++) {
+		q = &wmi_handle->rx_evt_q[i];
+		seq_printf(m,
+			   "%-5s %6u %6u %10u %8u %8u %8u %8u %8u %8u %10u\n",
+			   class_name[i], q->depth, q->max_depth, q->processed,
+			   q->latency_hist[0], q->latency_hist[1],
+			   q->latency_hist[2], q->latency_hist[3],
+			   q->latency_hist[4], q->latency_hist[5],
+			   q->max_latency_us);
+	}
+	return 0;
+}
+
+static int wmi_event_latency_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, wmi_event_latency_show, inode->i_private);
+}
+
+static const struct file_operations fops_wmi_event_latency = {
+	.open = wmi_event_latency_open,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = single_release,
+	.owner = THIS_MODULE,
+};
+
+static int wmi_event_stats_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, wmi_event_stats_show, inode->i_private);
+}
+
+static const struct file_operations fops_wmi_event_stats = {
+	.open = wmi_event_stats_open,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = single_release,
+	.owner = THIS_MODULE,
+};
+
+/**
+ * wmi_unified_debugfs_init() - add the WMI event dispatch statistics files
+ * @wmi_handle: handle to WMI, with its debugfs directory already created
+ *
+ * Return: 0 on success, -ENOMEM if a file could not be created
+ */
+int wmi_unified_debugfs_init(struct wmi_unified *wmi_handle)
+{
+	if (!wmi_handle->debugfs_phy)
+		return -ENOMEM;
+
+	if (!debugfs_create_file("wmi_event_stats", S_IRUSR,
+				 wmi_handle->debugfs_phy, wmi_handle,
+				 &fops_wmi_event_stats))
+		return -ENOMEM;
+
+	if (!debugfs_create_file("wmi_event_latency", S_IRUSR,
+				 wmi_handle->debugfs_phy, wmi_handle,
+				 &fops_wmi_event_latency))
+		return -ENOMEM;
+
+	return 0;
+}
+#endif /* WLAN_OPEN_SOURCE */
+
 #if 0 /* currently not used */
 static int wmi_unified_event_rx(struct wmi_unified *wmi_handle,
 				wmi_buf_t evt_buf)
@@ -819,6 +1060,87 @@ end:
 }
 #endif /* 0 */
 
+/*
+ * Beacons and probe responses are the bulk of WMI_MGMT_RX_EVENTID. Every
+ * other management frame (auth, assoc, deauth, action...) has to stay in
+ * order with the control events of the same peer, so it keeps the control
+ * class. evt_buf still starts with the WMI_CMD_HDR; the event is the
+ * wmi_mgmt_rx_hdr TLV followed by the frame as a byte array TLV.
+ */
+static bool wmi_mgmt_rx_is_bulk(wmi_buf_t evt_buf)
+{
+	u_int8_t *data = adf_nbuf_data(evt_buf) + sizeof(WMI_CMD_HDR);
+	u_int32_t len = adf_nbuf_len(evt_buf);
+	u_int32_t offset;
+	u_int8_t subtype;
+
+	if (len < sizeof(WMI_CMD_HDR) + WMI_TLV_HDR_SIZE)
+		return false;
+	len -= sizeof(WMI_CMD_HDR);
+
+	offset = WMI_TLV_HDR_SIZE + WMITLV_GET_TLVLEN(*(A_UINT32 *)data) +
+		 WMI_TLV_HDR_SIZE;
+	if (len <= offset)
+		return false;
+
+	/* frame control byte 0: subtype in the upper nibble */
+	subtype = data[offset] >> 4;
+	return (SIR_MAC_MGMT_BEACON == subtype) ||
+	       (SIR_MAC_MGMT_PROBE_RSP == subtype);
+}
+
+/*
+ * High rate events whose handling can be deferred behind control events.
+ * A scan completion must stay behind the beacons and probe responses it
+ * covers, so the whole scan group is bulk as well.
+ */
+static inline enum wmi_rx_event_class wmi_rx_event_class(u_int32_t id,
+							 wmi_buf_t evt_buf)
+{
+	switch (WMI_EVT_DISPATCH_GRP(id)) {
+	case WMI_GRP_SCAN:
+	case WMI_GRP_STATS:
+	case WMI_GRP_NLO_OFL:
+	case WMI_GRP_EXTSCAN:
+		return WMI_RX_EVENT_CLASS_BULK;
+	default:
+		break;
+	}
+
+	switch (id) {
+	case WMI_MGMT_RX_EVENTID:
+		return wmi_mgmt_rx_is_bulk(evt_buf) ? WMI_RX_EVENT_CLASS_BULK :
+						      WMI_RX_EVENT_CLASS_CTRL;
+	case WMI_DEBUG_MESG_EVENTID:
+	case WMI_DEBUG_PRINT_EVENTID:
+	case WMI_UPDATE_STATS_EVENTID:
+	case WMI_UPDATE_WHAL_MIB_STATS_EVENTID:
+	case WMI_UPDATE_VDEV_RATE_STATS_EVENTID:
+	case WMI_DIAG_DATA_CONTAINER_EVENTID:
+	case WMI_DIAG_EVENTID:
+		return WMI_RX_EVENT_CLASS_BULK;
+	default:
+		return WMI_RX_EVENT_CLASS_CTRL;
+	}
+}
+
+static void wmi_rx_event_latency_record(struct wmi_rx_event_queue *q,
+					u_int32_t latency_us)
+{
+	u_int32_t bucket = 0;
+	u_int32_t limit = 100;
+
+	while (bucket < WMI_RX_EVENT_LATENCY_BUCKETS - 1 &&
+	       latency_us >= limit) {
+		bucket++;
+		limit *= 10;
+	}
+	q->latency_hist[bucket]++;
+	q->processed++;
+	if (latency_us > q->max_latency_us)
+		q->max_latency_us = latency_us;
+}
+
 /*
  * Temporarily added to support older WMI events. We should move all events to unified
  * when the target is ready to support it.
@@ -840,14 +1162,15 @@ void wmi_control_rx(void *ctx, HTC_PACKET *htc_packet)
 	int tlv_ok_status = 0;
 #endif /* QCA_CONFIG_SMP */
 
-#if  defined(WMI_INTERFACE_EVENT_LOGGING) || !defined(QCA_CONFIG_SMP)
 	u_int32_t id;
+	struct wmi_rx_event_queue *q;
+#if  defined(WMI_INTERFACE_EVENT_LOGGING) || !defined(QCA_CONFIG_SMP)
 	u_int8_t *data;
 #endif
 
 	evt_buf = (wmi_buf_t) htc_packet->pPktContext;
-#ifndef QCA_CONFIG_SMP
 	id = WMI_GET_FIELD(adf_nbuf_data(evt_buf), WMI_CMD_HDR, COMMANDID);
+#ifndef QCA_CONFIG_SMP
 	/* TX_PAUSE EVENT should be handled with tasklet context */
 	if (WMI_TX_PAUSE_EVENTID == id) {
 		if (adf_nbuf_pull_head(evt_buf, sizeof(WMI_CMD_HDR)) == NULL)
@@ -874,8 +1197,8 @@ void wmi_control_rx(void *ctx, HTC_PACKET *htc_packet)
 			adf_nbuf_free(evt_buf);
 			return;
 		}
-		wmi_handle->event_handler[idx](wmi_handle->scn_handle,
-			       wmi_cmd_struct_ptr, len);
+		wmi_unified_call_event_handler(wmi_handle, idx,
+					       wmi_cmd_struct_ptr, len);
 		wmitlv_free_allocated_event_tlvs(id, &wmi_cmd_struct_ptr);
 		adf_nbuf_free(evt_buf);
 		return;
@@ -883,7 +1206,6 @@ void wmi_control_rx(void *ctx, HTC_PACKET *htc_packet)
 #endif /* QCA_CONFIG_SMP */
 
 #ifdef WMI_INTERFACE_EVENT_LOGGING
-	id = WMI_GET_FIELD(adf_nbuf_data(evt_buf), WMI_CMD_HDR, COMMANDID);
 	data = adf_nbuf_data(evt_buf);
 
 	adf_os_spin_lock_bh(&wmi_handle->wmi_record_lock);
@@ -891,10 +1213,17 @@ void wmi_control_rx(void *ctx, HTC_PACKET *htc_packet)
 	WMI_RX_EVENT_RECORD(id, ((u_int8_t *)data + 4));
 	adf_os_spin_unlock_bh(&wmi_handle->wmi_record_lock);
 #endif
+	q = &wmi_handle->rx_evt_q[wmi_rx_event_class(id, evt_buf)];
+	adf_nbuf_set_timestamp(evt_buf);
 	adf_os_spin_lock_bh(&wmi_handle->eventq_lock);
-	adf_nbuf_queue_add(&wmi_handle->event_queue, evt_buf);
+	adf_nbuf_queue_add(&q->event_queue, evt_buf);
+	if (++q->depth > q->max_depth)
+		q->max_depth = q->depth;
 	adf_os_spin_unlock_bh(&wmi_handle->eventq_lock);
-	schedule_work(&wmi_handle->rx_event_work);
+	if (q->wq)
+		queue_work(q->wq, &q->rx_event_work);
+	else
+		schedule_work(&q->rx_event_work);
 }
 
 void __wmi_control_rx(struct wmi_unified *wmi_handle, wmi_buf_t evt_buf)
@@ -945,7 +1274,7 @@ void __wmi_control_rx(struct wmi_unified *wmi_handle, wmi_buf_t evt_buf)
 		adf_os_spin_unlock_bh(&wmi_handle->wmi_record_lock);
 #endif
 		/* Call the WMI registered event handler */
-		wmi_handle->event_handler[idx](wmi_handle->scn_handle,
+		wmi_unified_call_event_handler(wmi_handle, idx,
 					       wmi_cmd_struct_ptr, len);
 		goto end;
 	}
@@ -971,17 +1300,34 @@ end:
 
 void __wmi_rx_event_work(struct work_struct *work)
 {
-	struct wmi_unified *wmi = container_of(work, struct wmi_unified,
-					       rx_event_work);
+	struct wmi_rx_event_queue *q = container_of(work,
+						    struct wmi_rx_event_queue,
+						    rx_event_work);
+	struct wmi_unified *wmi = q->wmi_handle;
 	wmi_buf_t buf;
+	adf_nbuf_timestamp_t enqueued;
 
 	adf_os_spin_lock_bh(&wmi->eventq_lock);
-	buf = adf_nbuf_queue_remove(&wmi->event_queue);
+	buf = adf_nbuf_queue_remove(&q->event_queue);
+	if (buf)
+		q->depth--;
 	adf_os_spin_unlock_bh(&wmi->eventq_lock);
 	while (buf) {
+		/*
+		 * Latency runs from wmi_control_rx queueing the event to its
+		 * handler returning; __wmi_control_rx frees buf, so keep the
+		 * enqueue time aside.
+		 */
+		enqueued = adf_nbuf_get_timestamp(buf);
+		adf_os_mutex_acquire(NULL, &wmi->event_handler_lock);
 		__wmi_control_rx(wmi, buf);
+		adf_os_mutex_release(NULL, &wmi->event_handler_lock);
+		wmi_rx_event_latency_record(q,
+			(u_int32_t)adf_nbuf_timestamp_delta_us(enqueued));
 		adf_os_spin_lock_bh(&wmi->eventq_lock);
-		buf = adf_nbuf_queue_remove(&wmi->event_queue);
+		buf = adf_nbuf_queue_remove(&q->event_queue);
+		if (buf)
+			q->depth--;
 		adf_os_spin_unlock_bh(&wmi->eventq_lock);
 	}
 }
@@ -999,6 +1345,8 @@ void *
 wmi_unified_attach(ol_scn_t scn_handle, wma_wow_tx_complete_cbk func)
 {
     struct wmi_unified *wmi_handle;
+    int i;
+
     wmi_handle = (struct wmi_unified *)OS_MALLOC(NULL, sizeof(struct wmi_unified), GFP_ATOMIC);
     if (wmi_handle == NULL) {
         printk("allocation of wmi handle failed %zu \n", sizeof(struct wmi_unified));
@@ -1009,12 +1357,21 @@ wmi_unified_attach(ol_scn_t scn_handle, wma_wow_tx_complete_cbk func)
     adf_os_atomic_init(&wmi_handle->pending_cmds);
     adf_os_atomic_init(&wmi_handle->is_target_suspended);
     adf_os_spinlock_init(&wmi_handle->eventq_lock);
-    adf_nbuf_queue_init(&wmi_handle->event_queue);
+    adf_os_init_mutex(&wmi_handle->event_handler_lock);
+    for (i = 0; i < WMI_RX_EVENT_CLASS_MAX; i++) {
+        struct wmi_rx_event_queue *q = &wmi_handle->rx_evt_q[i];
+
+        q->wmi_handle = wmi_handle;
+        adf_nbuf_queue_init(&q->event_queue);
 #ifdef CONFIG_CNSS
-    cnss_init_work(&wmi_handle->rx_event_work, wmi_rx_event_work);
+        cnss_init_work(&q->rx_event_work, wmi_rx_event_work);
 #else
-    INIT_WORK(&wmi_handle->rx_event_work, wmi_rx_event_work);
+        INIT_WORK(&q->rx_event_work, wmi_rx_event_work);
 #endif
+    }
+    /* control events fall back to the system workqueue if this fails */
+    wmi_handle->rx_evt_q[WMI_RX_EVENT_CLASS_CTRL].wq =
+        alloc_ordered_workqueue("wmi_rx_ctrl_wq", WQ_HIGHPRI);
 #ifdef WMI_INTERFACE_EVENT_LOGGING
     adf_os_spinlock_init(&wmi_handle->wmi_record_lock);
 #endif
@@ -1026,15 +1383,30 @@ void
 wmi_unified_detach(struct wmi_unified* wmi_handle)
 {
     wmi_buf_t buf;
-
-    vos_flush_work(&wmi_handle->rx_event_work);
-    adf_os_spin_lock_bh(&wmi_handle->eventq_lock);
-    buf = adf_nbuf_queue_remove(&wmi_handle->event_queue);
-    while (buf) {
-	adf_nbuf_free(buf);
-	buf = adf_nbuf_queue_remove(&wmi_handle->event_queue);
+    u_int32_t grp;
+    int i;
+
+    for (i = 0; i < WMI_RX_EVENT_CLASS_MAX; i++) {
+        struct wmi_rx_event_queue *q = &wmi_handle->rx_evt_q[i];
+
+        vos_flush_work(&q->rx_event_work);
+        if (q->wq) {
+            destroy_workqueue(q->wq);
+            q->wq = NULL;
+        }
+        adf_os_spin_lock_bh(&wmi_handle->eventq_lock);
+        buf = adf_nbuf_queue_remove(&q->event_queue);
+        while (buf) {
+            adf_nbuf_free(buf);
+            buf = adf_nbuf_queue_remove(&q->event_queue);
+        }
+        q->depth = 0;
+        adf_os_spin_unlock_bh(&wmi_handle->eventq_lock);
+    }
+    for (grp = 0; grp < WMI_EVT_DISPATCH_MAX_GRP; grp++) {
+        if (wmi_handle->event_dispatch[grp])
+            adf_os_mem_free(wmi_handle->event_dispatch[grp]);
     }
-    adf_os_spin_unlock_bh(&wmi_handle->eventq_lock);
     if (wmi_handle != NULL) {
         OS_FREE(wmi_handle);
         wmi_handle = NULL;
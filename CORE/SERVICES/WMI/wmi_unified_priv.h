@@ -40,6 +40,52 @@
 #define WMI_UNIFIED_MAX_EVENT 0x100
 #define WMI_MAX_CMDS  1024
 
+/*
+ * Event handler dispatch table.
+ * WMI event ids are (group << 12) | n, so the registered handler index is
+ * found through a two level direct map: a per-group leaf, allocated on first
+ * registration in that group, maps the low bits of the id to (idx + 1).
+ * Ids that fall outside the map are still resolved by a linear search.
+ */
+#define WMI_EVT_DISPATCH_MAX_GRP      0x40
+#define WMI_EVT_DISPATCH_GRP_SIZE     0x100
+#define WMI_EVT_DISPATCH_GRP(id)      ((id) >> 12)
+#define WMI_EVT_DISPATCH_SLOT(id)     ((id) & 0xfff)
+
+struct wmi_event_handler_stats {
+	u_int32_t hits;
+	u_int64_t time_us;
+	u_int32_t max_time_us;
+};
+
+/*
+ * Deferred event classes.
+ * Control events (connection, roam, vdev/peer state, ...) are drained by a
+ * dedicated high priority worker so that they are not stuck behind a burst
+ * of scan results or stats; bulk events keep using the system workqueue.
+ * Handlers of both classes are still run one at a time.
+ */
+enum wmi_rx_event_class {
+	WMI_RX_EVENT_CLASS_CTRL = 0,
+	WMI_RX_EVENT_CLASS_BULK,
+	WMI_RX_EVENT_CLASS_MAX
+};
+
+/* enqueue to handler completion: <100us, <1ms, <10ms, <100ms, <1s, >=1s */
+#define WMI_RX_EVENT_LATENCY_BUCKETS 6
+
+struct wmi_rx_event_queue {
+	struct wmi_unified *wmi_handle;
+	adf_nbuf_queue_t event_queue;
+	struct work_struct rx_event_work;
+	struct workqueue_struct *wq;
+	u_int32_t depth;
+	u_int32_t max_depth;
+	u_int32_t processed;
+	u_int32_t max_latency_us;
+	u_int32_t latency_hist[WMI_RX_EVENT_LATENCY_BUCKETS];
+};
+
 typedef adf_nbuf_t wmi_buf_t;
 
 #ifdef WMI_INTERFACE_EVENT_LOGGING
@@ -77,10 +123,12 @@ struct wmi_unified {
 	WMI_EVT_ID event_id[WMI_UNIFIED_MAX_EVENT];
 	wmi_unified_event_handler event_handler[WMI_UNIFIED_MAX_EVENT];
 	u_int32_t max_event_idx;
+	u_int16_t *event_dispatch[WMI_EVT_DISPATCH_MAX_GRP];
+	struct wmi_event_handler_stats event_stats[WMI_UNIFIED_MAX_EVENT];
 	void *htc_handle;
 	adf_os_spinlock_t eventq_lock;
-	adf_nbuf_queue_t event_queue;
-	struct work_struct rx_event_work;
+	struct wmi_rx_event_queue rx_evt_q[WMI_RX_EVENT_CLASS_MAX];
+	adf_os_mutex_t event_handler_lock;
 #ifdef WLAN_OPEN_SOURCE
        struct fwdebug dbglog;
        struct dentry *debugfs_phy;
@@ -96,4 +144,8 @@ struct wmi_unified {
 	A_BOOL in_d0wow;
 #endif
 };
+
+#ifdef WLAN_OPEN_SOURCE
+int wmi_unified_debugfs_init(struct wmi_unified *wmi_handle);
+#endif /* WLAN_OPEN_SOURCE */
 #endif
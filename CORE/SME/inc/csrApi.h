@@ -1571,6 +1571,14 @@ typedef eHalStatus (*csrScanCompleteCallback)(tHalHandle, void *p2,
                                               tANI_U32 scanID,
                                               eCsrScanStatus status);
 
+#ifdef FEATURE_WLAN_SCAN_RESULT_STREAMING
+//Receives the BSSs found while a scan is still running. hResult belongs to
+//the callee, which frees it with sme_ScanResultPurge
+typedef void (*csrScanResultStreamCallback)(void *pContext,
+                                            tANI_U8 sessionId,
+                                            tScanResultHandle hResult);
+#endif
+
 
 
 ///////////////////////////////////////////Common Roam starts
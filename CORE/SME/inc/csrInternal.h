@@ -707,11 +707,55 @@ typedef struct tagCsrVotes11d
     tANI_U8 countryCode[WNI_CFG_COUNTRY_CODE_LEN];
 }tCsrVotes11d;
 
+//Sized so that a full scan cache (CSR_MAX_BSS_SUPPORT) keeps the chains short
+#define CSR_SCAN_BSSID_HASH_SIZE    256
+#define CSR_SCAN_SSID_HASH_SIZE     64
+#define CSR_SCAN_CHAN_HASH_SIZE     64
+
+struct tagCsrScanResult;
+
+typedef struct tagCsrScanIndexLink
+{
+    struct tagCsrScanResult *pNext;
+    //Points to the previous entry's pNext, or to the bucket head
+    struct tagCsrScanResult **ppPrev;
+}tCsrScanIndexLink;
+
+//Hash index over scanResultList, protected by the scanResultList lock
+typedef struct tagCsrScanIndex
+{
+    struct tagCsrScanResult *bssidHash[CSR_SCAN_BSSID_HASH_SIZE];
+    //The extra bucket holds BSSs without an SSID IE, they match any SSID filter
+    struct tagCsrScanResult *ssidHash[CSR_SCAN_SSID_HASH_SIZE + 1];
+    struct tagCsrScanResult *chanHash[CSR_SCAN_CHAN_HASH_SIZE];
+    tANI_U32 nextSeq;
+    tANI_U32 queryGen;
+    //csrScanGetResult statistics
+    tANI_U32 numQueries;
+    tANI_U32 numIndexedQueries;
+    tANI_U32 lastQueryUs;
+    tANI_U32 maxQueryUs;
+    tANI_U64 totalQueryUs;
+}tCsrScanIndex;
+
+//Parsed IEs kept with scanResultList entries, protected by the scanResultList lock
+typedef struct tagCsrScanIesCache
+{
+    tANI_U32 numEntries;
+    tANI_U32 numBytes;
+    tANI_U32 numHits;
+    tANI_U32 numMisses;
+    //Entries that could not keep their IEs because the budget was used up
+    tANI_U32 numOverBudget;
+}tCsrScanIesCache;
+
 typedef struct tagCsrScanStruct
 {
     tScanProfile scanProfile;
     tANI_U32 nextScanID;
     tDblLinkList scanResultList;
+    tCsrScanIndex resultIndex;
+    tCsrScanIesCache iesCache;
     tDblLinkList tempScanResults;
     tANI_BOOLEAN fScanEnable;
     tANI_BOOLEAN fFullScanIssued;
@@ -722,6 +766,15 @@ typedef struct tagCsrScanStruct
     vos_timer_t hTimerIdleScan;
     vos_timer_t hTimerResultAging;
     vos_timer_t hTimerResultCfgAging;
+#ifdef FEATURE_WLAN_SCAN_RESULT_STREAMING
+    csrScanResultStreamCallback streamCallback;
+    void *pStreamContext;
+    //BSSs waiting to be streamed, a tScanResultList of copies
+    void *pStreamBatch;
+    tANI_U8 streamSessionId;
+    //flushes a partial batch CSR_SCAN_STREAM_INTERVAL_MS after its first BSS
+    vos_timer_t hTimerStream;
+#endif
     //changes on every scan, it is used as a flag for whether 11d info is found on every scan
     tANI_U8 channelOf11dInfo;
     tANI_U8 scanResultCfgAgingTime;
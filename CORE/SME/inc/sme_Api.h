@@ -622,6 +622,21 @@ tCsrScanResultInfo *sme_ScanResultGetNext(tHalHandle,
   ---------------------------------------------------------------------------*/
 eHalStatus sme_ScanResultPurge(tHalHandle hHal, tScanResultHandle hScanResult);
 
+#ifdef FEATURE_WLAN_SCAN_RESULT_STREAMING
+/* ---------------------------------------------------------------------------
+    \fn sme_ScanRegisterResultStreamCallback
+    \brief a function to register the callback that receives the BSSs found
+           by an offloaded scan while the scan is still running
+    \param callback - gets a scan result list to be freed with
+                      sme_ScanResultPurge, NULL stops streaming
+    \param pContext - opaque context handed back to callback
+    \return eHalStatus
+  ---------------------------------------------------------------------------*/
+eHalStatus sme_ScanRegisterResultStreamCallback(tHalHandle hHal,
+                                                csrScanResultStreamCallback callback,
+                                                void *pContext);
+#endif
+
 /* ---------------------------------------------------------------------------
     \fn sme_ScanGetPMKIDCandidateList
     \brief a wrapper function to return the PMKID candidate list
@@ -13072,7 +13072,7 @@ eHalStatus csrRoamRemoveConnectedBssFromScanCache(tpAniSirGlobal pMac,
                 if(fMatch)
                 {
                     //We found the one
-                    if( csrLLRemoveEntry(&pMac->scan.scanResultList, pEntry, LL_ACCESS_NOLOCK) )
+                    if( csrScanRemoveResult(pMac, pResult, LL_ACCESS_NOLOCK) )
                     {
                         //Free the memory
                         csrFreeScanResultEntry( pMac, pResult );
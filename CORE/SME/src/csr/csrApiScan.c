@@ -88,6 +88,9 @@ static void csrSetDefaultScanTiming( tpAniSirGlobal pMac, tSirScanType scanType,
 #ifdef WLAN_AP_STA_CONCURRENCY
 static void csrStaApConcTimerHandler(void *);
 #endif
+#ifdef FEATURE_WLAN_SCAN_RESULT_STREAMING
+static void csrScanStreamTimerHandler(void *pv);
+#endif
 tANI_BOOLEAN csrIsSupportedChannel(tpAniSirGlobal pMac, tANI_U8 channelId);
 eHalStatus csrScanChannels( tpAniSirGlobal pMac, tSmeCmd *pCommand );
 void csrSetCfgValidChannelList( tpAniSirGlobal pMac, tANI_U8 *pChannelList, tANI_U8 NumChannels );
@@ -131,6 +134,11 @@ static void csrReleaseScanCmdPendingList(tpAniSirGlobal pMac)
 //pResult is invalid calling this function.
 void csrFreeScanResultEntry( tpAniSirGlobal pMac, tCsrScanResult *pResult )
 {
+    if( pResult->fIesCached )
+    {
+        pMac->scan.iesCache.numEntries--;
+        pMac->scan.iesCache.numBytes -= sizeof(tDot11fBeaconIEs);
+    }
     if( NULL != pResult->Result.pvIes )
     {
         vos_mem_free(pResult->Result.pvIes);
@@ -138,6 +146,170 @@ void csrFreeScanResultEntry( tpAniSirGlobal pMac, tCsrScanResult *pResult )
     vos_mem_free(pResult);
 }
 
+/*
+ * Parsed IE cache
+ *
+ * Most scanResultList entries are stored without their parsed IEs, so every
+ * filter or ranking pass used to unpack the whole beacon again. The first
+ * pass that needs them now leaves the parsed IEs in Result.pvIes, where all
+ * the existing users already look first and which they never free. The IEs
+ * go away with the entry; a BSS heard again replaces its entry instead of
+ * updating it, so a cached copy never outlives the frame it was parsed from.
+ * Memory is bounded by CSR_SCAN_IES_CACHE_MAX_BYTES, beyond that callers
+ * parse into a temporary buffer as before.
+ */
+#define CSR_SCAN_IES_CACHE_MAX_BYTES    ( 64 * sizeof(tDot11fBeaconIEs) )
+
+//Must be called with the scanResultList lock held
+static void csrScanCacheResultIes( tpAniSirGlobal pMac, tCsrScanResult *pResult )
+{
+    tCsrScanIesCache *pCache = &pMac->scan.iesCache;
+    tDot11fBeaconIEs *pIes;
+
+    if( NULL != pResult->Result.pvIes )
+    {
+        pCache->numHits++;
+        return;
+    }
+    pCache->numMisses++;
+    if( ( pCache->numBytes + sizeof(tDot11fBeaconIEs) ) > CSR_SCAN_IES_CACHE_MAX_BYTES )
+    {
+        pCache->numOverBudget++;
+        return;
+    }
+    if( HAL_STATUS_SUCCESS( csrGetParsedBssDescriptionIEs( pMac,
+                                 &pResult->Result.BssDescriptor, &pIes ) ) )
+    {
+        pResult->Result.pvIes = pIes;
+        pResult->fIesCached = eANI_BOOLEAN_TRUE;
+        pCache->numEntries++;
+        pCache->numBytes += sizeof(tDot11fBeaconIEs);
+    }
+}
+
+/*
+ * Scan result index
+ *
+ * Every entry of pMac->scan.scanResultList is also chained into three hash
+ * tables keyed by BSSID, SSID and channel, so csrScanGetResult only needs to
+ * run csrMatchBSS on the BSSs that can possibly match its filter. All of it
+ * is protected by the scanResultList lock, hence entries must only be taken
+ * off scanResultList through csrScanRemoveResult.
+ */
+#define CSR_SCAN_BSSID_BUCKET(bssId) \
+    ( csrScanHashBytes( (bssId), VOS_MAC_ADDR_SIZE ) & ( CSR_SCAN_BSSID_HASH_SIZE - 1 ) )
+#define CSR_SCAN_SSID_BUCKET(ssId, len) \
+    ( csrScanHashBytes( (ssId), (len) ) & ( CSR_SCAN_SSID_HASH_SIZE - 1 ) )
+#define CSR_SCAN_NO_SSID_BUCKET     CSR_SCAN_SSID_HASH_SIZE
+#define CSR_SCAN_CHAN_BUCKET(chan)  ( (chan) & ( CSR_SCAN_CHAN_HASH_SIZE - 1 ) )
+
+#define CSR_SCAN_INDEX_INSERT(ppHead, pResult, link)                        \
+    do {                                                                    \
+        (pResult)->link.pNext = *(ppHead);                                  \
+        if ( NULL != (pResult)->link.pNext )                                \
+            (pResult)->link.pNext->link.ppPrev = &(pResult)->link.pNext;    \
+        (pResult)->link.ppPrev = (ppHead);                                  \
+        *(ppHead) = (pResult);                                              \
+    } while (0)
+
+#define CSR_SCAN_INDEX_REMOVE(pResult, link)                                \
+    do {                                                                    \
+        if ( NULL != (pResult)->link.ppPrev )                               \
+        {                                                                   \
+            *(pResult)->link.ppPrev = (pResult)->link.pNext;                \
+            if ( NULL != (pResult)->link.pNext )                            \
+                (pResult)->link.pNext->link.ppPrev = (pResult)->link.ppPrev;\
+            (pResult)->link.pNext = NULL;                                   \
+            (pResult)->link.ppPrev = NULL;                                  \
+        }                                                                   \
+    } while (0)
+
+static tANI_U32 csrScanHashBytes( const tANI_U8 *pData, tANI_U32 len )
+{
+    tANI_U32 hash = 0;
+
+    while ( len-- )
+    {
+        hash = ( hash * 31 ) + *pData++;
+    }
+
+    return hash ^ ( hash >> 16 );
+}
+
+//Caller holds the scanResultList lock. pIes can not be NULL
+static void csrScanIndexAdd( tpAniSirGlobal pMac, tCsrScanResult *pResult,
+                             tDot11fBeaconIEs *pIes )
+{
+    tCsrScanIndex *pIndex = &pMac->scan.resultIndex;
+    tSirBssDescription *pBssDesc = &pResult->Result.BssDescriptor;
+    tANI_U32 bucket;
+
+    pResult->rankKey = CSR_SCAN_RANK_KEY( pResult->preferValue, pResult->capValue );
+    pResult->rankSeq = pIndex->nextSeq++;
+    pResult->queryGen = pIndex->queryGen;
+
+    bucket = CSR_SCAN_BSSID_BUCKET( pBssDesc->bssId );
+    CSR_SCAN_INDEX_INSERT( &pIndex->bssidHash[bucket], pResult, bssidLink );
+
+    if ( pIes->SSID.present )
+    {
+        bucket = CSR_SCAN_SSID_BUCKET( pIes->SSID.ssid, pIes->SSID.num_ssid );
+    }
+    else
+    {
+        bucket = CSR_SCAN_NO_SSID_BUCKET;
+    }
+    CSR_SCAN_INDEX_INSERT( &pIndex->ssidHash[bucket], pResult, ssidLink );
+
+    bucket = CSR_SCAN_CHAN_BUCKET( pBssDesc->channelId );
+    CSR_SCAN_INDEX_INSERT( &pIndex->chanHash[bucket], pResult, chanLink );
+}
+
+//Caller holds the scanResultList lock
+static void csrScanIndexRemove( tCsrScanResult *pResult )
+{
+    CSR_SCAN_INDEX_REMOVE( pResult, bssidLink );
+    CSR_SCAN_INDEX_REMOVE( pResult, ssidLink );
+    CSR_SCAN_INDEX_REMOVE( pResult, chanLink );
+}
+
+//Caller holds the scanResultList lock and has emptied the list
+static void csrScanIndexReset( tpAniSirGlobal pMac )
+{
+    tCsrScanIndex *pIndex = &pMac->scan.resultIndex;
+
+    vos_mem_set( pIndex->bssidHash, sizeof( pIndex->bssidHash ), 0 );
+    vos_mem_set( pIndex->ssidHash, sizeof( pIndex->ssidHash ), 0 );
+    vos_mem_set( pIndex->chanHash, sizeof( pIndex->chanHash ), 0 );
+}
+
+/*
+ * Take pResult off scanResultList and out of the index. Returns TRUE when it
+ * was removed, the caller then owns pResult and must free it.
+ */
+tANI_BOOLEAN csrScanRemoveResult( tpAniSirGlobal pMac, tCsrScanResult *pResult,
+                                  tANI_BOOLEAN fInterlocked )
+{
+    tANI_BOOLEAN fRemoved;
+
+    if ( fInterlocked )
+    {
+        csrLLLock( &pMac->scan.scanResultList );
+    }
+    fRemoved = csrLLRemoveEntry( &pMac->scan.scanResultList, &pResult->Link,
+                                 LL_ACCESS_NOLOCK );
+    if ( fRemoved )
+    {
+        csrScanIndexRemove( pResult );
+    }
+    if ( fInterlocked )
+    {
+        csrLLUnlock( &pMac->scan.scanResultList );
+    }
+
+    return fRemoved;
+}
+
 
 static eHalStatus csrLLScanPurgeResult(tpAniSirGlobal pMac, tDblLinkList *pList)
 {
@@ -152,6 +324,10 @@ static eHalStatus csrLLScanPurgeResult(tpAniSirGlobal pMac, tDblLinkList *pList)
         pBssDesc = GET_BASE_ADDR( pEntry, tCsrScanResult, Link );
         csrFreeScanResultEntry( pMac, pBssDesc );
     }
+    if ( pList == &pMac->scan.scanResultList )
+    {
+        csrScanIndexReset( pMac );
+    }
 
     csrLLUnlock(pList);
 
@@ -165,6 +341,8 @@ eHalStatus csrScanOpen( tpAniSirGlobal pMac )
     do
     {
         csrLLOpen(pMac->hHdd, &pMac->scan.scanResultList);
+        vos_mem_set(&pMac->scan.resultIndex, sizeof(tCsrScanIndex), 0);
+        vos_mem_set(&pMac->scan.iesCache, sizeof(tCsrScanIesCache), 0);
         csrLLOpen(pMac->hHdd, &pMac->scan.tempScanResults);
         csrLLOpen(pMac->hHdd, &pMac->scan.channelPowerInfoList24);
         csrLLOpen(pMac->hHdd, &pMac->scan.channelPowerInfoList5G);
@@ -206,6 +384,15 @@ eHalStatus csrScanOpen( tpAniSirGlobal pMac )
             smsLog(pMac, LOGE, FL("cannot allocate memory for CFG ResultAging timer"));
             break;
         }
+#ifdef FEATURE_WLAN_SCAN_RESULT_STREAMING
+        status = vos_timer_init(&pMac->scan.hTimerStream, VOS_TIMER_TYPE_SW,
+                                csrScanStreamTimerHandler, pMac);
+        if (!HAL_STATUS_SUCCESS(status))
+        {
+            smsLog(pMac, LOGE, FL("cannot allocate memory for scan stream timer"));
+            break;
+        }
+#endif
     }while(0);
 
     return (status);
@@ -214,6 +401,9 @@ eHalStatus csrScanOpen( tpAniSirGlobal pMac )
 
 eHalStatus csrScanClose( tpAniSirGlobal pMac )
 {
+#ifdef FEATURE_WLAN_SCAN_RESULT_STREAMING
+    csrScanStreamReset(pMac);
+#endif
     csrLLScanPurgeResult(pMac, &pMac->scan.tempScanResults);
     csrLLScanPurgeResult(pMac, &pMac->scan.scanResultList);
 #ifdef WLAN_AP_STA_CONCURRENCY
@@ -236,6 +426,9 @@ eHalStatus csrScanClose( tpAniSirGlobal pMac )
     vos_timer_destroy(&pMac->scan.hTimerStaApConcTimer);
 #endif
     vos_timer_destroy(&pMac->scan.hTimerIdleScan);
+#ifdef FEATURE_WLAN_SCAN_RESULT_STREAMING
+    vos_timer_destroy(&pMac->scan.hTimerStream);
+#endif
     return eHAL_STATUS_SUCCESS;
 }
 
@@ -2006,29 +2199,207 @@ static tANI_U32 csrGetBssCapValue(tpAniSirGlobal pMac, tSirBssDescription *pBssD
 //To check whther pBss1 is better than pBss2
 static tANI_BOOLEAN csrIsBetterBss(tCsrScanResult *pBss1, tCsrScanResult *pBss2)
 {
-    tANI_BOOLEAN ret;
+    if(pBss1->rankKey != pBss2->rankKey)
+    {
+        return (pBss1->rankKey > pBss2->rankKey);
+    }
+    //Equally ranked, the one that entered the scan cache first goes first
+    return (pBss1->rankSeq < pBss2->rankSeq);
+}
+
+static void csrScanSiftDownResults(tCsrScanResult **ppResults, tANI_U32 root, tANI_U32 num)
+{
+    tANI_U32 child;
+    tCsrScanResult *pTmp;
+
+    while((child = 2 * root + 1) < num)
+    {
+        //Max-heap on the worse BSS
+        if((child + 1 < num) && csrIsBetterBss(ppResults[child], ppResults[child + 1]))
+        {
+            child++;
+        }
+        if(!csrIsBetterBss(ppResults[root], ppResults[child]))
+        {
+            break;
+        }
+        pTmp = ppResults[root];
+        ppResults[root] = ppResults[child];
+        ppResults[child] = pTmp;
+        root = child;
+    }
+}
+
+//Heap sort ppResults so that the best BSS comes first
+static void csrScanSortResults(tCsrScanResult **ppResults, tANI_U32 num)
+{
+    tANI_U32 i;
+    tCsrScanResult *pTmp;
 
-    if(CSR_IS_BETTER_PREFER_VALUE(pBss1->preferValue, pBss2->preferValue))
+    if(num < 2)
     {
-        ret = eANI_BOOLEAN_TRUE;
+        return;
     }
-    else if(CSR_IS_EQUAL_PREFER_VALUE(pBss1->preferValue, pBss2->preferValue))
+    for(i = num / 2; i > 0; i--)
     {
-        if(CSR_IS_BETTER_CAP_VALUE(pBss1->capValue, pBss2->capValue))
+        csrScanSiftDownResults(ppResults, i - 1, num);
+    }
+    for(i = num - 1; i > 0; i--)
+    {
+        pTmp = ppResults[0];
+        ppResults[0] = ppResults[i];
+        ppResults[i] = pTmp;
+        csrScanSiftDownResults(ppResults, 0, i);
+    }
+}
+
+static tANI_BOOLEAN csrScanIndexBssidUsable(tpAniSirGlobal pMac, tCsrScanResultFilter *pFilter)
+{
+    tANI_U32 i;
+
+    //P2P filters may match on the device address instead of the BSSID
+    if(!pFilter->BSSIDs.numOfBSSIDs || pFilter->p2pResult)
+    {
+        return eANI_BOOLEAN_FALSE;
+    }
+    for(i = 0; i < pFilter->BSSIDs.numOfBSSIDs; i++)
+    {
+        if(csrIsMacAddressZero(pMac, &pFilter->BSSIDs.bssid[i]) ||
+           csrIsMacAddressBroadcast(pMac, &pFilter->BSSIDs.bssid[i]))
         {
-            ret = eANI_BOOLEAN_TRUE;
+            return eANI_BOOLEAN_FALSE;
         }
-        else
+    }
+    return eANI_BOOLEAN_TRUE;
+}
+
+static tANI_BOOLEAN csrScanIndexSsidUsable(tCsrScanResultFilter *pFilter)
+{
+    tANI_U32 i;
+
+    if(!pFilter->SSIDs.numOfSSIDs)
+    {
+        return eANI_BOOLEAN_FALSE;
+    }
+    for(i = 0; i < pFilter->SSIDs.numOfSSIDs; i++)
+    {
+        //A zero length SSID matches any BSS
+        if(0 == pFilter->SSIDs.SSIDList[i].SSID.length)
+        {
+            return eANI_BOOLEAN_FALSE;
+        }
+    }
+    return eANI_BOOLEAN_TRUE;
+}
+
+static tANI_BOOLEAN csrScanIndexChannelUsable(tCsrScanResultFilter *pFilter)
+{
+    tANI_U32 i;
+
+    if(!pFilter->ChannelInfo.numOfChannels)
+    {
+        return eANI_BOOLEAN_FALSE;
+    }
+    for(i = 0; i < pFilter->ChannelInfo.numOfChannels; i++)
+    {
+        if(eCSR_OPERATING_CHANNEL_ANY == pFilter->ChannelInfo.ChannelList[i])
+        {
+            return eANI_BOOLEAN_FALSE;
+        }
+    }
+    return eANI_BOOLEAN_TRUE;
+}
+
+#define CSR_SCAN_INDEX_TAKE(pIndex, pResult, ppCand, count)     \
+    do {                                                        \
+        if((pResult)->queryGen != (pIndex)->queryGen)           \
+        {                                                       \
+            (pResult)->queryGen = (pIndex)->queryGen;           \
+            (ppCand)[(count)++] = (pResult);                    \
+        }                                                       \
+    } while(0)
+
+/*
+ * Collect into ppCand the scanResultList entries that can possibly match
+ * pFilter, using the most selective index the filter allows, and fall back
+ * to the whole list otherwise. Candidates still have to go through
+ * csrMatchBSS. The caller holds the scanResultList lock and ppCand has room
+ * for every entry of the list.
+ */
+static tANI_U32 csrScanIndexCollect(tpAniSirGlobal pMac, tCsrScanResultFilter *pFilter,
+                                    tCsrScanResult **ppCand, tANI_BOOLEAN *pfIndexed)
+{
+    tCsrScanIndex *pIndex = &pMac->scan.resultIndex;
+    tCsrScanResult *pResult;
+    tListElem *pEntry;
+    tANI_U32 i, bucket, count = 0;
+    tANI_U8 *pId;
+    tANI_U8 len, channel;
+
+    pIndex->queryGen++;
+    *pfIndexed = eANI_BOOLEAN_TRUE;
+
+    if(pFilter && csrScanIndexBssidUsable(pMac, pFilter))
+    {
+        for(i = 0; i < pFilter->BSSIDs.numOfBSSIDs; i++)
+        {
+            pId = pFilter->BSSIDs.bssid[i];
+            bucket = CSR_SCAN_BSSID_BUCKET(pId);
+            for(pResult = pIndex->bssidHash[bucket]; pResult; pResult = pResult->bssidLink.pNext)
+            {
+                if(vos_mem_compare(pResult->Result.BssDescriptor.bssId, pId, VOS_MAC_ADDR_SIZE))
+                {
+                    CSR_SCAN_INDEX_TAKE(pIndex, pResult, ppCand, count);
+                }
+            }
+        }
+    }
+    else if(pFilter && csrScanIndexSsidUsable(pFilter))
+    {
+        for(i = 0; i < pFilter->SSIDs.numOfSSIDs; i++)
+        {
+            pId = pFilter->SSIDs.SSIDList[i].SSID.ssId;
+            len = pFilter->SSIDs.SSIDList[i].SSID.length;
+            bucket = CSR_SCAN_SSID_BUCKET(pId, len);
+            for(pResult = pIndex->ssidHash[bucket]; pResult; pResult = pResult->ssidLink.pNext)
+            {
+                CSR_SCAN_INDEX_TAKE(pIndex, pResult, ppCand, count);
+            }
+        }
+        //csrMatchBSS doesn't check the SSID of a BSS without the SSID IE
+        for(pResult = pIndex->ssidHash[CSR_SCAN_NO_SSID_BUCKET]; pResult;
+            pResult = pResult->ssidLink.pNext)
         {
-            ret = eANI_BOOLEAN_FALSE;
+            CSR_SCAN_INDEX_TAKE(pIndex, pResult, ppCand, count);
+        }
+    }
+    else if(pFilter && csrScanIndexChannelUsable(pFilter))
+    {
+        for(i = 0; i < pFilter->ChannelInfo.numOfChannels; i++)
+        {
+            channel = pFilter->ChannelInfo.ChannelList[i];
+            bucket = CSR_SCAN_CHAN_BUCKET(channel);
+            for(pResult = pIndex->chanHash[bucket]; pResult; pResult = pResult->chanLink.pNext)
+            {
+                if(pResult->Result.BssDescriptor.channelId == channel)
+                {
+                    CSR_SCAN_INDEX_TAKE(pIndex, pResult, ppCand, count);
+                }
+            }
         }
     }
     else
     {
-        ret = eANI_BOOLEAN_FALSE;
+        *pfIndexed = eANI_BOOLEAN_FALSE;
+        pEntry = csrLLPeekHead(&pMac->scan.scanResultList, LL_ACCESS_NOLOCK);
+        while(pEntry)
+        {
+            ppCand[count++] = GET_BASE_ADDR(pEntry, tCsrScanResult, Link);
+            pEntry = csrLLNext(&pMac->scan.scanResultList, pEntry, LL_ACCESS_NOLOCK);
+        }
     }
 
-    return (ret);
+    return count;
 }
 
 
@@ -2078,7 +2449,10 @@ static void csrScanAddResult(tpAniSirGlobal pMac, tCsrScanResult *pResult,
             csrGetBssPreferValue(pMac, (int)pResult->Result.BssDescriptor.rssi);
     pResult->capValue =
             csrGetBssCapValue(pMac, &pResult->Result.BssDescriptor, pIes);
-    csrLLInsertTail( &pMac->scan.scanResultList, &pResult->Link, LL_ACCESS_LOCK );
+    csrLLLock( &pMac->scan.scanResultList );
+    csrLLInsertTail( &pMac->scan.scanResultList, &pResult->Link, LL_ACCESS_NOLOCK );
+    csrScanIndexAdd( pMac, pResult, pIes );
+    csrLLUnlock( &pMac->scan.scanResultList );
 #ifdef FEATURE_WLAN_LFR
     if(0 == pNeighborRoamInfo->cfgParams.channelInfo.numOfChannels)
     {
@@ -2104,7 +2478,13 @@ eHalStatus csrScanGetResult(tpAniSirGlobal pMac, tCsrScanResultFilter *pFilter,
     eCsrAuthType auth = eCSR_AUTH_TYPE_OPEN_SYSTEM;
     tDot11fBeaconIEs *pIes, *pNewIes;
     tANI_BOOLEAN fMatch;
-    tANI_U16 i = 0;
+    tANI_U32 i = 0;
+    tANI_U32 numEntries = 0, numCand = 0;
+    tCsrScanResult **ppCand = NULL, **ppMatch = NULL;
+    tANI_BOOLEAN fIndexed = eANI_BOOLEAN_FALSE;
+    tCsrScanIndex *pIndex = &pMac->scan.resultIndex;
+    v_U64_t startUs = vos_timer_get_system_time_us();
+    tANI_U32 queryUs;
 
     if(phResult)
     {
@@ -2135,6 +2515,7 @@ eHalStatus csrScanGetResult(tpAniSirGlobal pMac, tCsrScanResultFilter *pFilter,
                                         pBssDesc->Result.ssId.length, eANI_BOOLEAN_TRUE );
                 if (fMatch)
                 {
+                    csrScanCacheResultIes(pMac, pBssDesc);
                     pIes = (tDot11fBeaconIEs *)( pBssDesc->Result.pvIes );
 
                     //At this time, pBssDescription->Result.pvIes may be NULL
@@ -2200,6 +2581,7 @@ eHalStatus csrScanGetResult(tpAniSirGlobal pMac, tCsrScanResultFilter *pFilter,
 
                 /* re-assign preference value based on modified rssi bucket */
                 pBssDesc->preferValue = csrGetBssPreferValue(pMac, (int)pBssDesc->Result.BssDescriptor.rssi);
+                pBssDesc->rankKey = CSR_SCAN_RANK_KEY(pBssDesc->preferValue, pBssDesc->capValue);
 
                 smsLog(pMac, LOG2, FL("BSSID("MAC_ADDRESS_STR
                        ") Rssi(%d) Chnl(%d) PrefVal(%u) SSID=%.*s"),
@@ -2227,10 +2609,29 @@ eHalStatus csrScanGetResult(tpAniSirGlobal pMac, tCsrScanResultFilter *pFilter,
         pRetList->pCurEntry = NULL;
 
         csrLLLock(&pMac->scan.scanResultList);
-        pEntry = csrLLPeekHead( &pMac->scan.scanResultList, LL_ACCESS_NOLOCK );
-        while( pEntry )
+        numEntries = csrLLCount(&pMac->scan.scanResultList);
+        if(numEntries)
         {
-            pBssDesc = GET_BASE_ADDR( pEntry, tCsrScanResult, Link );
+            //Candidates go to the first half, the matched copies to the second half
+            ppCand = vos_mem_malloc(2 * numEntries * sizeof(tCsrScanResult *));
+            if(NULL == ppCand)
+            {
+                smsLog(pMac, LOGE, FL("  fail to allocate memory for %d candidates"), numEntries);
+                status = eHAL_STATUS_FAILURE;
+            }
+            else
+            {
+                ppMatch = ppCand + numEntries;
+                numCand = csrScanIndexCollect(pMac, pFilter, ppCand, &fIndexed);
+            }
+        }
+        for(i = 0; (i < numCand) && HAL_STATUS_SUCCESS(status); i++)
+        {
+            pBssDesc = ppCand[i];
+            if(pFilter)
+            {
+                csrScanCacheResultIes(pMac, pBssDesc);
+            }
             pIes = (tDot11fBeaconIEs *)( pBssDesc->Result.pvIes );
             //if pBssDesc->Result.pvIes is NULL, we need to free any memory allocated by csrMatchBSS
             //for any error condition, otherwiase, it will be freed later.
@@ -2308,6 +2709,8 @@ eHalStatus csrScanGetResult(tpAniSirGlobal pMac, tCsrScanResultFilter *pFilter,
                 vos_mem_set(pResult, allocLen, 0);
                 pResult->capValue = pBssDesc->capValue;
                 pResult->preferValue = pBssDesc->preferValue;
+                pResult->rankKey = pBssDesc->rankKey;
+                pResult->rankSeq = pBssDesc->rankSeq;
                 pResult->ucEncryptionType = uc;
                 pResult->mcEncryptionType = mc;
                 pResult->authType = auth;
@@ -2318,43 +2721,41 @@ eHalStatus csrScanGetResult(tpAniSirGlobal pMac, tCsrScanResultFilter *pFilter,
                 //save bss description
                 vos_mem_copy(&pResult->Result.BssDescriptor,
                              &pBssDesc->Result.BssDescriptor, bssLen);
-                //No need to lock pRetList because it is locally allocated and no outside can access it at this time
-                if(csrLLIsListEmpty(&pRetList->List, LL_ACCESS_NOLOCK))
-                {
-                    csrLLInsertTail(&pRetList->List, &pResult->Link, LL_ACCESS_NOLOCK);
-                }
-                else
-                {
-                    //To sort the list
-                    tListElem *pTmpEntry;
-                    tCsrScanResult *pTmpResult;
-
-                    pTmpEntry = csrLLPeekHead(&pRetList->List, LL_ACCESS_NOLOCK);
-                    while(pTmpEntry)
-                    {
-                        pTmpResult = GET_BASE_ADDR( pTmpEntry, tCsrScanResult, Link );
-                        if(csrIsBetterBss(pResult, pTmpResult))
-                        {
-                            csrLLInsertEntry(&pRetList->List, pTmpEntry, &pResult->Link, LL_ACCESS_NOLOCK);
-                            //To indicate we are done
-                            pResult = NULL;
-                            break;
-                        }
-                        pTmpEntry = csrLLNext(&pRetList->List, pTmpEntry, LL_ACCESS_NOLOCK);
-                    }
-                    if(pResult != NULL)
-                    {
-                        //This one is not better than any one
-                        csrLLInsertTail(&pRetList->List, &pResult->Link, LL_ACCESS_NOLOCK);
-                    }
-                }
-                count++;
+                ppMatch[count++] = pResult;
             }
-            pEntry = csrLLNext( &pMac->scan.scanResultList, pEntry, LL_ACCESS_NOLOCK );
-        }//while
+        }//for
         csrLLUnlock(&pMac->scan.scanResultList);
 
-        smsLog(pMac, LOG2, FL("return %d BSS"), csrLLCount(&pRetList->List));
+        //No need to lock pRetList because it is locally allocated and no outside can access it at this time
+        csrScanSortResults(ppMatch, count);
+        for(i = 0; i < count; i++)
+        {
+            csrLLInsertTail(&pRetList->List, &ppMatch[i]->Link, LL_ACCESS_NOLOCK);
+        }
+        if(ppCand)
+        {
+            vos_mem_free(ppCand);
+        }
+
+        queryUs = (tANI_U32)(vos_timer_get_system_time_us() - startUs);
+        pIndex->numQueries++;
+        if(fIndexed)
+        {
+            pIndex->numIndexedQueries++;
+        }
+        pIndex->lastQueryUs = queryUs;
+        pIndex->totalQueryUs += queryUs;
+        if(queryUs > pIndex->maxQueryUs)
+        {
+            pIndex->maxQueryUs = queryUs;
+        }
+        smsLog(pMac, LOG2, FL("return %d BSS, %d of %d BSS checked (indexed %d) in %u us (max %u us)"),
+               csrLLCount(&pRetList->List), numCand, numEntries, fIndexed,
+               queryUs, pIndex->maxQueryUs);
+        smsLog(pMac, LOG2, FL("parsed IEs cached for %d BSS (%d bytes), hits %d misses %d over budget %d"),
+               pMac->scan.iesCache.numEntries, pMac->scan.iesCache.numBytes,
+               pMac->scan.iesCache.numHits, pMac->scan.iesCache.numMisses,
+               pMac->scan.iesCache.numOverBudget);
 
         if( !HAL_STATUS_SUCCESS(status) || (phResult == NULL) )
         {
@@ -2438,7 +2839,7 @@ eHalStatus csrScanFlushResult(tpAniSirGlobal pMac, tANI_U8 sessionId)
 eHalStatus csrScanFlushSelectiveResult(tpAniSirGlobal pMac, v_BOOL_t flushP2P)
 {
     eHalStatus status = eHAL_STATUS_SUCCESS;
-    tListElem *pEntry,*pFreeElem;
+    tListElem *pEntry;
     tCsrScanResult *pBssDesc;
     tDblLinkList *pList = &pMac->scan.scanResultList;
 
@@ -2451,9 +2852,8 @@ eHalStatus csrScanFlushSelectiveResult(tpAniSirGlobal pMac, v_BOOL_t flushP2P)
         if( flushP2P == vos_mem_compare( pBssDesc->Result.ssId.ssId,
                                          "DIRECT-", 7) )
         {
-            pFreeElem = pEntry;
             pEntry = csrLLNext(pList, pEntry, LL_ACCESS_NOLOCK);
-            csrLLRemoveEntry(pList, pFreeElem, LL_ACCESS_NOLOCK);
+            csrScanRemoveResult(pMac, pBssDesc, LL_ACCESS_NOLOCK);
             csrFreeScanResultEntry( pMac, pBssDesc );
             continue;
         }
@@ -2468,7 +2868,7 @@ eHalStatus csrScanFlushSelectiveResult(tpAniSirGlobal pMac, v_BOOL_t flushP2P)
 void csrScanFlushBssEntry(tpAniSirGlobal pMac,
                              tpSmeCsaOffloadInd pCsaOffloadInd)
 {
-    tListElem *pEntry,*pFreeElem;
+    tListElem *pEntry;
     tCsrScanResult *pBssDesc;
     tDblLinkList *pList = &pMac->scan.scanResultList;
 
@@ -2481,9 +2881,8 @@ void csrScanFlushBssEntry(tpAniSirGlobal pMac,
         if( vos_mem_compare(pBssDesc->Result.BssDescriptor.bssId,
                             pCsaOffloadInd->bssId, sizeof(tSirMacAddr)) )
         {
-            pFreeElem = pEntry;
             pEntry = csrLLNext(pList, pEntry, LL_ACCESS_NOLOCK);
-            csrLLRemoveEntry(pList, pFreeElem, LL_ACCESS_NOLOCK);
+            csrScanRemoveResult(pMac, pBssDesc, LL_ACCESS_NOLOCK);
             csrFreeScanResultEntry( pMac, pBssDesc );
             smsLog( pMac, LOG1, FL("Removed BSS entry:%pM"),
                     pCsaOffloadInd->bssId);
@@ -2580,8 +2979,7 @@ eHalStatus csrScanFilterResults(tpAniSirGlobal pMac)
                                               pMac->roam.validChannelList, len))
         {
             /* Remove Scan result which does not have 11d channel */
-            if( csrLLRemoveEntry( &pMac->scan.scanResultList, pEntry,
-                                                              LL_ACCESS_LOCK ))
+            if( csrScanRemoveResult( pMac, pBssDesc, LL_ACCESS_LOCK ) )
             {
                 csrFreeScanResultEntry( pMac, pBssDesc );
             }
@@ -2822,67 +3220,101 @@ void csrCheckNSaveWscIe(tpAniSirGlobal pMac, tSirBssDescription *pNewBssDescr, t
 
 
 
+/*
+ * Find the scanResultList entry that csrIsDuplicateBssDescription considers a
+ * duplicate of pSirBssDescr. Only the index buckets that can hold one are
+ * searched: a duplicate has the same BSSID, except for an IBSS which may also
+ * be reported by another BSSID on the same channel. Caller holds the
+ * scanResultList lock. pIes may be NULL
+ */
+static tCsrScanResult *csrScanFindDupResult( tpAniSirGlobal pMac, tSirBssDescription *pSirBssDescr,
+                                             tDot11fBeaconIEs *pIes, tANI_BOOLEAN fForced )
+{
+    tCsrScanIndex *pIndex = &pMac->scan.resultIndex;
+    tSirMacCapabilityInfo *pCap = (tSirMacCapabilityInfo *)&pSirBssDescr->capabilityInfo;
+    tCsrScanResult *pResult;
+    tANI_U32 bucket;
+
+    bucket = CSR_SCAN_BSSID_BUCKET( pSirBssDescr->bssId );
+    for( pResult = pIndex->bssidHash[bucket]; pResult; pResult = pResult->bssidLink.pNext )
+    {
+        if( vos_mem_compare( pResult->Result.BssDescriptor.bssId, pSirBssDescr->bssId,
+                             VOS_MAC_ADDR_SIZE ) &&
+            csrIsDuplicateBssDescription( pMac, &pResult->Result.BssDescriptor,
+                                          pSirBssDescr, pIes, fForced ) )
+        {
+            return pResult;
+        }
+    }
+
+    if( !pCap->ess )
+    {
+        bucket = CSR_SCAN_CHAN_BUCKET( pSirBssDescr->channelId );
+        for( pResult = pIndex->chanHash[bucket]; pResult; pResult = pResult->chanLink.pNext )
+        {
+            if( ( pResult->Result.BssDescriptor.channelId == pSirBssDescr->channelId ) &&
+                csrIsDuplicateBssDescription( pMac, &pResult->Result.BssDescriptor,
+                                              pSirBssDescr, pIes, fForced ) )
+            {
+                return pResult;
+            }
+        }
+    }
+
+    return NULL;
+}
+
 //pIes may be NULL
 tANI_BOOLEAN csrRemoveDupBssDescription( tpAniSirGlobal pMac, tSirBssDescription *pSirBssDescr,
                                          tDot11fBeaconIEs *pIes, tAniSSID *pSsid, v_TIME_t *timer, tANI_BOOLEAN fForced )
 {
-    tListElem *pEntry;
-
     tCsrScanResult *pBssDesc;
     tANI_BOOLEAN fRC = FALSE;
 
-    // Walk through all the chained BssDescriptions.  If we find a chained BssDescription that
-    // matches the BssID of the BssDescription passed in, then these must be duplicate scan
-    // results for this Bss.  In that case, remove the 'old' Bss description from the linked list.
-    pEntry = csrLLPeekHead( &pMac->scan.scanResultList, LL_ACCESS_LOCK );
+    // Look up the cached BssDescription that matches the BssID of the BssDescription passed in,
+    // this must be a duplicate scan result for this Bss.  In that case, remove the 'old' Bss
+    // description from the linked list.
+    csrLLLock( &pMac->scan.scanResultList );
 
-    while( pEntry )
+    // we have a duplicate scan results only when BSSID, SSID, Channel and NetworkType
+    // matches
+    pBssDesc = csrScanFindDupResult( pMac, pSirBssDescr, pIes, fForced );
+    if( NULL != pBssDesc )
     {
-        pBssDesc = GET_BASE_ADDR( pEntry, tCsrScanResult, Link );
+        int32_t rssi_new, rssi_old;
 
-        // we have a duplicate scan results only when BSSID, SSID, Channel and NetworkType
-        // matches
-        if ( csrIsDuplicateBssDescription( pMac, &pBssDesc->Result.BssDescriptor,
-                                                        pSirBssDescr, pIes, fForced ) )
-        {
-            int32_t rssi_new, rssi_old;
+        rssi_new = (int32_t) pSirBssDescr->rssi;
+        rssi_old = (int32_t) pBssDesc->Result.BssDescriptor.rssi;
+        rssi_new = ((rssi_new * CSR_SCAN_RESULT_RSSI_WEIGHT) +
+                     rssi_old * (100 - CSR_SCAN_RESULT_RSSI_WEIGHT)) / 100;
+        pSirBssDescr->rssi = (tANI_S8) rssi_new;
 
-            rssi_new = (int32_t) pSirBssDescr->rssi;
-            rssi_old = (int32_t) pBssDesc->Result.BssDescriptor.rssi;
-            rssi_new = ((rssi_new * CSR_SCAN_RESULT_RSSI_WEIGHT) +
-                         rssi_old * (100 - CSR_SCAN_RESULT_RSSI_WEIGHT)) / 100;
-            pSirBssDescr->rssi = (tANI_S8) rssi_new;
+        rssi_new = (int32_t) pSirBssDescr->rssi_raw;
+        rssi_old = (int32_t) pBssDesc->Result.BssDescriptor.rssi_raw;
+        rssi_new = ((rssi_new * CSR_SCAN_RESULT_RSSI_WEIGHT) +
+                     rssi_old * (100 - CSR_SCAN_RESULT_RSSI_WEIGHT)) / 100;
+        pSirBssDescr->rssi_raw = (tANI_S8) rssi_new;
 
-            rssi_new = (int32_t) pSirBssDescr->rssi_raw;
-            rssi_old = (int32_t) pBssDesc->Result.BssDescriptor.rssi_raw;
-            rssi_new = ((rssi_new * CSR_SCAN_RESULT_RSSI_WEIGHT) +
-                         rssi_old * (100 - CSR_SCAN_RESULT_RSSI_WEIGHT)) / 100;
-            pSirBssDescr->rssi_raw = (tANI_S8) rssi_new;
-
-            // Remove the 'old' entry from the list....
-            if( csrLLRemoveEntry( &pMac->scan.scanResultList, pEntry, LL_ACCESS_LOCK ) )
-            {
-                // !we need to free the memory associated with this node
-                //If failed to remove, assuming someone else got it.
-                *pSsid = pBssDesc->Result.ssId;
-                *timer = pBssDesc->Result.timer;
-                csrCheckNSaveWscIe(pMac, pSirBssDescr, &pBssDesc->Result.BssDescriptor);
-
-                csrFreeScanResultEntry( pMac, pBssDesc );
-            }
-            else
-            {
-                smsLog( pMac, LOGW, FL( "  fail to remove entry" ) );
-            }
-            fRC = TRUE;
+        // Remove the 'old' entry from the list....
+        if( csrScanRemoveResult( pMac, pBssDesc, LL_ACCESS_NOLOCK ) )
+        {
+            // !we need to free the memory associated with this node
+            //If failed to remove, assuming someone else got it.
+            *pSsid = pBssDesc->Result.ssId;
+            *timer = pBssDesc->Result.timer;
+            csrCheckNSaveWscIe(pMac, pSirBssDescr, &pBssDesc->Result.BssDescriptor);
 
-            // If we found a match, we can stop looking through the list.
-            break;
+            csrFreeScanResultEntry( pMac, pBssDesc );
         }
-
-        pEntry = csrLLNext( &pMac->scan.scanResultList, pEntry, LL_ACCESS_LOCK );
+        else
+        {
+            smsLog( pMac, LOGW, FL( "  fail to remove entry" ) );
+        }
+        fRC = TRUE;
     }
 
+    csrLLUnlock( &pMac->scan.scanResultList );
+
     return fRC;
 }
 
@@ -5209,6 +5641,180 @@ eHalStatus csrSavePnoScanResults(tpAniSirGlobal pMac, tSirSmeScanRsp *pScanRsp,
 }
 #endif
 
+#ifdef FEATURE_WLAN_SCAN_RESULT_STREAMING
+/*
+ * Scan result streaming
+ *
+ * During an offloaded scan PE reports every new BSS it hears with
+ * eWNI_SME_NEIGHBOR_BSS_IND. The BSS goes straight into the scan cache and a
+ * copy is queued for HDD, which gets the queued BSSs as one scan result list
+ * CSR_SCAN_STREAM_INTERVAL_MS after the first of them was queued (hTimerStream),
+ * or as soon as CSR_SCAN_STREAM_BATCH_MAX of them are waiting. Whatever is still queued when
+ * the scan completes is dropped, the scan done path reports the whole cache.
+ */
+#define CSR_SCAN_STREAM_INTERVAL_MS     100
+#define CSR_SCAN_STREAM_BATCH_MAX       16
+
+static void csrScanStreamFlush(tpAniSirGlobal pMac)
+{
+    tScanResultList *pBatch = (tScanResultList *)pMac->scan.pStreamBatch;
+
+    if(NULL == pBatch)
+    {
+        return;
+    }
+    pMac->scan.pStreamBatch = NULL;
+    vos_timer_stop(&pMac->scan.hTimerStream);
+
+    smsLog(pMac, LOG1, FL("stream %d BSS on session %d"),
+           csrLLCount(&pBatch->List), pMac->scan.streamSessionId);
+    pMac->scan.streamCallback(pMac->scan.pStreamContext,
+                              pMac->scan.streamSessionId,
+                              (tScanResultHandle)pBatch);
+}
+
+static void csrScanStreamTimerHandler(void *pv)
+{
+    tpAniSirGlobal pMac = PMAC_STRUCT( pv );
+
+    //Runs on the MC thread, outside of sme message processing
+    if(HAL_STATUS_SUCCESS(sme_AcquireGlobalLock(&pMac->sme)))
+    {
+        csrScanStreamFlush(pMac);
+        sme_ReleaseGlobalLock(&pMac->sme);
+    }
+}
+
+void csrScanStreamReset(tpAniSirGlobal pMac)
+{
+    vos_timer_stop(&pMac->scan.hTimerStream);
+    if(pMac->scan.pStreamBatch)
+    {
+        csrScanResultPurge(pMac, (tScanResultHandle)pMac->scan.pStreamBatch);
+        pMac->scan.pStreamBatch = NULL;
+    }
+}
+
+static void csrScanStreamQueue(tpAniSirGlobal pMac, tCsrScanResult *pResult,
+                               tANI_U8 sessionId)
+{
+    tScanResultList *pBatch;
+    tCsrScanResult *pCopy;
+    tANI_U32 bssLen, allocLen;
+
+    //A batch only carries the BSSs of one session
+    if(pMac->scan.pStreamBatch && (pMac->scan.streamSessionId != sessionId))
+    {
+        csrScanStreamFlush(pMac);
+    }
+
+    pBatch = (tScanResultList *)pMac->scan.pStreamBatch;
+    if(NULL == pBatch)
+    {
+        pBatch = vos_mem_malloc(sizeof(tScanResultList));
+        if(NULL == pBatch)
+        {
+            smsLog(pMac, LOGE, FL(" fail to allocate memory for stream list"));
+            return;
+        }
+        vos_mem_set(pBatch, sizeof(tScanResultList), 0);
+        csrLLOpen(pMac->hHdd, &pBatch->List);
+        pMac->scan.pStreamBatch = pBatch;
+        pMac->scan.streamSessionId = sessionId;
+        vos_timer_start(&pMac->scan.hTimerStream, CSR_SCAN_STREAM_INTERVAL_MS);
+    }
+
+    bssLen = pResult->Result.BssDescriptor.length +
+             sizeof(pResult->Result.BssDescriptor.length);
+    allocLen = sizeof(tCsrScanResult) + bssLen;
+    pCopy = vos_mem_malloc(allocLen);
+    if(NULL == pCopy)
+    {
+        smsLog(pMac, LOGE, FL(" fail to allocate memory for scan result, len=%d"), allocLen);
+        return;
+    }
+    vos_mem_set(pCopy, allocLen, 0);
+    pCopy->Result.ssId = pResult->Result.ssId;
+    pCopy->Result.timer = pResult->Result.timer;
+    vos_mem_copy(&pCopy->Result.BssDescriptor, &pResult->Result.BssDescriptor, bssLen);
+    csrLLInsertTail(&pBatch->List, &pCopy->Link, LL_ACCESS_NOLOCK);
+
+    if(csrLLCount(&pBatch->List) >= CSR_SCAN_STREAM_BATCH_MAX)
+    {
+        csrScanStreamFlush(pMac);
+    }
+}
+
+eHalStatus csrScanStreamNewBssInd(tpAniSirGlobal pMac, tSirSmeNeighborBssInd *pNewBssInd)
+{
+    tSirBssDescription *pSirBssDescription = pNewBssInd->bssDescription;
+    tCsrScanResult *pScanResult;
+    tDot11fBeaconIEs *pIes = NULL;
+    tAniSSID tmpSsid;
+    v_TIME_t timer = 0;
+    tANI_U32 cbBssDesc, len;
+
+    //Nobody listens, the BSS comes with the scan response anyway
+    if(NULL == pMac->scan.streamCallback)
+    {
+        return eHAL_STATUS_SUCCESS;
+    }
+
+    cbBssDesc = pSirBssDescription->length + sizeof(pSirBssDescription->length);
+    pScanResult = vos_mem_malloc(sizeof(tCsrScanResult) + cbBssDesc);
+    if(NULL == pScanResult)
+    {
+        smsLog(pMac, LOGE, FL(" Fail to allocate memory for frame"));
+        return eHAL_STATUS_RESOURCES;
+    }
+    vos_mem_set(pScanResult, sizeof(tCsrScanResult) + cbBssDesc, 0);
+    pScanResult->AgingCount = (tANI_S32)pMac->roam.configParam.agingCount;
+    vos_mem_copy(&pScanResult->Result.BssDescriptor, pSirBssDescription, cbBssDesc);
+
+    if(!HAL_STATUS_SUCCESS(csrGetParsedBssDescriptionIEs(pMac,
+                               &pScanResult->Result.BssDescriptor, &pIes)))
+    {
+        smsLog(pMac, LOGE, FL("  Cannot parse IEs"));
+        csrFreeScanResultEntry(pMac, pScanResult);
+        return eHAL_STATUS_RESOURCES;
+    }
+    if(pIes->SSID.present && !csrIsNULLSSID(pIes->SSID.ssid, pIes->SSID.num_ssid))
+    {
+        len = VOS_MIN(pIes->SSID.num_ssid, SIR_MAC_MAX_SSID_LENGTH);
+        pScanResult->Result.ssId.length = len;
+        pScanResult->Result.timer = vos_timer_get_system_time();
+        vos_mem_copy(pScanResult->Result.ssId.ssId, pIes->SSID.ssid, len);
+    }
+
+    tmpSsid.length = 0;
+    if(csrRemoveDupBssDescription(pMac, &pScanResult->Result.BssDescriptor,
+                                  pIes, &tmpSsid, &timer, FALSE))
+    {
+        //Keep the SSID of a hidden BSS, see csrMoveTempScanResultsToMainList
+        if((0 == pScanResult->Result.ssId.length) && tmpSsid.length &&
+           ((vos_timer_get_system_time() - timer) <= HIDDEN_TIMER))
+        {
+            pScanResult->Result.timer = timer;
+            pScanResult->Result.ssId = tmpSsid;
+        }
+    }
+    if(CSR_SCAN_IS_OVER_BSS_LIMIT(pMac))
+    {
+        smsLog(pMac, LOGW, FL("  BSS limit reached"));
+        vos_mem_free(pIes);
+        csrFreeScanResultEntry(pMac, pScanResult);
+        return eHAL_STATUS_RESOURCES;
+    }
+
+    csrScanAddResult(pMac, pScanResult, pIes, pNewBssInd->sessionId);
+    vos_mem_free(pIes);
+
+    csrScanStreamQueue(pMac, pScanResult, pNewBssInd->sessionId);
+
+    return eHAL_STATUS_SUCCESS;
+}
+#endif //FEATURE_WLAN_SCAN_RESULT_STREAMING
+
 eHalStatus csrScanSmeScanResponse( tpAniSirGlobal pMac, void *pMsgBuf )
 {
     eHalStatus status = eHAL_STATUS_SUCCESS;
@@ -5220,6 +5826,11 @@ eHalStatus csrScanSmeScanResponse( tpAniSirGlobal pMac, void *pMsgBuf )
     tANI_BOOLEAN fRemoveCommand = eANI_BOOLEAN_TRUE;
     eCsrScanReason reason = eCsrScanOther;
 
+#ifdef FEATURE_WLAN_SCAN_RESULT_STREAMING
+    //The scan done path reports every BSS, drop the ones not streamed yet
+    csrScanStreamReset(pMac);
+#endif
+
     if (pMac->fScanOffload)
         pEntry = csrLLPeekHead(&pMac->sme.smeScanCmdActiveList,
                                LL_ACCESS_LOCK);
@@ -5463,7 +6074,7 @@ tANI_BOOLEAN csrScanAgeOutBss(tpAniSirGlobal pMac, tCsrScanResult *pResult)
                MAC_ADDR_ARRAY(pResult->Result.BssDescriptor.bssId),
                pResult->Result.BssDescriptor.channelId);
         //No need to hold the spin lock because caller should hold the lock for pMac->scan.scanResultList
-        if( csrLLRemoveEntry(&pMac->scan.scanResultList, &pResult->Link, LL_ACCESS_NOLOCK) )
+        if( csrScanRemoveResult(pMac, pResult, LL_ACCESS_NOLOCK) )
         {
             if (csrIsMacAddressEqual(pMac,
                        (tCsrBssid *) pResult->Result.BssDescriptor.bssId,
@@ -5485,8 +6096,7 @@ tANI_BOOLEAN csrScanAgeOutBss(tpAniSirGlobal pMac, tCsrScanResult *pResult)
 eHalStatus csrScanAgeResults(tpAniSirGlobal pMac, tSmeGetScanChnRsp *pScanChnInfo)
 {
     eHalStatus status = eHAL_STATUS_SUCCESS;
-    tListElem *pEntry, *tmpEntry;
-    tCsrScanResult *pResult;
+    tCsrScanResult *pResult, *pNextResult;
     tLimScanChn *pChnInfo;
     tANI_U8 i;
 
@@ -5494,11 +6104,12 @@ eHalStatus csrScanAgeResults(tpAniSirGlobal pMac, tSmeGetScanChnRsp *pScanChnInf
     for(i = 0; i < pScanChnInfo->numChn; i++)
     {
         pChnInfo = &pScanChnInfo->scanChn[i];
-        pEntry = csrLLPeekHead( &pMac->scan.scanResultList, LL_ACCESS_NOLOCK );
-        while( pEntry )
+        //Only the BSSs of the channel's index bucket can be on this channel
+        pResult = pMac->scan.resultIndex.chanHash[CSR_SCAN_CHAN_BUCKET(pChnInfo->channelId)];
+        while( pResult )
         {
-            tmpEntry = csrLLNext(&pMac->scan.scanResultList, pEntry, LL_ACCESS_NOLOCK);
-            pResult = GET_BASE_ADDR( pEntry, tCsrScanResult, Link );
+            //csrScanAgeOutBss may unlink pResult from the bucket
+            pNextResult = pResult->chanLink.pNext;
             if(pResult->Result.BssDescriptor.channelId == pChnInfo->channelId)
             {
                 if(pResult->AgingCount <= 0)
@@ -5515,7 +6126,7 @@ eHalStatus csrScanAgeResults(tpAniSirGlobal pMac, tSmeGetScanChnRsp *pScanChnInf
                      MAC_ADDR_ARRAY(pResult->Result.BssDescriptor.bssId));
                 }
             }
-            pEntry = tmpEntry;
+            pResult = pNextResult;
         }
     }
     csrLLUnlock(&pMac->scan.scanResultList);
@@ -8528,6 +9139,7 @@ void csrInitOccupiedChannelsList(tpAniSirGlobal pMac, tANI_U8 sessionId)
   while( pEntry )
   {
       pBssDesc = GET_BASE_ADDR( pEntry, tCsrScanResult, Link );
+      csrScanCacheResultIes(pMac, pBssDesc);
       pIes = (tDot11fBeaconIEs *)( pBssDesc->Result.pvIes );
 
       //At this time, pBssDescription->Result.pvIes may be NULL
@@ -179,6 +179,19 @@ typedef struct tagCsrScanResult
     eCsrEncryptionType mcEncryptionType;
     eCsrAuthType authType; //Preferred auth type that matched with the profile.
 
+    //Ranking key built from preferValue and capValue, see CSR_SCAN_RANK_KEY
+    tANI_U64 rankKey;
+    //Insertion order into scanResultList, breaks ties between equal rankKey
+    tANI_U32 rankSeq;
+    //Last csrScanGetResult query that collected this entry as a candidate
+    tANI_U32 queryGen;
+    //Hash chains of pMac->scan.resultIndex, valid for scanResultList entries only
+    tCsrScanIndexLink bssidLink;
+    tCsrScanIndexLink ssidLink;
+    tCsrScanIndexLink chanLink;
+    //Result.pvIes was parsed on demand and is accounted in pMac->scan.iesCache
+    tANI_BOOLEAN fIesCached;
+
     tCsrScanResultInfo Result;
 }tCsrScanResult;
 
@@ -195,6 +208,8 @@ typedef struct
 #define CSR_IS_BETTER_PREFER_VALUE(v1, v2)   ((v1) > (v2))
 #define CSR_IS_EQUAL_PREFER_VALUE(v1, v2)   ((v1) == (v2))
 #define CSR_IS_BETTER_CAP_VALUE(v1, v2)     ((v1) > (v2))
+//preferValue overrides capValue, so it takes the upper half of the key
+#define CSR_SCAN_RANK_KEY(prefer, cap)      ( ((tANI_U64)(prefer) << 32) | (tANI_U32)(cap) )
 #define CSR_IS_ENC_TYPE_STATIC( encType ) ( ( eCSR_ENCRYPT_TYPE_NONE == (encType) ) || \
                                             ( eCSR_ENCRYPT_TYPE_WEP40_STATICKEY == (encType) ) || \
                                             ( eCSR_ENCRYPT_TYPE_WEP104_STATICKEY == (encType) ) )
@@ -230,6 +245,10 @@ tANI_BOOLEAN csrIsDuplicateBssDescription( tpAniSirGlobal pMac, tSirBssDescripti
 eHalStatus csrRoamSaveConnectedBssDesc( tpAniSirGlobal pMac, tANI_U32 sessionId, tSirBssDescription *pBssDesc );
 tANI_BOOLEAN csrIsNetworkTypeEqual( tSirBssDescription *pSirBssDesc1, tSirBssDescription *pSirBssDesc2 );
 eHalStatus csrScanSmeScanResponse( tpAniSirGlobal pMac, void *pMsgBuf );
+#ifdef FEATURE_WLAN_SCAN_RESULT_STREAMING
+eHalStatus csrScanStreamNewBssInd(tpAniSirGlobal pMac, tSirSmeNeighborBssInd *pNewBssInd);
+void csrScanStreamReset(tpAniSirGlobal pMac);
+#endif
 /*
    Prepare a filter base on a profile for parsing the scan results.
    Upon successful return, caller MUST call csrFreeScanFilter on
@@ -313,6 +332,8 @@ void csrApplyCountryInformation( tpAniSirGlobal pMac, tANI_BOOLEAN fForce );
 void csrSetCfgScanControlList( tpAniSirGlobal pMac, tANI_U8 *countryCode, tCsrChannel *pChannelList  );
 void csrReinitScanCmd(tpAniSirGlobal pMac, tSmeCmd *pCommand);
 void csrFreeScanResultEntry( tpAniSirGlobal pMac, tCsrScanResult *pResult );
+tANI_BOOLEAN csrScanRemoveResult( tpAniSirGlobal pMac, tCsrScanResult *pResult,
+                                  tANI_BOOLEAN fInterlocked );
 
 eHalStatus csrRoamCallCallback(tpAniSirGlobal pMac, tANI_U32 sessionId, tCsrRoamInfo *pRoamInfo,
                                tANI_U32 roamId, eRoamCmdStatus u1, eCsrRoamResult u2);
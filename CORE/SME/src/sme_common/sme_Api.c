@@ -2785,6 +2785,15 @@ eHalStatus sme_ProcessMsg(tHalHandle hHal, vos_msg_t* pMsg)
                    vos_mem_free(pMsg->bodyptr);
                }
                break;
+#ifdef FEATURE_WLAN_SCAN_RESULT_STREAMING
+          case eWNI_SME_NEIGHBOR_BSS_IND:
+               if (pMsg->bodyptr)
+               {
+                   csrScanStreamNewBssInd(pMac, pMsg->bodyptr);
+                   vos_mem_free(pMsg->bodyptr);
+               }
+               break;
+#endif
 #ifdef WLAN_FEATURE_NAN
           case eWNI_SME_NAN_EVENT:
                 if (pMsg->bodyptr)
@@ -3330,6 +3339,41 @@ eHalStatus sme_ScanResultPurge(tHalHandle hHal, tScanResultHandle hScanResult)
    return (status);
 }
 
+#ifdef FEATURE_WLAN_SCAN_RESULT_STREAMING
+/* ---------------------------------------------------------------------------
+    \fn sme_ScanRegisterResultStreamCallback
+    \brief a function to register the callback that receives the BSSs found
+           by an offloaded scan while the scan is still running
+    This is a synchronous call
+    \param callback - called on the MC thread with a scan result list which
+                      the callee must free with sme_ScanResultPurge. Pass NULL
+                      to stop streaming.
+    \param pContext - opaque context handed back to callback
+    \return eHalStatus
+  ---------------------------------------------------------------------------*/
+eHalStatus sme_ScanRegisterResultStreamCallback(tHalHandle hHal,
+                                                csrScanResultStreamCallback callback,
+                                                void *pContext)
+{
+   eHalStatus status;
+   tpAniSirGlobal pMac = PMAC_STRUCT( hHal );
+
+   status = sme_AcquireGlobalLock( &pMac->sme );
+   if ( HAL_STATUS_SUCCESS( status ) )
+   {
+       if ( NULL == callback )
+       {
+           csrScanStreamReset( pMac );
+       }
+       pMac->scan.streamCallback = callback;
+       pMac->scan.pStreamContext = pContext;
+       sme_ReleaseGlobalLock( &pMac->sme );
+   }
+
+   return (status);
+}
+#endif
+
 /* ---------------------------------------------------------------------------
     \fn sme_ScanGetPMKIDCandidateList
     \brief a wrapper function to return the PMKID candidate list
@@ -230,6 +230,9 @@ tSirRetStatus macOpen(tHalHandle *pHalHandle, tHddHandle hHdd, tMacOpenParameter
         }
 
         sysInitGlobals(p_mac);
+
+        /* Index the IE definitions used to unpack received frames */
+        dot11fInitIEIndexes();
     }
 
     /* Set the Powersave Offload Capability to TRUE irrespective of
@@ -87,6 +87,24 @@ typedef struct sIEDefn {
     tFRAMES_BOOL  fMandatory;
 } tIEDefn;
 
+/*
+ * EID-indexed view of a tIEDefn array, so that FindIEDefn doesn't walk
+ * every definition for every IE of a frame. first[] holds the 1-based
+ * position of the first definition for an EID (0 if there is none) and
+ * next[] chains the definitions sharing an EID in array order, so vendor
+ * IEs only compare the OUIs of the other vendor definitions.
+ * The indexes are built from their tIEDefn arrays by dot11fInitIEIndexes.
+ */
+#define DOT11F_IE_INDEX_MAX_DEFNS ( 64 )
+
+typedef struct sIEIndex {
+    tANI_U8 first[256];
+    tANI_U8 next[DOT11F_IE_INDEX_MAX_DEFNS];
+} tIEIndex;
+
+/* For frames without IEs; never built, so every lookup misses */
+static tIEIndex IEIDX_NONE;
+
 #if !defined(countof)
 #define countof(x) ( sizeof( (x) ) / sizeof( (x)[0] ) )
 #endif
@@ -444,25 +462,26 @@ static void frameshtonq(tpAniSirGlobal    pCtx,
 static const tIEDefn* FindIEDefn(tpAniSirGlobal pCtx,
                            tANI_U8 *pBuf,
                            tANI_U32 nBuf,
-                           const tIEDefn  IEs[])
+                           const tIEDefn  IEs[],
+                           const tIEIndex *pIeIdx)
 {
     const tIEDefn *pIe;
+    tANI_U8 idx;
 
     (void)pCtx;
 
-    pIe = &(IEs[0]);
-    while (0xff != pIe->eid)
+    idx = pIeIdx->first[*pBuf];
+    while (idx)
     {
-        if (*pBuf == pIe->eid)
-        {
-            if (0 == pIe->noui) return pIe;
+        pIe = &(IEs[idx - 1]);
+        if (0 == pIe->noui) return pIe;
 
-            if ( ( nBuf > (tANI_U32)(pIe->noui + 2) ) &&
-                 ( !DOT11F_MEMCMP(pCtx, pBuf + 2, pIe->oui, pIe->noui) ) )
-                return pIe;
-        }
+        if ( ( nBuf > (tANI_U32)(pIe->noui + 2) ) &&
+             ( pBuf[2] == pIe->oui[0] ) &&
+             ( !DOT11F_MEMCMP(pCtx, pBuf + 2, pIe->oui, pIe->noui) ) )
+            return pIe;
 
-        ++pIe;
+        idx = pIeIdx->next[idx - 1];
     }
 
     return NULL;
@@ -472,7 +491,8 @@ static tANI_U32 GetContainerIesLen(tpAniSirGlobal pCtx,
                              tANI_U8 *pBuf,
                              tANI_U32  nBuf,
                              tANI_U8 *pnConsumed,
-                             const tIEDefn  IEs[])
+                             const tIEDefn  IEs[],
+                             const tIEIndex *pIeIdx)
 {
     const tIEDefn *pIe, *pIeFirst;
     tANI_U8 *pBufRemaining = pBuf;
@@ -489,7 +509,7 @@ static tANI_U32 GetContainerIesLen(tpAniSirGlobal pCtx,
     len += 2;
     while ( len < nBuf )
     {
-        if( NULL == (pIe =  FindIEDefn(pCtx, pBufRemaining, nBuf + len, IEs)))
+        if( NULL == (pIe =  FindIEDefn(pCtx, pBufRemaining, nBuf + len, IEs, pIeIdx)))
              break;
         if( pIe->eid == pIeFirst->eid )
              break;
@@ -509,6 +529,7 @@ static tANI_U32 UnpackCore(tpAniSirGlobal pCtx,
                            tANI_U32 nBuf,
                            const tFFDefn  FFs[],
                            const tIEDefn  IEs[],
+                           const tIEIndex *pIeIdx,
                            tANI_U8 *pFrm,
                            size_t   nFrm);
 static tANI_U32 PackCore(tpAniSirGlobal pCtx,
@@ -2808,6 +2829,8 @@ tANI_U32 dot11fUnpackIeAID(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U8 ielen, tD
         {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
     };
 
+    static tIEIndex IEIDX_Airgo;
+
 tANI_U32 dot11fUnpackIeAirgo(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U8 ielen, tDot11fIEAirgo *pDst)
 {
     tANI_U32 status = DOT11F_PARSE_SUCCESS;
@@ -2820,6 +2843,7 @@ tANI_U32 dot11fUnpackIeAirgo(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U8 ielen,
                      ielen,
                      FFS_Airgo,
                      IES_Airgo,
+                     &IEIDX_Airgo,
                      ( tANI_U8* )pDst,
                      sizeof(*pDst));
     return status;
@@ -2900,6 +2924,8 @@ tANI_U32 dot11fUnpackIeChanSwitchAnn(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U8
         {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
     };
 
+    static tIEIndex IEIDX_ChannelSwitchWrapper;
+
 tANI_U32 dot11fUnpackIeChannelSwitchWrapper(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U8 ielen, tDot11fIEChannelSwitchWrapper *pDst)
 {
     tANI_U32 status = DOT11F_PARSE_SUCCESS;
@@ -2912,6 +2938,7 @@ tANI_U32 dot11fUnpackIeChannelSwitchWrapper(tpAniSirGlobal pCtx, tANI_U8 *pBuf,
                      ielen,
                      FFS_ChannelSwitchWrapper,
                      IES_ChannelSwitchWrapper,
+                     &IEIDX_ChannelSwitchWrapper,
                      ( tANI_U8* )pDst,
                      sizeof(*pDst));
     return status;
@@ -3312,6 +3339,8 @@ tANI_U32 dot11fUnpackIeFHPattTable(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U8 i
         {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
     };
 
+    static tIEIndex IEIDX_FTInfo;
+
 tANI_U32 dot11fUnpackIeFTInfo(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U8 ielen, tDot11fIEFTInfo *pDst)
 {
     tANI_U32 status = DOT11F_PARSE_SUCCESS;
@@ -3339,6 +3368,7 @@ tANI_U32 dot11fUnpackIeFTInfo(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U8 ielen,
                      ielen,
                      FFS_FTInfo,
                      IES_FTInfo,
+                     &IEIDX_FTInfo,
                      ( tANI_U8* )pDst,
                      sizeof(*pDst));
     return status;
@@ -3578,6 +3608,8 @@ static const tIEDefn IES_reportBeacon[ ] = {
 {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
 };
 
+static tIEIndex IEIDX_reportBeacon;
+
 tANI_U32 dot11fUnpackIeMeasurementReport(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U8 ielen, tDot11fIEMeasurementReport *pDst)
 {
     tANI_U32 status = DOT11F_PARSE_SUCCESS;
@@ -3715,6 +3747,7 @@ tANI_U32 dot11fUnpackIeMeasurementReport(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tAN
                      ielen,
                      FFS_reportBeacon,
                      IES_reportBeacon,
+                     &IEIDX_reportBeacon,
                      ( tANI_U8* )pDst,
                      sizeof(*pDst));
             break;
@@ -3740,6 +3773,8 @@ static const tIEDefn IES_measurement_requestBeacon[ ] = {
 {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
 };
 
+static tIEIndex IEIDX_measurement_requestBeacon;
+
 tANI_U32 dot11fUnpackIeMeasurementRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U8 ielen, tDot11fIEMeasurementRequest *pDst)
 {
     tANI_U32 status = DOT11F_PARSE_SUCCESS;
@@ -3821,6 +3856,7 @@ tANI_U32 dot11fUnpackIeMeasurementRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tA
                      ielen,
                      FFS_measurement_requestBeacon,
                      IES_measurement_requestBeacon,
+                     &IEIDX_measurement_requestBeacon,
                      ( tANI_U8* )pDst,
                      sizeof(*pDst));
         break;
@@ -3866,6 +3902,8 @@ tANI_U32 dot11fUnpackIeMobilityDomain(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U
         {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
     };
 
+    static tIEIndex IEIDX_NeighborReport;
+
 tANI_U32 dot11fUnpackIeNeighborReport(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U8 ielen, tDot11fIENeighborReport *pDst)
 {
     tANI_U32 status = DOT11F_PARSE_SUCCESS;
@@ -3912,6 +3950,7 @@ tANI_U32 dot11fUnpackIeNeighborReport(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U
                      ielen,
                      FFS_NeighborReport,
                      IES_NeighborReport,
+                     &IEIDX_NeighborReport,
                      ( tANI_U8* )pDst,
                      sizeof(*pDst));
     return status;
@@ -4591,6 +4630,8 @@ tANI_U32 dot11fUnpackIeRCPIIE(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U8 ielen,
         {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },
     };
 
+    static tIEIndex IEIDX_RICDataDesc;
+
 tANI_U32 dot11fUnpackIeRICDataDesc(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U8 ielen, tDot11fIERICDataDesc *pDst)
 {
     tANI_U32 status = DOT11F_PARSE_SUCCESS;
@@ -4603,6 +4644,7 @@ tANI_U32 dot11fUnpackIeRICDataDesc(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U8 i
                      ielen,
                      FFS_RICDataDesc,
                      IES_RICDataDesc,
+                     &IEIDX_RICDataDesc,
                      ( tANI_U8* )pDst,
                      sizeof(*pDst));
     return status;
@@ -5682,7 +5724,7 @@ tANI_U32 dot11fUnpackAddBAReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf,
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_AddBAReq, IES_AddBAReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_AddBAReq, IES_AddBAReq, &IEIDX_NONE, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -5730,7 +5772,7 @@ tANI_U32 dot11fUnpackAddBARsp(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf,
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_AddBARsp, IES_AddBARsp, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_AddBARsp, IES_AddBARsp, &IEIDX_NONE, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -5777,11 +5819,13 @@ tANI_U32 dot11fUnpackAddBARsp(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf,
         {offsetof(tDot11fAddTSRequest, ESETrafStrmRateSet), offsetof(tDot11fIEESETrafStrmRateSet, present), 0, "ESETrafStrmRateSet" , 0, 7, 15, SigIeESETrafStrmRateSet, {0, 64, 150, 8, 0}, 4, DOT11F_EID_ESETRAFSTRMRATESET, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_AddTSRequest;
+
 tANI_U32 dot11fUnpackAddTSRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fAddTSRequest *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_AddTSRequest, IES_AddTSRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_AddTSRequest, IES_AddTSRequest, &IEIDX_AddTSRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -6018,11 +6062,13 @@ tANI_U32 dot11fUnpackAddTSRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 n
         {offsetof(tDot11fAddTSResponse, ESETrafStrmMet), offsetof(tDot11fIEESETrafStrmMet, present), 0, "ESETrafStrmMet" , 0, 10, 10, SigIeESETrafStrmMet, {0, 64, 150, 7, 0}, 4, DOT11F_EID_ESETRAFSTRMMET, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_AddTSResponse;
+
 tANI_U32 dot11fUnpackAddTSResponse(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fAddTSResponse *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_AddTSResponse, IES_AddTSResponse, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_AddTSResponse, IES_AddTSResponse, &IEIDX_AddTSResponse, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -6324,11 +6370,13 @@ tANI_U32 dot11fUnpackAddTSResponse(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32
         {offsetof(tDot11fAssocRequest, QosMapSet), offsetof(tDot11fIEQosMapSet, present), 0, "QosMapSet" , 0, 2, 62, SigIeQosMapSet, {0, 0, 0, 0, 0}, 0, DOT11F_EID_QOSMAPSET, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_AssocRequest;
+
 tANI_U32 dot11fUnpackAssocRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fAssocRequest *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_AssocRequest, IES_AssocRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_AssocRequest, IES_AssocRequest, &IEIDX_AssocRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -6957,11 +7005,13 @@ tANI_U32 dot11fUnpackAssocRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 n
         {offsetof(tDot11fAssocResponse, QosMapSet), offsetof(tDot11fIEQosMapSet, present), 0, "QosMapSet" , 0, 2, 62, SigIeQosMapSet, {0, 0, 0, 0, 0}, 0, DOT11F_EID_QOSMAPSET, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_AssocResponse;
+
 tANI_U32 dot11fUnpackAssocResponse(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fAssocResponse *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_AssocResponse, IES_AssocResponse, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_AssocResponse, IES_AssocResponse, &IEIDX_AssocResponse, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -8081,11 +8131,13 @@ tANI_U32 dot11fUnpackAssocResponse(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32
         {offsetof(tDot11fAuthentication, RICDataDesc), offsetof(tDot11fIERICDataDesc, present), offsetof(tDot11fAuthentication, num_RICDataDesc), "RICDataDesc" , 2, 2, 550, SigIeRICDataDesc, {0, 0, 0, 0, 0}, 0, DOT11F_EID_RICDATADESC, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_Authentication;
+
 tANI_U32 dot11fUnpackAuthentication(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fAuthentication *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_Authentication, IES_Authentication, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_Authentication, IES_Authentication, &IEIDX_Authentication, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -8533,11 +8585,13 @@ tANI_U32 dot11fUnpackAuthentication(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32
         {offsetof(tDot11fBeacon, ESEVersion), offsetof(tDot11fIEESEVersion, present), 0, "ESEVersion" , 0, 7, 7, SigIeESEVersion, {0, 64, 150, 3, 0}, 4, DOT11F_EID_ESEVERSION, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_Beacon;
+
 tANI_U32 dot11fUnpackBeacon(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fBeacon *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_Beacon, IES_Beacon, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_Beacon, IES_Beacon, &IEIDX_Beacon, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -9653,11 +9707,13 @@ tANI_U32 dot11fUnpackBeacon(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, t
         {offsetof(tDot11fBeacon1, IBSSParams), offsetof(tDot11fIEIBSSParams, present), 0, "IBSSParams" , 0, 4, 4, SigIeIBSSParams, {0, 0, 0, 0, 0}, 0, DOT11F_EID_IBSSPARAMS, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_Beacon1;
+
 tANI_U32 dot11fUnpackBeacon1(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fBeacon1 *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_Beacon1, IES_Beacon1, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_Beacon1, IES_Beacon1, &IEIDX_Beacon1, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -9776,11 +9832,13 @@ tANI_U32 dot11fUnpackBeacon1(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf,
         {offsetof(tDot11fBeacon2, ESEVersion), offsetof(tDot11fIEESEVersion, present), 0, "ESEVersion" , 0, 7, 7, SigIeESEVersion, {0, 64, 150, 3, 0}, 4, DOT11F_EID_ESEVERSION, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_Beacon2;
+
 tANI_U32 dot11fUnpackBeacon2(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fBeacon2 *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_Beacon2, IES_Beacon2, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_Beacon2, IES_Beacon2, &IEIDX_Beacon2, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -10786,11 +10844,13 @@ tANI_U32 dot11fUnpackBeacon2(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf,
         {offsetof(tDot11fBeaconIEs, ChannelSwitchWrapper), offsetof(tDot11fIEChannelSwitchWrapper, present), 0, "ChannelSwitchWrapper" , 0, 2, 7, SigIeChannelSwitchWrapper, {0, 0, 0, 0, 0}, 0, DOT11F_EID_CHANNELSWITCHWRAPPER, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_BeaconIEs;
+
 tANI_U32 dot11fUnpackBeaconIEs(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fBeaconIEs *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_BeaconIEs, IES_BeaconIEs, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_BeaconIEs, IES_BeaconIEs, &IEIDX_BeaconIEs, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -12003,11 +12063,13 @@ tANI_U32 dot11fUnpackBeaconIEs(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf
         {offsetof(tDot11fChannelSwitch, WiderBWChanSwitchAnn), offsetof(tDot11fIEWiderBWChanSwitchAnn, present), 0, "WiderBWChanSwitchAnn" , 0, 5, 5, SigIeWiderBWChanSwitchAnn, {0, 0, 0, 0, 0}, 0, DOT11F_EID_WIDERBWCHANSWITCHANN, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_ChannelSwitch;
+
 tANI_U32 dot11fUnpackChannelSwitch(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fChannelSwitch *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_ChannelSwitch, IES_ChannelSwitch, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_ChannelSwitch, IES_ChannelSwitch, &IEIDX_ChannelSwitch, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -12066,11 +12128,13 @@ tANI_U32 dot11fUnpackChannelSwitch(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32
         {offsetof(tDot11fDeAuth, P2PDeAuth), offsetof(tDot11fIEP2PDeAuth, present), 0, "P2PDeAuth" , 0, 6, 10, SigIeP2PDeAuth, {80, 111, 154, 9, 0}, 4, DOT11F_EID_P2PDEAUTH, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_DeAuth;
+
 tANI_U32 dot11fUnpackDeAuth(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fDeAuth *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_DeAuth, IES_DeAuth, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_DeAuth, IES_DeAuth, &IEIDX_DeAuth, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -12119,7 +12183,7 @@ tANI_U32 dot11fUnpackDelBAInd(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf,
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_DelBAInd, IES_DelBAInd, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_DelBAInd, IES_DelBAInd, &IEIDX_NONE, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -12159,7 +12223,7 @@ tANI_U32 dot11fUnpackDelTS(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tD
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_DelTS, IES_DelTS, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_DelTS, IES_DelTS, &IEIDX_NONE, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -12204,11 +12268,13 @@ tANI_U32 dot11fUnpackDelTS(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tD
         {offsetof(tDot11fDeviceDiscoverabilityReq, P2PDeviceDiscoverabilityReq), offsetof(tDot11fIEP2PDeviceDiscoverabilityReq, present), 0, "P2PDeviceDiscoverabilityReq" , 0, 6, 56, SigIeP2PDeviceDiscoverabilityReq, {80, 111, 154, 9, 0}, 4, DOT11F_EID_P2PDEVICEDISCOVERABILITYREQ, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_DeviceDiscoverabilityReq;
+
 tANI_U32 dot11fUnpackDeviceDiscoverabilityReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fDeviceDiscoverabilityReq *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_DeviceDiscoverabilityReq, IES_DeviceDiscoverabilityReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_DeviceDiscoverabilityReq, IES_DeviceDiscoverabilityReq, &IEIDX_DeviceDiscoverabilityReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -12274,11 +12340,13 @@ tANI_U32 dot11fUnpackDeviceDiscoverabilityReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf
         {offsetof(tDot11fDeviceDiscoverabilityRes, P2PDeviceDiscoverabilityRes), offsetof(tDot11fIEP2PDeviceDiscoverabilityRes, present), 0, "P2PDeviceDiscoverabilityRes" , 0, 6, 10, SigIeP2PDeviceDiscoverabilityRes, {80, 111, 154, 9, 0}, 4, DOT11F_EID_P2PDEVICEDISCOVERABILITYRES, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_DeviceDiscoverabilityRes;
+
 tANI_U32 dot11fUnpackDeviceDiscoverabilityRes(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fDeviceDiscoverabilityRes *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_DeviceDiscoverabilityRes, IES_DeviceDiscoverabilityRes, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_DeviceDiscoverabilityRes, IES_DeviceDiscoverabilityRes, &IEIDX_DeviceDiscoverabilityRes, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -12329,11 +12397,13 @@ tANI_U32 dot11fUnpackDeviceDiscoverabilityRes(tpAniSirGlobal pCtx, tANI_U8 *pBuf
         {offsetof(tDot11fDisassociation, P2PDisAssoc), offsetof(tDot11fIEP2PDisAssoc, present), 0, "P2PDisAssoc" , 0, 6, 10, SigIeP2PDisAssoc, {80, 111, 154, 9, 0}, 4, DOT11F_EID_P2PDISASSOC, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_Disassociation;
+
 tANI_U32 dot11fUnpackDisassociation(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fDisassociation *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_Disassociation, IES_Disassociation, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_Disassociation, IES_Disassociation, &IEIDX_Disassociation, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -12382,7 +12452,7 @@ tANI_U32 dot11fUnpackGODiscoverabilityReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tA
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_GODiscoverabilityReq, IES_GODiscoverabilityReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_GODiscoverabilityReq, IES_GODiscoverabilityReq, &IEIDX_NONE, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -12418,11 +12488,13 @@ tANI_U32 dot11fUnpackGODiscoverabilityReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tA
         {offsetof(tDot11fGONegCnf, P2PGONegCnf), offsetof(tDot11fIEP2PGONegCnf, present), 0, "P2PGONegCnf" , 0, 6, 321, SigIeP2PGONegCnf, {80, 111, 154, 9, 0}, 4, DOT11F_EID_P2PGONEGCNF, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_GONegCnf;
+
 tANI_U32 dot11fUnpackGONegCnf(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fGONegCnf *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_GONegCnf, IES_GONegCnf, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_GONegCnf, IES_GONegCnf, &IEIDX_GONegCnf, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -12521,11 +12593,13 @@ tANI_U32 dot11fUnpackGONegCnf(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf,
         {offsetof(tDot11fGONegReq, P2PGONegReq), offsetof(tDot11fIEP2PGONegReq, present), 0, "P2PGONegReq" , 0, 6, 364, SigIeP2PGONegReq, {80, 111, 154, 9, 0}, 4, DOT11F_EID_P2PGONEGREQ, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_GONegReq;
+
 tANI_U32 dot11fUnpackGONegReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fGONegReq *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_GONegReq, IES_GONegReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_GONegReq, IES_GONegReq, &IEIDX_GONegReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -12701,11 +12775,13 @@ tANI_U32 dot11fUnpackGONegReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf,
         {offsetof(tDot11fGONegRes, P2PGONegRes), offsetof(tDot11fIEP2PGONegRes, present), 0, "P2PGONegRes" , 0, 6, 394, SigIeP2PGONegRes, {80, 111, 154, 9, 0}, 4, DOT11F_EID_P2PGONEGRES, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_GONegRes;
+
 tANI_U32 dot11fUnpackGONegRes(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fGONegRes *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_GONegRes, IES_GONegRes, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_GONegRes, IES_GONegRes, &IEIDX_GONegRes, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -12877,11 +12953,13 @@ tANI_U32 dot11fUnpackGONegRes(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf,
         {offsetof(tDot11fHT2040BSSCoexistenceManagementActionFrame, HT2040BSSIntolerantReport), offsetof(tDot11fIEHT2040BSSIntolerantReport, present), 0, "HT2040BSSIntolerantReport" , 0, 3, 53, SigIeHT2040BSSIntolerantReport, {0, 0, 0, 0, 0}, 0, DOT11F_EID_HT2040BSSINTOLERANTREPORT, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_HT2040BSSCoexistenceManagementActionFrame;
+
 tANI_U32 dot11fUnpackHT2040BSSCoexistenceManagementActionFrame(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fHT2040BSSCoexistenceManagementActionFrame *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_HT2040BSSCoexistenceManagementActionFrame, IES_HT2040BSSCoexistenceManagementActionFrame, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_HT2040BSSCoexistenceManagementActionFrame, IES_HT2040BSSCoexistenceManagementActionFrame, &IEIDX_HT2040BSSCoexistenceManagementActionFrame, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -12938,11 +13016,13 @@ tANI_U32 dot11fUnpackHT2040BSSCoexistenceManagementActionFrame(tpAniSirGlobal pC
         {offsetof(tDot11fInvitationReq, P2PInvitationReq), offsetof(tDot11fIEP2PInvitationReq, present), 0, "P2PInvitationReq" , 0, 6, 385, SigIeP2PInvitationReq, {80, 111, 154, 9, 0}, 4, DOT11F_EID_P2PINVITATIONREQ, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_InvitationReq;
+
 tANI_U32 dot11fUnpackInvitationReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fInvitationReq *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_InvitationReq, IES_InvitationReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_InvitationReq, IES_InvitationReq, &IEIDX_InvitationReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -13070,11 +13150,13 @@ tANI_U32 dot11fUnpackInvitationReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32
         {offsetof(tDot11fInvitationRes, P2PInvitationRes), offsetof(tDot11fIEP2PInvitationRes, present), 0, "P2PInvitationRes" , 0, 6, 289, SigIeP2PInvitationRes, {80, 111, 154, 9, 0}, 4, DOT11F_EID_P2PINVITATIONRES, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_InvitationRes;
+
 tANI_U32 dot11fUnpackInvitationRes(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fInvitationRes *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_InvitationRes, IES_InvitationRes, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_InvitationRes, IES_InvitationRes, &IEIDX_InvitationRes, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -13179,7 +13261,7 @@ tANI_U32 dot11fUnpackLinkMeasurementReport(tpAniSirGlobal pCtx, tANI_U8 *pBuf, t
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_LinkMeasurementReport, IES_LinkMeasurementReport, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_LinkMeasurementReport, IES_LinkMeasurementReport, &IEIDX_NONE, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -13232,7 +13314,7 @@ tANI_U32 dot11fUnpackLinkMeasurementRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf,
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_LinkMeasurementRequest, IES_LinkMeasurementRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_LinkMeasurementRequest, IES_LinkMeasurementRequest, &IEIDX_NONE, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -13268,11 +13350,13 @@ tANI_U32 dot11fUnpackLinkMeasurementRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf,
         {offsetof(tDot11fMeasurementReport, MeasurementReport), offsetof(tDot11fIEMeasurementReport, present), 0, "MeasurementReport" , 0, 5, 31, SigIeMeasurementReport, {0, 0, 0, 0, 0}, 0, DOT11F_EID_MEASUREMENTREPORT, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_MeasurementReport;
+
 tANI_U32 dot11fUnpackMeasurementReport(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fMeasurementReport *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_MeasurementReport, IES_MeasurementReport, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_MeasurementReport, IES_MeasurementReport, &IEIDX_MeasurementReport, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -13364,11 +13448,13 @@ tANI_U32 dot11fUnpackMeasurementReport(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_
         {offsetof(tDot11fMeasurementRequest, MeasurementRequest), offsetof(tDot11fIEMeasurementRequest, present), offsetof(tDot11fMeasurementRequest, num_MeasurementRequest), "MeasurementRequest" , 4, 16, 18, SigIeMeasurementRequest, {0, 0, 0, 0, 0}, 0, DOT11F_EID_MEASUREMENTREQUEST, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_MeasurementRequest;
+
 tANI_U32 dot11fUnpackMeasurementRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fMeasurementRequest *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_MeasurementRequest, IES_MeasurementRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_MeasurementRequest, IES_MeasurementRequest, &IEIDX_MeasurementRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -13445,11 +13531,13 @@ tANI_U32 dot11fUnpackMeasurementRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI
         {offsetof(tDot11fNeighborReportRequest, SSID), offsetof(tDot11fIESSID, present), 0, "SSID" , 0, 2, 34, SigIeSSID, {0, 0, 0, 0, 0}, 0, DOT11F_EID_SSID, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_NeighborReportRequest;
+
 tANI_U32 dot11fUnpackNeighborReportRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fNeighborReportRequest *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_NeighborReportRequest, IES_NeighborReportRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_NeighborReportRequest, IES_NeighborReportRequest, &IEIDX_NeighborReportRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -13491,11 +13579,13 @@ tANI_U32 dot11fUnpackNeighborReportRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, t
         {offsetof(tDot11fNeighborReportResponse, NeighborReport), offsetof(tDot11fIENeighborReport, present), offsetof(tDot11fNeighborReportResponse, num_NeighborReport), "NeighborReport" , 15, 15, 548, SigIeNeighborReport, {0, 0, 0, 0, 0}, 0, DOT11F_EID_NEIGHBORREPORT, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_NeighborReportResponse;
+
 tANI_U32 dot11fUnpackNeighborReportResponse(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fNeighborReportResponse *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_NeighborReportResponse, IES_NeighborReportResponse, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_NeighborReportResponse, IES_NeighborReportResponse, &IEIDX_NeighborReportResponse, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -13633,11 +13723,13 @@ tANI_U32 dot11fUnpackNeighborReportResponse(tpAniSirGlobal pCtx, tANI_U8 *pBuf,
         {offsetof(tDot11fNoticeOfAbs, P2PNoticeOfAbsence), offsetof(tDot11fIEP2PNoticeOfAbsence, present), 0, "P2PNoticeOfAbsence" , 0, 6, 47, SigIeP2PNoticeOfAbsence, {80, 111, 154, 9, 0}, 4, DOT11F_EID_P2PNOTICEOFABSENCE, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_NoticeOfAbs;
+
 tANI_U32 dot11fUnpackNoticeOfAbs(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fNoticeOfAbs *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_NoticeOfAbs, IES_NoticeOfAbs, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_NoticeOfAbs, IES_NoticeOfAbs, &IEIDX_NoticeOfAbs, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -13694,7 +13786,7 @@ tANI_U32 dot11fUnpackOperatingMode(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_OperatingMode, IES_OperatingMode, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_OperatingMode, IES_OperatingMode, &IEIDX_NONE, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -13730,11 +13822,13 @@ tANI_U32 dot11fUnpackOperatingMode(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32
         {offsetof(tDot11fPresenceReq, P2PNoticeOfAbsence), offsetof(tDot11fIEP2PNoticeOfAbsence, present), 0, "P2PNoticeOfAbsence" , 0, 6, 47, SigIeP2PNoticeOfAbsence, {80, 111, 154, 9, 0}, 4, DOT11F_EID_P2PNOTICEOFABSENCE, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_PresenceReq;
+
 tANI_U32 dot11fUnpackPresenceReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fPresenceReq *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_PresenceReq, IES_PresenceReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_PresenceReq, IES_PresenceReq, &IEIDX_PresenceReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -13789,11 +13883,13 @@ tANI_U32 dot11fUnpackPresenceReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nB
         {offsetof(tDot11fPresenceRes, P2PPresenceResponse), offsetof(tDot11fIEP2PPresenceResponse, present), 0, "P2PPresenceResponse" , 0, 6, 51, SigIeP2PPresenceResponse, {80, 111, 154, 9, 0}, 4, DOT11F_EID_P2PPRESENCERESPONSE, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_PresenceRes;
+
 tANI_U32 dot11fUnpackPresenceRes(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fPresenceRes *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_PresenceRes, IES_PresenceRes, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_PresenceRes, IES_PresenceRes, &IEIDX_PresenceRes, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -13862,11 +13958,13 @@ tANI_U32 dot11fUnpackPresenceRes(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nB
         {offsetof(tDot11fProbeRequest, VHTCaps), offsetof(tDot11fIEVHTCaps, present), 0, "VHTCaps" , 0, 14, 14, SigIeVHTCaps, {0, 0, 0, 0, 0}, 0, DOT11F_EID_VHTCAPS, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_ProbeRequest;
+
 tANI_U32 dot11fUnpackProbeRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fProbeRequest *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_ProbeRequest, IES_ProbeRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_ProbeRequest, IES_ProbeRequest, &IEIDX_ProbeRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -14325,11 +14423,13 @@ tANI_U32 dot11fUnpackProbeRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 n
         {offsetof(tDot11fProbeResponse, ESEVersion), offsetof(tDot11fIEESEVersion, present), 0, "ESEVersion" , 0, 7, 7, SigIeESEVersion, {0, 64, 150, 3, 0}, 4, DOT11F_EID_ESEVERSION, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_ProbeResponse;
+
 tANI_U32 dot11fUnpackProbeResponse(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fProbeResponse *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_ProbeResponse, IES_ProbeResponse, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_ProbeResponse, IES_ProbeResponse, &IEIDX_ProbeResponse, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -15498,11 +15598,13 @@ tANI_U32 dot11fUnpackProbeResponse(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32
         {offsetof(tDot11fProvisionDiscoveryReq, P2PProvisionDiscoveryReq), offsetof(tDot11fIEP2PProvisionDiscoveryReq, present), 0, "P2PProvisionDiscoveryReq" , 0, 6, 107, SigIeP2PProvisionDiscoveryReq, {80, 111, 154, 9, 0}, 4, DOT11F_EID_P2PPROVISIONDISCOVERYREQ, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_ProvisionDiscoveryReq;
+
 tANI_U32 dot11fUnpackProvisionDiscoveryReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fProvisionDiscoveryReq *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_ProvisionDiscoveryReq, IES_ProvisionDiscoveryReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_ProvisionDiscoveryReq, IES_ProvisionDiscoveryReq, &IEIDX_ProvisionDiscoveryReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -15590,11 +15692,13 @@ tANI_U32 dot11fUnpackProvisionDiscoveryReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, t
         {offsetof(tDot11fProvisionDiscoveryRes, P2PWSCProvisionDiscoveryRes), offsetof(tDot11fIEP2PWSCProvisionDiscoveryRes, present), 0, "P2PWSCProvisionDiscoveryRes" , 0, 6, 12, SigIeP2PWSCProvisionDiscoveryRes, {0, 80, 242, 4, 0}, 4, DOT11F_EID_P2PWSCPROVISIONDISCOVERYRES, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_ProvisionDiscoveryRes;
+
 tANI_U32 dot11fUnpackProvisionDiscoveryRes(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fProvisionDiscoveryRes *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_ProvisionDiscoveryRes, IES_ProvisionDiscoveryRes, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_ProvisionDiscoveryRes, IES_ProvisionDiscoveryRes, &IEIDX_ProvisionDiscoveryRes, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -15646,11 +15750,13 @@ tANI_U32 dot11fUnpackProvisionDiscoveryRes(tpAniSirGlobal pCtx, tANI_U8 *pBuf, t
         {offsetof(tDot11fQosMapConfigure, QosMapSet), offsetof(tDot11fIEQosMapSet, present), 0, "QosMapSet" , 0, 2, 62, SigIeQosMapSet, {0, 0, 0, 0, 0}, 0, DOT11F_EID_QOSMAPSET, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_QosMapConfigure;
+
 tANI_U32 dot11fUnpackQosMapConfigure(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fQosMapConfigure *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_QosMapConfigure, IES_QosMapConfigure, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_QosMapConfigure, IES_QosMapConfigure, &IEIDX_QosMapConfigure, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -15690,11 +15796,13 @@ tANI_U32 dot11fUnpackQosMapConfigure(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U3
         {offsetof(tDot11fRadioMeasurementReport, MeasurementReport), offsetof(tDot11fIEMeasurementReport, present), offsetof(tDot11fRadioMeasurementReport, num_MeasurementReport), "MeasurementReport" , 4, 5, 31, SigIeMeasurementReport, {0, 0, 0, 0, 0}, 0, DOT11F_EID_MEASUREMENTREPORT, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_RadioMeasurementReport;
+
 tANI_U32 dot11fUnpackRadioMeasurementReport(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fRadioMeasurementReport *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_RadioMeasurementReport, IES_RadioMeasurementReport, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_RadioMeasurementReport, IES_RadioMeasurementReport, &IEIDX_RadioMeasurementReport, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -15790,11 +15898,13 @@ tANI_U32 dot11fUnpackRadioMeasurementReport(tpAniSirGlobal pCtx, tANI_U8 *pBuf,
         {offsetof(tDot11fRadioMeasurementRequest, MeasurementRequest), offsetof(tDot11fIEMeasurementRequest, present), offsetof(tDot11fRadioMeasurementRequest, num_MeasurementRequest), "MeasurementRequest" , 2, 16, 18, SigIeMeasurementRequest, {0, 0, 0, 0, 0}, 0, DOT11F_EID_MEASUREMENTREQUEST, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_RadioMeasurementRequest;
+
 tANI_U32 dot11fUnpackRadioMeasurementRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fRadioMeasurementRequest *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_RadioMeasurementRequest, IES_RadioMeasurementRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_RadioMeasurementRequest, IES_RadioMeasurementRequest, &IEIDX_RadioMeasurementRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -15901,11 +16011,13 @@ tANI_U32 dot11fUnpackRadioMeasurementRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf,
         {offsetof(tDot11fReAssocRequest, QosMapSet), offsetof(tDot11fIEQosMapSet, present), 0, "QosMapSet" , 0, 2, 62, SigIeQosMapSet, {0, 0, 0, 0, 0}, 0, DOT11F_EID_QOSMAPSET, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_ReAssocRequest;
+
 tANI_U32 dot11fUnpackReAssocRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fReAssocRequest *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_ReAssocRequest, IES_ReAssocRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_ReAssocRequest, IES_ReAssocRequest, &IEIDX_ReAssocRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -16922,11 +17034,13 @@ tANI_U32 dot11fUnpackReAssocRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32
         {offsetof(tDot11fReAssocResponse, QosMapSet), offsetof(tDot11fIEQosMapSet, present), 0, "QosMapSet" , 0, 2, 62, SigIeQosMapSet, {0, 0, 0, 0, 0}, 0, DOT11F_EID_QOSMAPSET, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_ReAssocResponse;
+
 tANI_U32 dot11fUnpackReAssocResponse(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fReAssocResponse *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_ReAssocResponse, IES_ReAssocResponse, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_ReAssocResponse, IES_ReAssocResponse, &IEIDX_ReAssocResponse, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -18051,7 +18165,7 @@ tANI_U32 dot11fUnpackSMPowerSave(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nB
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_SMPowerSave, IES_SMPowerSave, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_SMPowerSave, IES_SMPowerSave, &IEIDX_NONE, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -18088,7 +18202,7 @@ tANI_U32 dot11fUnpackSaQueryReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBu
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_SaQueryReq, IES_SaQueryReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_SaQueryReq, IES_SaQueryReq, &IEIDX_NONE, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -18123,7 +18237,7 @@ tANI_U32 dot11fUnpackSaQueryRsp(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBu
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_SaQueryRsp, IES_SaQueryRsp, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_SaQueryRsp, IES_SaQueryRsp, &IEIDX_NONE, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -18155,11 +18269,13 @@ tANI_U32 dot11fUnpackSaQueryRsp(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBu
         {offsetof(tDot11fTDLSDisReq, LinkIdentifier), offsetof(tDot11fIELinkIdentifier, present), 0, "LinkIdentifier" , 0, 20, 20, SigIeLinkIdentifier, {0, 0, 0, 0, 0}, 0, DOT11F_EID_LINKIDENTIFIER, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_TDLSDisReq;
+
 tANI_U32 dot11fUnpackTDLSDisReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fTDLSDisReq *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TDLSDisReq, IES_TDLSDisReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TDLSDisReq, IES_TDLSDisReq, &IEIDX_TDLSDisReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -18215,11 +18331,13 @@ tANI_U32 dot11fUnpackTDLSDisReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBu
         {offsetof(tDot11fTDLSDisRsp, VHTCaps), offsetof(tDot11fIEVHTCaps, present), 0, "VHTCaps" , 0, 14, 14, SigIeVHTCaps, {0, 0, 0, 0, 0}, 0, DOT11F_EID_VHTCAPS, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_TDLSDisRsp;
+
 tANI_U32 dot11fUnpackTDLSDisRsp(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fTDLSDisRsp *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TDLSDisRsp, IES_TDLSDisRsp, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TDLSDisRsp, IES_TDLSDisRsp, &IEIDX_TDLSDisRsp, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -18533,11 +18651,13 @@ tANI_U32 dot11fUnpackTDLSDisRsp(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBu
         {offsetof(tDot11fTDLSPeerTrafficInd, PUBufferStatus), offsetof(tDot11fIEPUBufferStatus, present), 0, "PUBufferStatus" , 0, 3, 3, SigIePUBufferStatus, {0, 0, 0, 0, 0}, 0, DOT11F_EID_PUBUFFERSTATUS, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_TDLSPeerTrafficInd;
+
 tANI_U32 dot11fUnpackTDLSPeerTrafficInd(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fTDLSPeerTrafficInd *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TDLSPeerTrafficInd, IES_TDLSPeerTrafficInd, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TDLSPeerTrafficInd, IES_TDLSPeerTrafficInd, &IEIDX_TDLSPeerTrafficInd, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -18603,11 +18723,13 @@ tANI_U32 dot11fUnpackTDLSPeerTrafficInd(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI
         {offsetof(tDot11fTDLSPeerTrafficRsp, LinkIdentifier), offsetof(tDot11fIELinkIdentifier, present), 0, "LinkIdentifier" , 0, 20, 20, SigIeLinkIdentifier, {0, 0, 0, 0, 0}, 0, DOT11F_EID_LINKIDENTIFIER, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_TDLSPeerTrafficRsp;
+
 tANI_U32 dot11fUnpackTDLSPeerTrafficRsp(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fTDLSPeerTrafficRsp *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TDLSPeerTrafficRsp, IES_TDLSPeerTrafficRsp, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TDLSPeerTrafficRsp, IES_TDLSPeerTrafficRsp, &IEIDX_TDLSPeerTrafficRsp, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -18659,11 +18781,13 @@ tANI_U32 dot11fUnpackTDLSPeerTrafficRsp(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI
         {offsetof(tDot11fTDLSSetupCnf, OperatingMode), offsetof(tDot11fIEOperatingMode, present), 0, "OperatingMode" , 0, 3, 3, SigIeOperatingMode, {0, 0, 0, 0, 0}, 0, DOT11F_EID_OPERATINGMODE, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_TDLSSetupCnf;
+
 tANI_U32 dot11fUnpackTDLSSetupCnf(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fTDLSSetupCnf *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TDLSSetupCnf, IES_TDLSSetupCnf, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TDLSSetupCnf, IES_TDLSSetupCnf, &IEIDX_TDLSSetupCnf, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -18941,11 +19065,13 @@ tANI_U32 dot11fUnpackTDLSSetupCnf(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 n
         {offsetof(tDot11fTDLSSetupReq, VHTCaps), offsetof(tDot11fIEVHTCaps, present), 0, "VHTCaps" , 0, 14, 14, SigIeVHTCaps, {0, 0, 0, 0, 0}, 0, DOT11F_EID_VHTCAPS, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_TDLSSetupReq;
+
 tANI_U32 dot11fUnpackTDLSSetupReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fTDLSSetupReq *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TDLSSetupReq, IES_TDLSSetupReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TDLSSetupReq, IES_TDLSSetupReq, &IEIDX_TDLSSetupReq, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -19327,11 +19453,13 @@ tANI_U32 dot11fUnpackTDLSSetupReq(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 n
         {offsetof(tDot11fTDLSSetupRsp, OperatingMode), offsetof(tDot11fIEOperatingMode, present), 0, "OperatingMode" , 0, 3, 3, SigIeOperatingMode, {0, 0, 0, 0, 0}, 0, DOT11F_EID_OPERATINGMODE, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_TDLSSetupRsp;
+
 tANI_U32 dot11fUnpackTDLSSetupRsp(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fTDLSSetupRsp *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TDLSSetupRsp, IES_TDLSSetupRsp, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TDLSSetupRsp, IES_TDLSSetupRsp, &IEIDX_TDLSSetupRsp, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -19709,11 +19837,13 @@ tANI_U32 dot11fUnpackTDLSSetupRsp(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 n
         {offsetof(tDot11fTDLSTeardown, LinkIdentifier), offsetof(tDot11fIELinkIdentifier, present), 0, "LinkIdentifier" , 0, 20, 20, SigIeLinkIdentifier, {0, 0, 0, 0, 0}, 0, DOT11F_EID_LINKIDENTIFIER, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_TDLSTeardown;
+
 tANI_U32 dot11fUnpackTDLSTeardown(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fTDLSTeardown *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TDLSTeardown, IES_TDLSTeardown, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TDLSTeardown, IES_TDLSTeardown, &IEIDX_TDLSTeardown, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -19814,11 +19944,13 @@ tANI_U32 dot11fUnpackTDLSTeardown(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 n
         {offsetof(tDot11fTPCReport, TPCReport), offsetof(tDot11fIETPCReport, present), 0, "TPCReport" , 0, 4, 4, SigIeTPCReport, {0, 0, 0, 0, 0}, 0, DOT11F_EID_TPCREPORT, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_TPCReport;
+
 tANI_U32 dot11fUnpackTPCReport(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fTPCReport *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TPCReport, IES_TPCReport, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TPCReport, IES_TPCReport, &IEIDX_TPCReport, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -19860,11 +19992,13 @@ tANI_U32 dot11fUnpackTPCReport(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf
         {offsetof(tDot11fTPCRequest, TPCRequest), offsetof(tDot11fIETPCRequest, present), 0, "TPCRequest" , 0, 2, 2, SigIeTPCRequest, {0, 0, 0, 0, 0}, 0, DOT11F_EID_TPCREQUEST, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_TPCRequest;
+
 tANI_U32 dot11fUnpackTPCRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fTPCRequest *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TPCRequest, IES_TPCRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_TPCRequest, IES_TPCRequest, &IEIDX_TPCRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -19908,7 +20042,7 @@ tANI_U32 dot11fUnpackVHTGidManagementActionFrame(tpAniSirGlobal pCtx, tANI_U8 *p
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_VHTGidManagementActionFrame, IES_VHTGidManagementActionFrame, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_VHTGidManagementActionFrame, IES_VHTGidManagementActionFrame, &IEIDX_NONE, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -19944,11 +20078,13 @@ tANI_U32 dot11fUnpackVHTGidManagementActionFrame(tpAniSirGlobal pCtx, tANI_U8 *p
         {offsetof(tDot11fWMMAddTSRequest, ESETrafStrmRateSet), offsetof(tDot11fIEESETrafStrmRateSet, present), 0, "ESETrafStrmRateSet" , 0, 7, 15, SigIeESETrafStrmRateSet, {0, 64, 150, 8, 0}, 4, DOT11F_EID_ESETRAFSTRMRATESET, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_WMMAddTSRequest;
+
 tANI_U32 dot11fUnpackWMMAddTSRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fWMMAddTSRequest *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_WMMAddTSRequest, IES_WMMAddTSRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_WMMAddTSRequest, IES_WMMAddTSRequest, &IEIDX_WMMAddTSRequest, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -20030,11 +20166,13 @@ tANI_U32 dot11fUnpackWMMAddTSRequest(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U3
         {offsetof(tDot11fWMMAddTSResponse, ESETrafStrmMet), offsetof(tDot11fIEESETrafStrmMet, present), 0, "ESETrafStrmMet" , 0, 10, 10, SigIeESETrafStrmMet, {0, 64, 150, 7, 0}, 4, DOT11F_EID_ESETRAFSTRMMET, 0, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_WMMAddTSResponse;
+
 tANI_U32 dot11fUnpackWMMAddTSResponse(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fWMMAddTSResponse *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_WMMAddTSResponse, IES_WMMAddTSResponse, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_WMMAddTSResponse, IES_WMMAddTSResponse, &IEIDX_WMMAddTSResponse, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -20115,11 +20253,13 @@ tANI_U32 dot11fUnpackWMMAddTSResponse(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U
         {offsetof(tDot11fWMMDelTS, WMMTSPEC), offsetof(tDot11fIEWMMTSPEC, present), 0, "WMMTSPEC" , 0, 63, 63, SigIeWMMTSPEC, {0, 80, 242, 2, 2}, 5, DOT11F_EID_WMMTSPEC, 1, },
     {0, 0, 0, NULL, 0, 0, 0, 0, {0, 0, 0, 0, 0}, 0, 0xff, 0, },    };
 
+    static tIEIndex IEIDX_WMMDelTS;
+
 tANI_U32 dot11fUnpackWMMDelTS(tpAniSirGlobal pCtx, tANI_U8 *pBuf, tANI_U32 nBuf, tDot11fWMMDelTS *pFrm)
 {
     tANI_U32 i = 0;
     tANI_U32 status = 0;
-    status = UnpackCore(pCtx, pBuf, nBuf, FFS_WMMDelTS, IES_WMMDelTS, ( tANI_U8* )pFrm, sizeof(*pFrm));
+    status = UnpackCore(pCtx, pBuf, nBuf, FFS_WMMDelTS, IES_WMMDelTS, &IEIDX_WMMDelTS, ( tANI_U8* )pFrm, sizeof(*pFrm));
 
     (void)i;
 #   ifdef DOT11F_DUMP_FRAMES
@@ -20182,6 +20322,7 @@ static tANI_U32 UnpackCore(tpAniSirGlobal pCtx,
                            tANI_U32 nBuf,
                            const tFFDefn  FFs[],
                            const tIEDefn  IEs[],
+                           const tIEIndex *pIeIdx,
                            tANI_U8 *pFrm,
                            size_t   nFrm)
 {
@@ -20361,7 +20502,7 @@ static tANI_U32 UnpackCore(tpAniSirGlobal pCtx,
             goto MandatoryCheck;
         }
 
-        pIe = FindIEDefn(pCtx, pBufRemaining, nBufRemaining, IEs);
+        pIe = FindIEDefn(pCtx, pBufRemaining, nBufRemaining, IEs, pIeIdx);
 
         eid = *pBufRemaining++; --nBufRemaining;
         len = *pBufRemaining++; --nBufRemaining;
@@ -20783,7 +20924,7 @@ static tANI_U32 UnpackCore(tpAniSirGlobal pCtx,
                                 nBufRemaining += pIe->noui;
                                 len += pIe->noui;
                             }
-                        status |= GetContainerIesLen(pCtx, pBufRemaining, nBufRemaining, &len, IES_RICDataDesc);
+                        status |= GetContainerIesLen(pCtx, pBufRemaining, nBufRemaining, &len, IES_RICDataDesc, &IEIDX_RICDataDesc);
                         if (status != DOT11F_PARSE_SUCCESS && status != DOT11F_UNKNOWN_IES ) break;
                         status |= dot11fUnpackIeRICDataDesc(pCtx, pBufRemaining, len, ( tDot11fIERICDataDesc* )(pFrm + pIe->offset + sizeof(tDot11fIERICDataDesc)*countOffset) );
                             break;
@@ -46111,3 +46252,99 @@ static tANI_U32 PackTlvCore(tpAniSirGlobal pCtx,
     return status;
 
 }
+
+static const struct {
+    const tIEDefn *pIEs;
+    tIEIndex      *pIeIdx;
+} IEIndexes[] = {
+    { IES_Airgo, &IEIDX_Airgo, },
+    { IES_ChannelSwitchWrapper, &IEIDX_ChannelSwitchWrapper, },
+    { IES_FTInfo, &IEIDX_FTInfo, },
+    { IES_reportBeacon, &IEIDX_reportBeacon, },
+    { IES_measurement_requestBeacon, &IEIDX_measurement_requestBeacon, },
+    { IES_NeighborReport, &IEIDX_NeighborReport, },
+    { IES_RICDataDesc, &IEIDX_RICDataDesc, },
+    { IES_AddTSRequest, &IEIDX_AddTSRequest, },
+    { IES_AddTSResponse, &IEIDX_AddTSResponse, },
+    { IES_AssocRequest, &IEIDX_AssocRequest, },
+    { IES_AssocResponse, &IEIDX_AssocResponse, },
+    { IES_Authentication, &IEIDX_Authentication, },
+    { IES_Beacon, &IEIDX_Beacon, },
+    { IES_Beacon1, &IEIDX_Beacon1, },
+    { IES_Beacon2, &IEIDX_Beacon2, },
+    { IES_BeaconIEs, &IEIDX_BeaconIEs, },
+    { IES_ChannelSwitch, &IEIDX_ChannelSwitch, },
+    { IES_DeAuth, &IEIDX_DeAuth, },
+    { IES_DeviceDiscoverabilityReq, &IEIDX_DeviceDiscoverabilityReq, },
+    { IES_DeviceDiscoverabilityRes, &IEIDX_DeviceDiscoverabilityRes, },
+    { IES_Disassociation, &IEIDX_Disassociation, },
+    { IES_GONegCnf, &IEIDX_GONegCnf, },
+    { IES_GONegReq, &IEIDX_GONegReq, },
+    { IES_GONegRes, &IEIDX_GONegRes, },
+    { IES_HT2040BSSCoexistenceManagementActionFrame, &IEIDX_HT2040BSSCoexistenceManagementActionFrame, },
+    { IES_InvitationReq, &IEIDX_InvitationReq, },
+    { IES_InvitationRes, &IEIDX_InvitationRes, },
+    { IES_MeasurementReport, &IEIDX_MeasurementReport, },
+    { IES_MeasurementRequest, &IEIDX_MeasurementRequest, },
+    { IES_NeighborReportRequest, &IEIDX_NeighborReportRequest, },
+    { IES_NeighborReportResponse, &IEIDX_NeighborReportResponse, },
+    { IES_NoticeOfAbs, &IEIDX_NoticeOfAbs, },
+    { IES_PresenceReq, &IEIDX_PresenceReq, },
+    { IES_PresenceRes, &IEIDX_PresenceRes, },
+    { IES_ProbeRequest, &IEIDX_ProbeRequest, },
+    { IES_ProbeResponse, &IEIDX_ProbeResponse, },
+    { IES_ProvisionDiscoveryReq, &IEIDX_ProvisionDiscoveryReq, },
+    { IES_ProvisionDiscoveryRes, &IEIDX_ProvisionDiscoveryRes, },
+    { IES_QosMapConfigure, &IEIDX_QosMapConfigure, },
+    { IES_RadioMeasurementReport, &IEIDX_RadioMeasurementReport, },
+    { IES_RadioMeasurementRequest, &IEIDX_RadioMeasurementRequest, },
+    { IES_ReAssocRequest, &IEIDX_ReAssocRequest, },
+    { IES_ReAssocResponse, &IEIDX_ReAssocResponse, },
+    { IES_TDLSDisReq, &IEIDX_TDLSDisReq, },
+    { IES_TDLSDisRsp, &IEIDX_TDLSDisRsp, },
+    { IES_TDLSPeerTrafficInd, &IEIDX_TDLSPeerTrafficInd, },
+    { IES_TDLSPeerTrafficRsp, &IEIDX_TDLSPeerTrafficRsp, },
+    { IES_TDLSSetupCnf, &IEIDX_TDLSSetupCnf, },
+    { IES_TDLSSetupReq, &IEIDX_TDLSSetupReq, },
+    { IES_TDLSSetupRsp, &IEIDX_TDLSSetupRsp, },
+    { IES_TDLSTeardown, &IEIDX_TDLSTeardown, },
+    { IES_TPCReport, &IEIDX_TPCReport, },
+    { IES_TPCRequest, &IEIDX_TPCRequest, },
+    { IES_WMMAddTSRequest, &IEIDX_WMMAddTSRequest, },
+    { IES_WMMAddTSResponse, &IEIDX_WMMAddTSResponse, },
+    { IES_WMMDelTS, &IEIDX_WMMDelTS, },
+};
+
+static void BuildIEIndex(const tIEDefn IEs[], tIEIndex *pIeIdx)
+{
+    tANI_U8 last[256] = { 0, };
+    tANI_U8 i, eid;
+
+    for (i = 0; 0xff != IEs[i].eid; ++i)
+    {
+        if (i >= DOT11F_IE_INDEX_MAX_DEFNS)
+        {
+            /* Unreachable IEs are ignored, as when the index is missing */
+            FRAMES_DBG_BREAK();
+            break;
+        }
+        eid = IEs[i].eid;
+        if (last[eid])
+            pIeIdx->next[last[eid] - 1] = i + 1;
+        else
+            pIeIdx->first[eid] = i + 1;
+        last[eid] = i + 1;
+    }
+}
+
+void dot11fInitIEIndexes(void)
+{
+    static tFRAMES_BOOL fBuilt;
+    tANI_U32 i;
+
+    if (fBuilt)
+        return;
+    for (i = 0; i < countof(IEIndexes); ++i)
+        BuildIEIndex(IEIndexes[i].pIEs, IEIndexes[i].pIeIdx);
+    fBuilt = 1;
+}
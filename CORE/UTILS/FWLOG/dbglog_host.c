@@ -3921,6 +3921,7 @@ int dbglog_debugfs_init(wmi_unified_t wmi_handle)
 
     debugfs_create_file(DEBUGFS_BLOCK_NAME, S_IRUSR, wmi_handle->debugfs_phy, &wmi_handle->dbglog,
                             &fops_dbglog_block);
+    wmi_unified_debugfs_init(wmi_handle);
 
     return TRUE;
 }
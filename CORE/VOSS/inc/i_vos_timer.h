@@ -46,6 +46,7 @@
 #include <linux/timer.h>
 #include <linux/time.h>
 #include <linux/jiffies.h>
+#include <linux/ktime.h>
 
 /*--------------------------------------------------------------------------
   Preprocessor definitions and constants
@@ -330,5 +330,21 @@ v_TIME_t vos_timer_get_system_ticks( v_VOID_t );
 v_TIME_t vos_timer_get_system_time( v_VOID_t );
 
 
+/*--------------------------------------------------------------------------
+
+  \brief vos_timer_get_system_time_us() - Get the monotonic time in microseconds
+
+  The \a vos_timer_get_system_time_us() function returns a monotonic
+  timestamp in microseconds, suitable for measuring short code paths by
+  taking the difference between two timestamps.
+
+  \returns - The current monotonic time in microseconds.
+
+  \sa
+
+  ------------------------------------------------------------------------*/
+v_U64_t vos_timer_get_system_time_us( v_VOID_t );
+
+
 
 #endif // #if !defined __VOSS_TIMER_H
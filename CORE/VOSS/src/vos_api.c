@@ -453,6 +453,7 @@ VOS_STATUS vos_open( v_CONTEXT_t *pVosContext, v_SIZE_t hddContextSize )
 
    macOpenParms.dfsRadarPriMultiplier = pHddCtx->cfg_ini->dfsRadarPriMultiplier;
    macOpenParms.reorderOffload = pHddCtx->cfg_ini->reorderOffloadSupport;
+   macOpenParms.rxInOrderLookupMode = pHddCtx->cfg_ini->rxInOrderLookupMode;
 
 #ifdef IPA_UC_OFFLOAD
     /* IPA micro controller data path offload resource config item */
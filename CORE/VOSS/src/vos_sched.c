@@ -59,6 +59,11 @@
 #include <linux/spinlock.h>
 #include <linux/kthread.h>
 #include <linux/cpu.h>
+#include <linux/if_ether.h>
+#include <linux/ip.h>
+#include <linux/ipv6.h>
+#include <linux/jhash.h>
+#include <asm/unaligned.h>
 #if defined(QCA_CONFIG_SMP) && defined(CONFIG_CNSS)
 #include <net/cnss.h>
 #endif
@@ -103,7 +108,6 @@ static int VosTXThread(void *Arg);
 static int VosRXThread(void *Arg);
 #ifdef QCA_CONFIG_SMP
 static int VosTlshimRxThread(void *arg);
-static unsigned long affine_cpu = 0;
 static VOS_STATUS vos_alloc_tlshim_pkt_freeq(pVosSchedContext pSchedContext);
 #endif
 void vos_sched_flush_rx_mqs(pVosSchedContext SchedContext);
@@ -113,6 +117,25 @@ extern v_VOID_t vos_core_return_msg(v_PVOID_t pVContext, pVosMsgWrapper pMsgWrap
 #ifdef QCA_CONFIG_SMP
 #define VOS_CORE_PER_CLUSTER 4
 
+/**
+ * vos_sched_num_tlshim_rx_threads - number of tlshim rx threads to start
+ *
+ * One rx thread per big core; single cluster systems keep a single
+ * thread, as do builds with VOS_MAX_TLSHIM_RX_THREADS set to 1.
+ *
+ * Return: number of rx threads
+ */
+static u_int8_t vos_sched_num_tlshim_rx_threads(void)
+{
+	unsigned int num_cpus = num_possible_cpus();
+
+	if (num_cpus <= VOS_CORE_PER_CLUSTER)
+		return 1;
+	if (num_cpus - VOS_CORE_PER_CLUSTER > VOS_MAX_TLSHIM_RX_THREADS)
+		return VOS_MAX_TLSHIM_RX_THREADS;
+	return num_cpus - VOS_CORE_PER_CLUSTER;
+}
+
 static int vos_set_cpus_allowed_ptr(struct task_struct *task,
                                     unsigned long cpu)
 {
@@ -172,6 +195,8 @@ static int vos_sched_find_attach_cpu(pVosSchedContext pSchedContext,
 	unsigned long cpus;
 	unsigned char perf_core_count = 0;
 	unsigned char litl_core_count = 0;
+	pVosTlshimRxCtx pRxCtx;
+	int i;
 #ifdef WLAN_OPEN_SOURCE
 	struct cpumask litl_mask;
 #endif
@@ -224,57 +249,62 @@ static int vos_sched_find_attach_cpu(pVosSchedContext pSchedContext,
 		return 0;
 	}
 
-	if ((high_throughput && perf_core_count) || (!litl_core_count)) {
-		/* Attach RX thread to PERF CPU */
-		if (pSchedContext->rx_thread_cpu !=
-			online_perf_cpu[perf_core_count - 1]) {
-			if (vos_set_cpus_allowed_ptr(
-				pSchedContext->TlshimRxThread,
-				online_perf_cpu[perf_core_count - 1])) {
+	for (i = 0; i < pSchedContext->numTlshimRxThreads; i++) {
+		pRxCtx = &pSchedContext->tlshimRx[i];
+		if (!pRxCtx->thread)
+			continue;
+
+		if ((high_throughput && perf_core_count) ||
+			(!litl_core_count)) {
+			/* Spread RX threads over PERF CPUs, last core first */
+			cpus = online_perf_cpu[perf_core_count - 1 -
+					(i % perf_core_count)];
+			if (pRxCtx->cpu == cpus)
+				continue;
+			if (vos_set_cpus_allowed_ptr(pRxCtx->thread, cpus)) {
 				VOS_TRACE(VOS_MODULE_ID_VOSS,
 					VOS_TRACE_LEVEL_ERROR,
-					"%s: rx thread perf core set fail",
-					__func__);
+					"%s: rx thread %d perf core set fail",
+					__func__, i);
 				vos_mem_free(online_perf_cpu);
 				vos_mem_free(online_litl_cpu);
 				return 1;
 			}
-			pSchedContext->rx_thread_cpu =
-				online_perf_cpu[perf_core_count - 1];
-		}
-	} else {
+			pRxCtx->cpu = cpus;
+		} else {
 #ifdef WLAN_OPEN_SOURCE
-		/* Attach to any little core
-		 * Final decision should made by scheduler */
-		vos_sched_all_litl_cpu_mask(&litl_mask);
-		set_cpus_allowed_ptr(pSchedContext->TlshimRxThread, &litl_mask);
-		pSchedContext->rx_thread_cpu = 0;
+			/* Attach to any little core
+			 * Final decision should made by scheduler */
+			vos_sched_all_litl_cpu_mask(&litl_mask);
+			set_cpus_allowed_ptr(pRxCtx->thread, &litl_mask);
+			pRxCtx->cpu = 0;
 #else
-		/* Attach RX thread to last little core CPU */
-		if (pSchedContext->rx_thread_cpu !=
-			online_litl_cpu[litl_core_count - 1]) {
-			if (vos_set_cpus_allowed_ptr(
-				pSchedContext->TlshimRxThread,
-				online_litl_cpu[litl_core_count - 1])) {
+			/* Attach RX threads to little core CPUs, last first */
+			cpus = online_litl_cpu[litl_core_count - 1 -
+					(i % litl_core_count)];
+			if (pRxCtx->cpu == cpus)
+				continue;
+			if (vos_set_cpus_allowed_ptr(pRxCtx->thread, cpus)) {
 				VOS_TRACE(VOS_MODULE_ID_VOSS,
 					VOS_TRACE_LEVEL_ERROR,
-					"%s: rx thread litl core set fail",
-					__func__);
+					"%s: rx thread %d litl core set fail",
+					__func__, i);
 				vos_mem_free(online_perf_cpu);
 				vos_mem_free(online_litl_cpu);
 				return 1;
 			}
-			pSchedContext->rx_thread_cpu =
-				online_litl_cpu[litl_core_count - 1];
-		}
+			pRxCtx->cpu = cpus;
 #endif /* WLAN_OPEN_SOURCE */
+		}
 	}
 
 	VOS_TRACE(VOS_MODULE_ID_VOSS, VOS_TRACE_LEVEL_INFO_LOW,
-		"%s: NUM PERF CORE %d, HIGH TPUTR REQ %d, RX THRE CPU %lu",
+		"%s: NUM PERF CORE %d, HIGH TPUTR REQ %d, RX THREADS %d, "
+		"RX THRE CPU %lu",
 		__func__, perf_core_count,
 		(int)pSchedContext->high_throughput_required,
-		pSchedContext->rx_thread_cpu);
+		pSchedContext->numTlshimRxThreads,
+		pSchedContext->tlshimRx[0].cpu);
 
 	vos_mem_free(online_perf_cpu);
 	vos_mem_free(online_litl_cpu);
@@ -371,11 +401,12 @@ static int __vos_cpu_hotplug_notify(struct notifier_block *block,
    unsigned long cpu = (unsigned long) hcpu;
    unsigned long pref_cpu = 0;
    pVosSchedContext pSchedContext = get_vos_sched_ctxt();
+   pVosTlshimRxCtx pRxCtx;
    int i;
    unsigned int multi_cluster;
    unsigned int num_cpus;
 
-   if ((NULL == pSchedContext) || (NULL == pSchedContext->TlshimRxThread))
+   if ((NULL == pSchedContext) || (NULL == pSchedContext->tlshimRx[0].thread))
        return NOTIFY_OK;
 
    if (vos_is_load_unload_in_progress(VOS_MODULE_ID_VOSS, NULL) ||
@@ -385,7 +416,8 @@ static int __vos_cpu_hotplug_notify(struct notifier_block *block,
    num_cpus = num_possible_cpus();
    VOS_TRACE(VOS_MODULE_ID_VOSS, VOS_TRACE_LEVEL_INFO_LOW,
              "%s: RX CORE %d, STATE %d, NUM CPUS %d",
-              __func__, (int)affine_cpu, (int)state, num_cpus);
+              __func__, (int)pSchedContext->tlshimRx[0].cpu, (int)state,
+              num_cpus);
    multi_cluster = (num_cpus > VOS_CORE_PER_CLUSTER)?1:0;
    if ((multi_cluster) &&
        ((CPU_ONLINE == state) || (CPU_DEAD == state))) {
@@ -393,36 +425,34 @@ static int __vos_cpu_hotplug_notify(struct notifier_block *block,
       return NOTIFY_OK;
    }
 
-   switch (state) {
-   case CPU_ONLINE:
-       if (affine_cpu != 0)
-           return NOTIFY_OK;
-
-       for_each_online_cpu(i) {
-           if (i == 0)
-               continue;
-           pref_cpu = i;
-               break;
-       }
-       break;
-   case CPU_DEAD:
-       if (cpu != affine_cpu)
-           return NOTIFY_OK;
+   if ((CPU_ONLINE != state) && (CPU_DEAD != state))
+       return NOTIFY_OK;
 
-       affine_cpu = 0;
-       for_each_online_cpu(i) {
-           if (i == 0)
-               continue;
-           pref_cpu = i;
-               break;
-       }
+   for_each_online_cpu(i) {
+       if (i == 0)
+           continue;
+       pref_cpu = i;
+           break;
    }
 
-   if (pref_cpu == 0)
-       return NOTIFY_OK;
+   /*
+    * On CPU_ONLINE bind the threads still left on cpu 0; on CPU_DEAD
+    * move every thread that was bound to the core going away.
+    */
+   for (i = 0; i < pSchedContext->numTlshimRxThreads; i++) {
+       pRxCtx = &pSchedContext->tlshimRx[i];
+       if (NULL == pRxCtx->thread)
+           continue;
+       if (((CPU_ONLINE == state) && (pRxCtx->cpu != 0)) ||
+           ((CPU_DEAD == state) && (pRxCtx->cpu != cpu)))
+           continue;
 
-   if (!vos_set_cpus_allowed_ptr(pSchedContext->TlshimRxThread, pref_cpu))
-       affine_cpu = pref_cpu;
+       if (CPU_DEAD == state)
+           pRxCtx->cpu = 0;
+       if ((pref_cpu != 0) &&
+           (!vos_set_cpus_allowed_ptr(pRxCtx->thread, pref_cpu)))
+           pRxCtx->cpu = pref_cpu;
+   }
 
    return NOTIFY_OK;
 }
@@ -494,6 +524,10 @@ vos_sched_open
 )
 {
   VOS_STATUS  vStatus = VOS_STATUS_SUCCESS;
+#ifdef QCA_CONFIG_SMP
+  pVosTlshimRxCtx pRxCtx;
+  int i;
+#endif
 /*-------------------------------------------------------------------------*/
   VOS_TRACE(VOS_MODULE_ID_VOSS, VOS_TRACE_LEVEL_INFO_HIGH,
              "%s: Opening the VOSS Scheduler",__func__);
@@ -544,15 +578,21 @@ vos_sched_open
   pSchedContext->rxEventFlag= 0;
 
 #ifdef QCA_CONFIG_SMP
-  init_waitqueue_head(&pSchedContext->tlshimRxWaitQueue);
-  init_completion(&pSchedContext->TlshimRxStartEvent);
-  init_completion(&pSchedContext->SuspndTlshimRxEvent);
-  init_completion(&pSchedContext->ResumeTlshimRxEvent);
-  init_completion(&pSchedContext->TlshimRxShutdown);
-  pSchedContext->tlshimRxEvtFlg = 0;
-  spin_lock_init(&pSchedContext->TlshimRxQLock);
+  pSchedContext->numTlshimRxThreads = vos_sched_num_tlshim_rx_threads();
+  for (i = 0; i < VOS_MAX_TLSHIM_RX_THREADS; i++) {
+     pRxCtx = &pSchedContext->tlshimRx[i];
+     pRxCtx->pSchedContext = pSchedContext;
+     pRxCtx->id = i;
+     init_waitqueue_head(&pRxCtx->waitQueue);
+     init_completion(&pRxCtx->StartEvent);
+     init_completion(&pRxCtx->SuspndEvent);
+     init_completion(&pRxCtx->ResumeEvent);
+     init_completion(&pRxCtx->Shutdown);
+     pRxCtx->evtFlg = 0;
+     spin_lock_init(&pRxCtx->rxQLock);
+     INIT_LIST_HEAD(&pRxCtx->rxQueue);
+  }
   spin_lock_init(&pSchedContext->VosTlshimPktFreeQLock);
-  INIT_LIST_HEAD(&pSchedContext->tlshimRxQueue);
   spin_lock_bh(&pSchedContext->VosTlshimPktFreeQLock);
   INIT_LIST_HEAD(&pSchedContext->VosTlshimPktFreeQ);
   if (vos_alloc_tlshim_pkt_freeq(pSchedContext) !=  VOS_STATUS_SUCCESS)
@@ -617,20 +657,34 @@ vos_sched_open
              ("VOSS RX thread Created"));
 
 #ifdef QCA_CONFIG_SMP
-  pSchedContext->TlshimRxThread = kthread_create(VosTlshimRxThread,
-                                                 pSchedContext,
-                                                 "VosTlshimRxThread");
-  if (IS_ERR(pSchedContext->TlshimRxThread))
-  {
-
-     VOS_TRACE(VOS_MODULE_ID_VOSS, VOS_TRACE_LEVEL_FATAL,
-               "%s: Could not Create VOSS Tlshim RX Thread", __func__);
-     goto TLSHIM_RX_THREAD_START_FAILURE;
-
+  for (i = 0; i < pSchedContext->numTlshimRxThreads; i++) {
+     pRxCtx = &pSchedContext->tlshimRx[i];
+     if (i == 0)
+        pRxCtx->thread = kthread_create(VosTlshimRxThread, pRxCtx,
+                                        "VosTlshimRxThread");
+     else
+        pRxCtx->thread = kthread_create(VosTlshimRxThread, pRxCtx,
+                                        "VosTlshimRxThread%d", i);
+     if (IS_ERR(pRxCtx->thread))
+     {
+        pRxCtx->thread = NULL;
+        if (i == 0) {
+           VOS_TRACE(VOS_MODULE_ID_VOSS, VOS_TRACE_LEVEL_FATAL,
+                     "%s: Could not Create VOSS Tlshim RX Thread", __func__);
+           goto TLSHIM_RX_THREAD_START_FAILURE;
+        }
+        /* Carry on with the threads created so far */
+        VOS_TRACE(VOS_MODULE_ID_VOSS, VOS_TRACE_LEVEL_ERROR,
+                  "%s: Could not Create VOSS Tlshim RX Thread %d, using %d",
+                  __func__, i, i);
+        pSchedContext->numTlshimRxThreads = i;
+        break;
+     }
+     wake_up_process(pRxCtx->thread);
   }
-  wake_up_process(pSchedContext->TlshimRxThread);
   VOS_TRACE(VOS_MODULE_ID_VOSS, VOS_TRACE_LEVEL_INFO_HIGH,
-             ("VOSS Tlshim RX thread Created"));
+            "%s: %d VOSS Tlshim RX threads Created", __func__,
+            pSchedContext->numTlshimRxThreads);
 #endif
   /*
   ** Now make sure all threads have started before we exit.
@@ -646,9 +700,11 @@ vos_sched_open
   VOS_TRACE(VOS_MODULE_ID_VOSS, VOS_TRACE_LEVEL_INFO_HIGH,
                "%s: VOSS Rx Thread has started",__func__);
 #ifdef QCA_CONFIG_SMP
-  wait_for_completion_interruptible(&pSchedContext->TlshimRxStartEvent);
+  for (i = 0; i < pSchedContext->numTlshimRxThreads; i++)
+     wait_for_completion_interruptible(
+                         &pSchedContext->tlshimRx[i].StartEvent);
   VOS_TRACE(VOS_MODULE_ID_VOSS, VOS_TRACE_LEVEL_INFO_HIGH,
-               "%s: VOSS Tlshim Rx Thread has started", __func__);
+               "%s: VOSS Tlshim Rx Threads have started", __func__);
 #endif
   /*
   ** We're good now: Let's get the ball rolling!!!
@@ -1601,10 +1657,32 @@ struct VosTlshimPkt *vos_alloc_tlshim_pkt(pVosSchedContext pSchedContext)
    return pkt;
 }
 
+/*---------------------------------------------------------------------------
+  \brief vos_tlshim_rx_enqueue() - Queue a message to a Tlshim Rx thread
+  \param  pRxCtx - Tlshim Rx thread context
+  \param pkt - Vos data message buffer
+
+  \return Nothing
+  \sa vos_tlshim_rx_enqueue()
+  -------------------------------------------------------------------------*/
+static void vos_tlshim_rx_enqueue(pVosTlshimRxCtx pRxCtx,
+                                  struct VosTlshimPkt *pkt)
+{
+   spin_lock_bh(&pRxCtx->rxQLock);
+   list_add_tail(&pkt->list, &pRxCtx->rxQueue);
+   pRxCtx->rxQlen++;
+   pRxCtx->stats.enqueued++;
+   if (pRxCtx->rxQlen > pRxCtx->stats.maxQlen)
+       pRxCtx->stats.maxQlen = pRxCtx->rxQlen;
+   spin_unlock_bh(&pRxCtx->rxQLock);
+   set_bit(RX_POST_EVENT_MASK, &pRxCtx->evtFlg);
+   wake_up_interruptible(&pRxCtx->waitQueue);
+}
+
 /*---------------------------------------------------------------------------
   \brief vos_indicate_rxpkt() - API to Indicate rx data packet
-  The \a vos_indicate_rxpkt() enqueues the rx packet onto tlshimRxQueue
-  and notifies VosTlshimRxThread().
+  The \a vos_indicate_rxpkt() enqueues the rx packet onto the rx queue of
+  the first Tlshim Rx thread and notifies it.
   \param  Arg - pointer to the global vOSS Sched Context
   \param pkt - Vos data message buffer
 
@@ -1614,11 +1692,130 @@ struct VosTlshimPkt *vos_alloc_tlshim_pkt(pVosSchedContext pSchedContext)
 void vos_indicate_rxpkt(pVosSchedContext pSchedContext,
                         struct VosTlshimPkt *pkt)
 {
-   spin_lock_bh(&pSchedContext->TlshimRxQLock);
-   list_add_tail(&pkt->list, &pSchedContext->tlshimRxQueue);
-   spin_unlock_bh(&pSchedContext->TlshimRxQLock);
-   set_bit(RX_POST_EVENT_MASK, &pSchedContext->tlshimRxEvtFlg);
-   wake_up_interruptible(&pSchedContext->tlshimRxWaitQueue);
+   vos_tlshim_rx_enqueue(&pSchedContext->tlshimRx[0], pkt);
+}
+
+/*---------------------------------------------------------------------------
+  \brief vos_rx_flow_hash() - Hash the 5-tuple of an rx frame
+  Frames that are not TCP/UDP over IPv4/IPv6 are hashed on addresses only,
+  and non-IP frames hash to 0, so they are all handled by the first thread.
+  \param buf - 802.3 rx frame
+
+  \return flow hash
+  \sa vos_rx_flow_hash()
+  -------------------------------------------------------------------------*/
+static u_int32_t vos_rx_flow_hash(adf_nbuf_t buf)
+{
+   u_int8_t *data = adf_nbuf_data(buf);
+   u_int32_t len = adf_nbuf_len(buf);
+   u_int16_t ether_type;
+   u_int32_t saddr, daddr, ports = 0;
+   u_int8_t proto, hlen;
+
+   if (len < ETH_HLEN)
+       return 0;
+   ether_type = ((struct ethhdr *)data)->h_proto;
+   data += ETH_HLEN;
+   len -= ETH_HLEN;
+
+   if (ether_type == htons(ETH_P_IP)) {
+       struct iphdr *iph = (struct iphdr *)data;
+
+       if (len < sizeof(*iph))
+           return 0;
+       saddr = iph->saddr;
+       daddr = iph->daddr;
+       proto = iph->protocol;
+       hlen = iph->ihl * 4;
+       /* fragments carry no ports, hash them on addresses only */
+       if (iph->frag_off & htons(IP_MF | IP_OFFSET))
+           proto = 0;
+   } else if (ether_type == htons(ETH_P_IPV6)) {
+       struct ipv6hdr *ip6h = (struct ipv6hdr *)data;
+
+       if (len < sizeof(*ip6h))
+           return 0;
+       saddr = ip6h->saddr.s6_addr32[0] ^ ip6h->saddr.s6_addr32[1] ^
+               ip6h->saddr.s6_addr32[2] ^ ip6h->saddr.s6_addr32[3];
+       daddr = ip6h->daddr.s6_addr32[0] ^ ip6h->daddr.s6_addr32[1] ^
+               ip6h->daddr.s6_addr32[2] ^ ip6h->daddr.s6_addr32[3];
+       proto = ip6h->nexthdr;
+       hlen = sizeof(*ip6h);
+   } else {
+       return 0;
+   }
+
+   if ((proto == IPPROTO_TCP || proto == IPPROTO_UDP) &&
+       len >= hlen + sizeof(ports))
+       ports = get_unaligned((u_int32_t *)(data + hlen));
+
+   return jhash_3words(saddr, daddr, ports, proto);
+}
+
+/*---------------------------------------------------------------------------
+  \brief vos_indicate_rx_data() - API to Indicate a chain of rx data frames
+  The \a vos_indicate_rx_data() splits the rx frame chain carried by pkt
+  by flow hash and enqueues each part on the Tlshim Rx thread owning
+  that flow, so frames of one flow are always delivered in order.
+  \param  pSchedContext - pointer to the global vOSS Sched Context
+  \param pkt - Vos data message buffer
+
+  \return Nothing
+  \sa vos_indicate_rx_data()
+  -------------------------------------------------------------------------*/
+void vos_indicate_rx_data(pVosSchedContext pSchedContext,
+                          struct VosTlshimPkt *pkt)
+{
+   adf_nbuf_t head[VOS_MAX_TLSHIM_RX_THREADS] = { NULL };
+   adf_nbuf_t tail[VOS_MAX_TLSHIM_RX_THREADS] = { NULL };
+   adf_nbuf_t buf, next_buf;
+   struct VosTlshimPkt *part;
+   vos_tlshim_cb callback = pkt->callback;
+   void *context = pkt->context;
+   u_int16_t sta_id = pkt->staId;
+   int num_threads = pSchedContext->numTlshimRxThreads;
+   int i;
+
+   if (num_threads <= 1) {
+       vos_indicate_rxpkt(pSchedContext, pkt);
+       return;
+   }
+
+   for (buf = pkt->Rxpkt; buf; buf = next_buf) {
+       next_buf = adf_nbuf_next(buf);
+       adf_nbuf_set_next(buf, NULL);
+       i = vos_rx_flow_hash(buf) % num_threads;
+       if (head[i])
+           adf_nbuf_set_next(tail[i], buf);
+       else
+           head[i] = buf;
+       tail[i] = buf;
+   }
+
+   for (i = 0; i < num_threads; i++) {
+       if (!head[i])
+           continue;
+       if (pkt) {
+           /* the first part reuses the original message */
+           part = pkt;
+           pkt = NULL;
+       } else {
+           part = vos_alloc_tlshim_pkt(pSchedContext);
+           if (!part) {
+               for (buf = head[i]; buf; buf = next_buf) {
+                   next_buf = adf_nbuf_next(buf);
+                   adf_nbuf_free(buf);
+                   pSchedContext->tlshimRx[i].stats.dropped++;
+               }
+               continue;
+           }
+           part->callback = callback;
+           part->context = context;
+           part->staId = sta_id;
+       }
+       part->Rxpkt = head[i];
+       vos_tlshim_rx_enqueue(&pSchedContext->tlshimRx[i], part);
+   }
 }
 
 /*---------------------------------------------------------------------------
@@ -1635,29 +1832,37 @@ void vos_drop_rxpkt_by_staid(pVosSchedContext pSchedContext, u_int16_t staId)
 {
    struct list_head local_list;
    struct VosTlshimPkt *pkt, *tmp;
+   pVosTlshimRxCtx pRxCtx;
    adf_nbuf_t buf, next_buf;
+   int i;
 
-   INIT_LIST_HEAD(&local_list);
-   spin_lock_bh(&pSchedContext->TlshimRxQLock);
-   if (list_empty(&pSchedContext->tlshimRxQueue)) {
-       spin_unlock_bh(&pSchedContext->TlshimRxQLock);
-       return;
-   }
-   list_for_each_entry_safe(pkt, tmp, &pSchedContext->tlshimRxQueue, list) {
-       if (pkt->staId == staId || staId == WLAN_MAX_STA_COUNT)
-           list_move_tail(&pkt->list, &local_list);
-   }
-   spin_unlock_bh(&pSchedContext->TlshimRxQLock);
+   for (i = 0; i < pSchedContext->numTlshimRxThreads; i++) {
+       pRxCtx = &pSchedContext->tlshimRx[i];
+       INIT_LIST_HEAD(&local_list);
+       spin_lock_bh(&pRxCtx->rxQLock);
+       if (list_empty(&pRxCtx->rxQueue)) {
+           spin_unlock_bh(&pRxCtx->rxQLock);
+           continue;
+       }
+       list_for_each_entry_safe(pkt, tmp, &pRxCtx->rxQueue, list) {
+           if (pkt->staId == staId || staId == WLAN_MAX_STA_COUNT) {
+               list_move_tail(&pkt->list, &local_list);
+               pRxCtx->rxQlen--;
+           }
+       }
+       spin_unlock_bh(&pRxCtx->rxQLock);
 
-   list_for_each_entry_safe(pkt, tmp, &local_list, list) {
-       list_del(&pkt->list);
-       buf = pkt->Rxpkt;
-       while (buf) {
-           next_buf = adf_nbuf_queue_next(buf);
-           adf_nbuf_free(buf);
-           buf = next_buf;
+       list_for_each_entry_safe(pkt, tmp, &local_list, list) {
+           list_del(&pkt->list);
+           buf = pkt->Rxpkt;
+           while (buf) {
+               next_buf = adf_nbuf_queue_next(buf);
+               adf_nbuf_free(buf);
+               pRxCtx->stats.dropped++;
+               buf = next_buf;
+           }
+           vos_free_tlshim_pkt(pSchedContext, pkt);
        }
-       vos_free_tlshim_pkt(pSchedContext, pkt);
    }
 }
 
@@ -1665,41 +1870,44 @@ void vos_drop_rxpkt_by_staid(pVosSchedContext pSchedContext, u_int16_t staId)
   \brief vos_rx_from_queue() - Function to process pending Rx packets
   The \a vos_rx_from_queue() traverses the pending buffer list and calling
   the callback. This callback would essentially send the packet to HDD.
-  \param  pSchedContext - pointer to the global vOSS Sched Context
+  \param  pRxCtx - Tlshim Rx thread context
 
   \return Nothing
   \sa vos_rx_from_queue()
   -------------------------------------------------------------------------*/
-static void vos_rx_from_queue(pVosSchedContext pSchedContext)
+static void vos_rx_from_queue(pVosTlshimRxCtx pRxCtx)
 {
    struct VosTlshimPkt *pkt;
    u_int16_t sta_id;
 
-   spin_lock_bh(&pSchedContext->TlshimRxQLock);
-   while (!list_empty(&pSchedContext->tlshimRxQueue)) {
-           pkt = list_first_entry(&pSchedContext->tlshimRxQueue,
+   spin_lock_bh(&pRxCtx->rxQLock);
+   while (!list_empty(&pRxCtx->rxQueue)) {
+           pkt = list_first_entry(&pRxCtx->rxQueue,
                                   struct VosTlshimPkt, list);
            list_del(&pkt->list);
-           spin_unlock_bh(&pSchedContext->TlshimRxQLock);
+           pRxCtx->rxQlen--;
+           pRxCtx->stats.delivered++;
+           spin_unlock_bh(&pRxCtx->rxQLock);
            sta_id = pkt->staId;
            pkt->callback(pkt->context, pkt->Rxpkt, sta_id);
-           vos_free_tlshim_pkt(pSchedContext, pkt);
-           spin_lock_bh(&pSchedContext->TlshimRxQLock);
+           vos_free_tlshim_pkt(pRxCtx->pSchedContext, pkt);
+           spin_lock_bh(&pRxCtx->rxQLock);
    }
-   spin_unlock_bh(&pSchedContext->TlshimRxQLock);
+   spin_unlock_bh(&pRxCtx->rxQLock);
 }
 
 /*---------------------------------------------------------------------------
   \brief VosTlshimRxThread() - The VOSS Main Tlshim Rx thread
   The \a VosTlshimRxThread() is the thread for Tlshim Data packet processing.
-  \param  Arg - pointer to the global vOSS Sched Context
+  \param  Arg - pointer to the Tlshim Rx thread context
 
   \return Thread exit code
   \sa VosTlshimRxThread()
   -------------------------------------------------------------------------*/
 static int VosTlshimRxThread(void *arg)
 {
-   pVosSchedContext pSchedContext = (pVosSchedContext)arg;
+   pVosTlshimRxCtx pRxCtx = (pVosTlshimRxCtx)arg;
+   pVosSchedContext pSchedContext;
    unsigned long pref_cpu = 0;
    bool shutdown = false;
    int status, i;
@@ -1709,71 +1917,193 @@ static int VosTlshimRxThread(void *arg)
    set_wake_up_idle(true);
 #endif
 
-   /* Find the available cpu core other than cpu 0 and
-    * bind the thread */
-   for_each_online_cpu(i) {
-       if (i == 0)
-           continue;
-       pref_cpu = i;
-           break;
-   }
-   if (pref_cpu != 0 && (!vos_set_cpus_allowed_ptr(current, pref_cpu)))
-       affine_cpu = pref_cpu;
-
    if (!arg) {
        VOS_TRACE(VOS_MODULE_ID_VOSS, VOS_TRACE_LEVEL_ERROR,
        "%s: Bad Args passed", __func__);
        return 0;
    }
+   pSchedContext = pRxCtx->pSchedContext;
 
-   complete(&pSchedContext->TlshimRxStartEvent);
+   /* Find the available cpu core other than cpu 0 and
+    * bind the first thread; the others are placed by
+    * vos_sched_find_attach_cpu() */
+   if (pRxCtx->id == 0) {
+       for_each_online_cpu(i) {
+           if (i == 0)
+               continue;
+           pref_cpu = i;
+               break;
+       }
+       if (pref_cpu != 0 && (!vos_set_cpus_allowed_ptr(current, pref_cpu)))
+           pRxCtx->cpu = pref_cpu;
+   }
+
+   complete(&pRxCtx->StartEvent);
 
    while (!shutdown) {
-       status = wait_event_interruptible(pSchedContext->tlshimRxWaitQueue,
+       status = wait_event_interruptible(pRxCtx->waitQueue,
                          test_bit(RX_POST_EVENT_MASK,
-                                  &pSchedContext->tlshimRxEvtFlg) ||
+                                  &pRxCtx->evtFlg) ||
                          test_bit(RX_SUSPEND_EVENT_MASK,
-                                  &pSchedContext->tlshimRxEvtFlg));
+                                  &pRxCtx->evtFlg));
        if (status == -ERESTARTSYS)
            break;
 
-       clear_bit(RX_POST_EVENT_MASK, &pSchedContext->tlshimRxEvtFlg);
+       clear_bit(RX_POST_EVENT_MASK, &pRxCtx->evtFlg);
        while (true) {
            if (test_bit(RX_SHUTDOWN_EVENT_MASK,
-                      &pSchedContext->tlshimRxEvtFlg)) {
+                      &pRxCtx->evtFlg)) {
                clear_bit(RX_SHUTDOWN_EVENT_MASK,
-                         &pSchedContext->tlshimRxEvtFlg);
+                         &pRxCtx->evtFlg);
                if (test_bit(RX_SUSPEND_EVENT_MASK,
-                            &pSchedContext->tlshimRxEvtFlg)) {
+                            &pRxCtx->evtFlg)) {
                    clear_bit(RX_SUSPEND_EVENT_MASK,
-                             &pSchedContext->tlshimRxEvtFlg);
-                   complete(&pSchedContext->SuspndTlshimRxEvent);
+                             &pRxCtx->evtFlg);
+                   complete(&pRxCtx->SuspndEvent);
                }
                VOS_TRACE(VOS_MODULE_ID_VOSS, VOS_TRACE_LEVEL_INFO,
-                         "%s: Shutting down tl shim Tlshim rx thread", __func__);
+                         "%s: Shutting down tl shim Tlshim rx thread %d",
+                         __func__, pRxCtx->id);
                shutdown = true;
                break;
            }
-           vos_rx_from_queue(pSchedContext);
+           vos_rx_from_queue(pRxCtx);
 
            if (test_bit(RX_SUSPEND_EVENT_MASK,
-                        &pSchedContext->tlshimRxEvtFlg)) {
+                        &pRxCtx->evtFlg)) {
                clear_bit(RX_SUSPEND_EVENT_MASK,
-                         &pSchedContext->tlshimRxEvtFlg);
+                         &pRxCtx->evtFlg);
                spin_lock(&pSchedContext->TlshimRxThreadLock);
-               complete(&pSchedContext->SuspndTlshimRxEvent);
-               INIT_COMPLETION(pSchedContext->ResumeTlshimRxEvent);
+               complete(&pRxCtx->SuspndEvent);
+               INIT_COMPLETION(pRxCtx->ResumeEvent);
                spin_unlock(&pSchedContext->TlshimRxThreadLock);
                wait_for_completion_interruptible(
-                              &pSchedContext->ResumeTlshimRxEvent);
+                              &pRxCtx->ResumeEvent);
            }
            break;
        }
    }
 
    VOS_TRACE(VOS_MODULE_ID_VOSS, VOS_TRACE_LEVEL_INFO,
-             "%s: Exiting VOSS Tlshim rx thread", __func__);
-   complete_and_exit(&pSchedContext->TlshimRxShutdown, 0);
+             "%s: Exiting VOSS Tlshim rx thread %d", __func__, pRxCtx->id);
+   complete_and_exit(&pRxCtx->Shutdown, 0);
+}
+
+/*---------------------------------------------------------------------------
+  \brief vos_sched_suspend_tlshim_rx() - Suspend all Tlshim Rx threads
+  \param pSchedContext - pointer to the global vOSS Sched Context
+  \param timeout_ms - time to wait for each thread to suspend
+
+  \return 0 if all threads suspended, otherwise -ETIME with every thread
+          resumed again
+  \sa vos_sched_suspend_tlshim_rx()
+  -------------------------------------------------------------------------*/
+int vos_sched_suspend_tlshim_rx(pVosSchedContext pSchedContext,
+                                unsigned int timeout_ms)
+{
+   bool suspended[VOS_MAX_TLSHIM_RX_THREADS];
+   pVosTlshimRxCtx pRxCtx;
+   bool failed = false;
+   int i;
+
+   for (i = 0; i < pSchedContext->numTlshimRxThreads; i++) {
+       pRxCtx = &pSchedContext->tlshimRx[i];
+       set_bit(RX_SUSPEND_EVENT_MASK, &pRxCtx->evtFlg);
+       wake_up_interruptible(&pRxCtx->waitQueue);
+   }
+
+   for (i = 0; i < pSchedContext->numTlshimRxThreads; i++) {
+       pRxCtx = &pSchedContext->tlshimRx[i];
+       suspended[i] = wait_for_completion_timeout(&pRxCtx->SuspndEvent,
+                                   msecs_to_jiffies(timeout_ms)) != 0;
+       if (!suspended[i]) {
+           clear_bit(RX_SUSPEND_EVENT_MASK, &pRxCtx->evtFlg);
+           VOS_TRACE(VOS_MODULE_ID_VOSS, VOS_TRACE_LEVEL_ERROR,
+                     "%s: Failed to suspend tlshim rx thread %d",
+                     __func__, i);
+           failed = true;
+       }
+   }
+
+   if (!failed)
+       return 0;
+
+   for (i = 0; i < pSchedContext->numTlshimRxThreads; i++) {
+       if (suspended[i])
+           complete(&pSchedContext->tlshimRx[i].ResumeEvent);
+   }
+   return -ETIME;
+}
+
+/*---------------------------------------------------------------------------
+  \brief vos_sched_resume_tlshim_rx() - Resume all Tlshim Rx threads
+  \param pSchedContext - pointer to the global vOSS Sched Context
+
+  \return Nothing
+  \sa vos_sched_resume_tlshim_rx()
+  -------------------------------------------------------------------------*/
+void vos_sched_resume_tlshim_rx(pVosSchedContext pSchedContext)
+{
+   int i;
+
+   for (i = 0; i < pSchedContext->numTlshimRxThreads; i++)
+       complete(&pSchedContext->tlshimRx[i].ResumeEvent);
+}
+
+/*---------------------------------------------------------------------------
+  \brief vos_sched_stop_tlshim_rx() - Stop all Tlshim Rx threads
+  The \a vos_sched_stop_tlshim_rx() shuts the threads down, drops the rx
+  frames still queued to them and frees the message free queue.
+  \param pSchedContext - pointer to the global vOSS Sched Context
+
+  \return Nothing
+  \sa vos_sched_stop_tlshim_rx()
+  -------------------------------------------------------------------------*/
+void vos_sched_stop_tlshim_rx(pVosSchedContext pSchedContext)
+{
+   pVosTlshimRxCtx pRxCtx;
+   int i;
+
+   for (i = 0; i < pSchedContext->numTlshimRxThreads; i++) {
+       pRxCtx = &pSchedContext->tlshimRx[i];
+       if (!pRxCtx->thread)
+           continue;
+       set_bit(RX_SHUTDOWN_EVENT_MASK, &pRxCtx->evtFlg);
+       set_bit(RX_POST_EVENT_MASK, &pRxCtx->evtFlg);
+       wake_up_interruptible(&pRxCtx->waitQueue);
+       wait_for_completion(&pRxCtx->Shutdown);
+       pRxCtx->thread = NULL;
+   }
+   vos_drop_rxpkt_by_staid(pSchedContext, WLAN_MAX_STA_COUNT);
+   vos_free_tlshim_pkt_freeq(pSchedContext);
+}
+
+/*---------------------------------------------------------------------------
+  \brief vos_sched_tlshim_rx_stats_print() - Print Tlshim Rx thread stats
+  \param pSchedContext - pointer to the global vOSS Sched Context
+  \param buf - buffer to print into
+  \param buf_len - space left in buf
+
+  \return number of characters printed
+  \sa vos_sched_tlshim_rx_stats_print()
+  -------------------------------------------------------------------------*/
+int vos_sched_tlshim_rx_stats_print(pVosSchedContext pSchedContext,
+                                    char *buf, int buf_len)
+{
+   pVosTlshimRxCtx pRxCtx;
+   int len = 0;
+   int i;
+
+   for (i = 0; i < pSchedContext->numTlshimRxThreads; i++) {
+       pRxCtx = &pSchedContext->tlshimRx[i];
+       len += scnprintf(buf + len, buf_len - len,
+                        "\nrx thread %d: cpu %lu, depth %u (max %u), "
+                        "queued %u, delivered %u, dropped %u",
+                        i, pRxCtx->cpu, pRxCtx->rxQlen,
+                        pRxCtx->stats.maxQlen, pRxCtx->stats.enqueued,
+                        pRxCtx->stats.delivered, pRxCtx->stats.dropped);
+   }
+   return len;
 }
 #endif
 
@@ -1838,14 +2168,8 @@ VOS_STATUS vos_sched_close ( v_PVOID_t pVosContext )
 
 #ifdef QCA_CONFIG_SMP
     vos_lock_destroy(&gpVosSchedContext->affinity_lock);
-    // Shut down Tlshim Rx thread
-    set_bit(RX_SHUTDOWN_EVENT_MASK, &gpVosSchedContext->tlshimRxEvtFlg);
-    set_bit(RX_POST_EVENT_MASK, &gpVosSchedContext->tlshimRxEvtFlg);
-    wake_up_interruptible(&gpVosSchedContext->tlshimRxWaitQueue);
-    wait_for_completion(&gpVosSchedContext->TlshimRxShutdown);
-    gpVosSchedContext->TlshimRxThread = NULL;
-    vos_drop_rxpkt_by_staid(gpVosSchedContext, WLAN_MAX_STA_COUNT);
-    vos_free_tlshim_pkt_freeq(gpVosSchedContext);
+    // Shut down Tlshim Rx threads
+    vos_sched_stop_tlshim_rx(gpVosSchedContext);
     unregister_hotcpu_notifier(&vos_cpu_hotplug_notifier);
 #endif
     return VOS_STATUS_SUCCESS;
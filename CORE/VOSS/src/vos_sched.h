@@ -111,6 +111,16 @@
 */
 #define VOSS_MAX_TLSHIM_PKT 4000
 
+/*
+** Upper bound on the number of Tlshim Rx threads. One thread is started
+** per big core (a single one on single cluster systems); rx data is then
+** steered across them by flow hash, so each flow stays in order on one
+** thread.
+*/
+#ifndef VOS_MAX_TLSHIM_RX_THREADS
+#define VOS_MAX_TLSHIM_RX_THREADS 4
+#endif
+
 typedef void (*vos_tlshim_cb) (void *context, void *rxpkt, u_int16_t staid);
 #endif
 
@@ -148,6 +158,60 @@ typedef struct VosTlshimPkt
    vos_tlshim_cb callback;
 
 } *pVosTlshimPkt;
+
+/*
+** Per thread context of a Tlshim Rx thread.
+*/
+typedef struct VosTlshimRxCtx
+{
+   /* Back pointer to the scheduler context */
+   struct _VosSchedContext *pSchedContext;
+
+   /* Index of this thread */
+   u_int8_t id;
+
+   /* Tlshim Rx thread handle */
+   struct task_struct *thread;
+
+   /* Handle of Event for Rx thread to signal startup */
+   struct completion StartEvent;
+
+   /* Completion object to suspend tlshim rx thread */
+   struct completion SuspndEvent;
+
+   /* Completion objext to resume tlshim rx thread */
+   struct completion ResumeEvent;
+
+   /* Completion object for Tlshim Rxthread shutdown */
+   struct completion Shutdown;
+
+   /* Waitq for tlshim Rx thread */
+   wait_queue_head_t waitQueue;
+
+   unsigned long evtFlg;
+
+   /* Rx buffer queue */
+   struct list_head rxQueue;
+
+   /* Spinlock to synchronize between tasklet and thread */
+   spinlock_t rxQLock;
+
+   /* Rx queue length */
+   unsigned int rxQlen;
+
+   /* rx thread affinity cpu */
+   unsigned long cpu;
+
+   struct {
+      /* messages queued to / delivered by this thread */
+      unsigned int enqueued;
+      unsigned int delivered;
+      /* deepest the rx queue has been */
+      unsigned int maxQlen;
+      /* rx frames dropped instead of being delivered by this thread */
+      unsigned int dropped;
+   } stats;
+} VosTlshimRxCtx, *pVosTlshimRxCtx;
 #endif
 
 /*
@@ -246,34 +310,9 @@ typedef struct _VosSchedContext
 #ifdef QCA_CONFIG_SMP
    spinlock_t TlshimRxThreadLock;
 
-   /* Tlshim Rx thread handle */
-   struct task_struct *TlshimRxThread;
-
-   /* Handle of Event for Rx thread to signal startup */
-   struct completion TlshimRxStartEvent;
-
-   /* Completion object to suspend tlshim rx thread */
-   struct completion SuspndTlshimRxEvent;
-
-   /* Completion objext to resume tlshim rx thread */
-   struct completion ResumeTlshimRxEvent;
-
-   /* Completion object for Tlshim Rxthread shutdown */
-   struct completion TlshimRxShutdown;
-
-   /* Waitq for tlshim Rx thread */
-   wait_queue_head_t tlshimRxWaitQueue;
-
-   unsigned long tlshimRxEvtFlg;
-
-   /* Rx buffer queue */
-   struct list_head tlshimRxQueue;
-
-   /* Spinlock to synchronize between tasklet and thread */
-   spinlock_t TlshimRxQLock;
-
-   /* Rx queue length */
-   unsigned int TlshimRxQlen;
+   /* Tlshim Rx threads, the first numTlshimRxThreads of them are running */
+   VosTlshimRxCtx tlshimRx[VOS_MAX_TLSHIM_RX_THREADS];
+   u_int8_t numTlshimRxThreads;
 
    /* Lock to synchronize free buffer queue access */
    spinlock_t VosTlshimPktFreeQLock;
@@ -287,9 +326,6 @@ typedef struct _VosSchedContext
    /* affinity lock */
    vos_lock_t affinity_lock;
 
-   /* rx thread affinity cpu */
-   unsigned long rx_thread_cpu;
-
    /* high throughput required */
    bool high_throughput_required;
 #endif
@@ -440,8 +476,8 @@ void vos_drop_rxpkt_by_staid(pVosSchedContext pSchedContext, u_int16_t staId);
 
 /*---------------------------------------------------------------------------
   \brief vos_indicate_rxpkt() - API to Indicate rx data packet
-  The \a vos_indicate_rxpkt() enqueues the rx packet onto tlshimRxQueue
-  and notifies VosTlshimRxThread().
+  The \a vos_indicate_rxpkt() enqueues the rx packet onto the rx queue of
+  the first Tlshim Rx thread and notifies it.
   \param  Arg - pointer to the global vOSS Sched Context
   \param pkt - Vos data message buffer
 
@@ -451,6 +487,66 @@ void vos_drop_rxpkt_by_staid(pVosSchedContext pSchedContext, u_int16_t staId);
 void vos_indicate_rxpkt(pVosSchedContext pSchedContext,
                         struct VosTlshimPkt *pkt);
 
+/*---------------------------------------------------------------------------
+  \brief vos_indicate_rx_data() - API to Indicate a chain of rx data frames
+  The \a vos_indicate_rx_data() splits the rx frame chain carried by pkt
+  by flow hash and enqueues each part on the Tlshim Rx thread owning
+  that flow, so frames of one flow are always delivered in order.
+  pkt->Rxpkt must be a chain of 802.3 adf_nbufs; other frames must be
+  posted with vos_indicate_rxpkt().
+  \param  pSchedContext - pointer to the global vOSS Sched Context
+  \param pkt - Vos data message buffer
+
+  \return Nothing
+  \sa vos_indicate_rx_data()
+  -------------------------------------------------------------------------*/
+void vos_indicate_rx_data(pVosSchedContext pSchedContext,
+                          struct VosTlshimPkt *pkt);
+
+/*---------------------------------------------------------------------------
+  \brief vos_sched_suspend_tlshim_rx() - Suspend all Tlshim Rx threads
+  \param pSchedContext - pointer to the global vOSS Sched Context
+  \param timeout_ms - time to wait for each thread to suspend
+
+  \return 0 if all threads suspended, otherwise -ETIME with every thread
+          resumed again
+  \sa vos_sched_suspend_tlshim_rx()
+  -------------------------------------------------------------------------*/
+int vos_sched_suspend_tlshim_rx(pVosSchedContext pSchedContext,
+                                unsigned int timeout_ms);
+
+/*---------------------------------------------------------------------------
+  \brief vos_sched_resume_tlshim_rx() - Resume all Tlshim Rx threads
+  \param pSchedContext - pointer to the global vOSS Sched Context
+
+  \return Nothing
+  \sa vos_sched_resume_tlshim_rx()
+  -------------------------------------------------------------------------*/
+void vos_sched_resume_tlshim_rx(pVosSchedContext pSchedContext);
+
+/*---------------------------------------------------------------------------
+  \brief vos_sched_stop_tlshim_rx() - Stop all Tlshim Rx threads
+  The \a vos_sched_stop_tlshim_rx() shuts the threads down, drops the rx
+  frames still queued to them and frees the message free queue.
+  \param pSchedContext - pointer to the global vOSS Sched Context
+
+  \return Nothing
+  \sa vos_sched_stop_tlshim_rx()
+  -------------------------------------------------------------------------*/
+void vos_sched_stop_tlshim_rx(pVosSchedContext pSchedContext);
+
+/*---------------------------------------------------------------------------
+  \brief vos_sched_tlshim_rx_stats_print() - Print Tlshim Rx thread stats
+  \param pSchedContext - pointer to the global vOSS Sched Context
+  \param buf - buffer to print into
+  \param buf_len - space left in buf
+
+  \return number of characters printed
+  \sa vos_sched_tlshim_rx_stats_print()
+  -------------------------------------------------------------------------*/
+int vos_sched_tlshim_rx_stats_print(pVosSchedContext pSchedContext,
+                                    char *buf, int buf_len);
+
 /*---------------------------------------------------------------------------
   \brief vos_alloc_tlshim_pkt() - API to return next available vos message
   The \a vos_alloc_tlshim_pkt() returns next available vos message buffer